@@ -28,6 +28,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <stddef.h>
 #include <stdint.h>
 
+#include "ConvectionKernels_Config.h"
+
 namespace cvtt
 {
     namespace Flags
@@ -59,6 +61,18 @@ namespace cvtt
         // Use accurate quantization functions when quantizing fake BT.709 (much slower, marginal improvement on specific blocks)
         const uint32_t ETC_FakeBT709Accurate    = 0x800;
 
+        // Skip BC7 shapes whose estimated minimum error is already beaten by a previous mode in every block (faster, output
+        // can differ slightly, see Options::pruneToleranceBC7)
+        const uint32_t BC7_PruneShapes          = 0x1000;
+
+        // Encode BC1-BC5 with bounding box endpoints and a single index pass, skipping the endpoint search and refinement
+        // (much faster, worse quality, intended for compressing textures at runtime)
+        const uint32_t S3TC_RealTime            = 0x2000;
+
+        // Encode BC7 with only modes 6 and 5, using bounding box endpoints and one refinement pass (much faster, worse quality,
+        // intended for compressing textures at runtime, the encoding plan is ignored)
+        const uint32_t BC7_RealTime             = 0x4000;
+
         // Misc useful default flag combinations
         const uint32_t Fastest = (BC6H_FastIndexing | BC7_FastIndexing | S3TC_Paranoid);
         const uint32_t Faster = (BC6H_FastIndexing | BC7_FastIndexing | S3TC_Paranoid);
@@ -68,7 +82,16 @@ namespace cvtt
         const uint32_t Ultra = (BC7_TrySingleColor | S3TC_Paranoid | S3TC_Exhaustive | ETC_FakeBT709Accurate);
     }
 
+#if defined(CVTT_USE_AVX512) || defined(CVTT_USE_RUNTIME_DISPATCH)
+    const unsigned int NumParallelBlocks = 32;
+#elif defined(CVTT_USE_AVX2)
+    const unsigned int NumParallelBlocks = 16;
+#else
     const unsigned int NumParallelBlocks = 8;
+#endif
+
+    struct EncodingStats;
+    struct PersistentBlockCache;
 
     struct Options
     {
@@ -86,6 +109,12 @@ namespace cvtt
 
         int seedPoints;         // Number of seed points (min 1, max 4)
 
+        float pruneToleranceBC7;    // Fraction that estimated shape errors are increased by before comparing with BC7_PruneShapes
+
+        EncodingStats *stats;   // If set, BC6H and BC7 encoders add the modes and partitions they choose to this.  Not thread-safe.
+
+        PersistentBlockCache *blockCache;   // If set, surface encoders reuse encoded blocks from this cache and add new ones to it
+
         Options()
             : flags(Flags::Default)
             , threshold(0.5f)
@@ -98,6 +127,9 @@ namespace cvtt
             , refineRoundsIIC(8)
             , refineRoundsS3TC(2)
             , seedPoints(4)
+            , pruneToleranceBC7(0.0f)
+            , stats(NULL)
+            , blockCache(NULL)
         {
         }
     };
@@ -143,6 +175,7 @@ namespace cvtt
     {
         static const int kNumRGBAShapes = 129;
         static const int kNumRGBShapes = 243;
+        static const int kSerializedSize = 250;
 
         uint64_t mode1PartitionEnabled;
         uint64_t mode2PartitionEnabled;
@@ -198,6 +231,105 @@ namespace cvtt
         }
     };
 
+    // Timing data collected from the BC7 encoder when CVTT_ENABLE_INSTRUMENTATION is defined.  Cycle counts come from the CPU
+    // time stamp counter, and each call processes a whole group of NumParallelBlocks blocks.
+    struct BC7InstrumentationStats
+    {
+        enum Stage
+        {
+            Stage_InitialEndpoints,     // Initial endpoint selection for every shape in the encoding plan
+            Stage_ShapeRefine,          // Seed point tweak and refine loops for modes 0-3, 6, and 7
+            Stage_SingleColor,          // Single color table lookups (BC7_TrySingleColor), included in Stage_ShapeRefine
+            Stage_PartitionSelection,   // Combining shape results into partitions
+            Stage_DualPlane,            // Modes 4 and 5
+            Stage_BitPacking,           // Writing the output blocks
+
+            Stage_Count
+        };
+
+        uint64_t stageCycles[Stage_Count];
+        uint64_t stageCalls[Stage_Count];
+
+        // Per mode, calls are shape evaluations for modes 0-3, 6, and 7, and rotations for modes 4 and 5
+        uint64_t modeCycles[8];
+        uint64_t modeCalls[8];
+
+        // Per shape for modes 0-3, 6, and 7, using the same shape numbering as BC7EncodingPlan
+        uint64_t shapeCycles[BC7EncodingPlan::kNumRGBShapes];
+        uint64_t shapeCalls[BC7EncodingPlan::kNumRGBShapes];
+
+        // Per rotation for modes 4 and 5
+        uint64_t rotationCycles[2][4];
+        uint64_t rotationCalls[2][4];
+
+        uint64_t numPackCalls;
+        uint64_t numBlocks;         // Includes unused blocks in partially-filled groups
+
+        BC7InstrumentationStats()
+        {
+            for (int i = 0; i < Stage_Count; i++)
+                this->stageCycles[i] = this->stageCalls[i] = 0;
+
+            for (int i = 0; i < 8; i++)
+                this->modeCycles[i] = this->modeCalls[i] = 0;
+
+            for (int i = 0; i < BC7EncodingPlan::kNumRGBShapes; i++)
+                this->shapeCycles[i] = this->shapeCalls[i] = 0;
+
+            for (int i = 0; i < 2; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                    this->rotationCycles[i][j] = this->rotationCalls[i][j] = 0;
+            }
+
+            this->numPackCalls = 0;
+            this->numBlocks = 0;
+        }
+    };
+
+    // Counts of the modes and partitions chosen by the BC6H and BC7 encoders, read back from the encoded blocks
+    struct EncodingStats
+    {
+        uint64_t bc7ModeCounts[8];
+        uint64_t bc7PartitionCounts[8][64];     // Per mode, for modes 0-3 and 7, using the same numbering as BC7EncodingPlan
+        uint64_t bc7RotationCounts[2][4];       // Modes 4 and 5
+        uint64_t bc7IndexSelectorCounts[2];     // Mode 4
+        uint64_t numBC7Blocks;
+
+        uint64_t bc6hModeCounts[14];            // Mode 1 is at index 0
+        uint64_t bc6hPartitionCounts[10][32];   // Modes 1-10
+        uint64_t numBC6HBlocks;
+
+        EncodingStats()
+        {
+            for (int i = 0; i < 8; i++)
+            {
+                this->bc7ModeCounts[i] = 0;
+                for (int j = 0; j < 64; j++)
+                    this->bc7PartitionCounts[i][j] = 0;
+            }
+
+            for (int i = 0; i < 2; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                    this->bc7RotationCounts[i][j] = 0;
+                this->bc7IndexSelectorCounts[i] = 0;
+            }
+
+            for (int i = 0; i < 14; i++)
+                this->bc6hModeCounts[i] = 0;
+
+            for (int i = 0; i < 10; i++)
+            {
+                for (int j = 0; j < 32; j++)
+                    this->bc6hPartitionCounts[i][j] = 0;
+            }
+
+            this->numBC7Blocks = 0;
+            this->numBC6HBlocks = 0;
+        }
+    };
+
     // RGBA input block for unsigned 8-bit formats
     struct PixelBlockU8
     {
@@ -221,16 +353,57 @@ namespace cvtt
         int16_t m_pixels[16][4];
     };
 
+    // Compressed formats supported by EncodeSurface.  Source pixel layouts are:
+    //  - BC1, BC2, BC3, BC4U, BC5U, BC7, ETC1, ETC2 RGB/RGBA/punchthrough, ETC2 alpha: 4 x uint8_t (RGBA), same as PixelBlockU8
+    //  - BC4S, BC5S: 4 x int8_t (RGBA), same as PixelBlockS8
+    //  - BC6HU, BC6HS: 4 x int16_t (RGBA half float), same as PixelBlockF16
+    //  - ETC2 alpha 11: 1 x int16_t, same as PixelBlockScalarS16
+    enum SurfaceFormat
+    {
+        SurfaceFormat_BC1,
+        SurfaceFormat_BC2,
+        SurfaceFormat_BC3,
+        SurfaceFormat_BC4U,
+        SurfaceFormat_BC4S,
+        SurfaceFormat_BC5U,
+        SurfaceFormat_BC5S,
+        SurfaceFormat_BC6HU,
+        SurfaceFormat_BC6HS,
+        SurfaceFormat_BC7,
+        SurfaceFormat_ETC1,
+        SurfaceFormat_ETC2,
+        SurfaceFormat_ETC2RGBA,
+        SurfaceFormat_ETC2PunchthroughAlpha,
+        SurfaceFormat_ETC2Alpha,
+        SurfaceFormat_ETC2Alpha11U,
+        SurfaceFormat_ETC2Alpha11S,
+
+        SurfaceFormat_Count
+    };
+
+    // Output pixel layouts supported by DecodeBC6HSurface
+    enum HDRSurfaceFormat
+    {
+        HDRSurfaceFormat_RGBA16F,   // 4 x int16_t (RGBA half float), same as PixelBlockF16
+        HDRSurfaceFormat_RGB32F     // 3 x float (RGB)
+    };
+
     class ETC2CompressionData
     {
     protected:
-        ETC2CompressionData() {}
+        ETC2CompressionData();
     };
 
     class ETC1CompressionData
     {
     protected:
-        ETC1CompressionData() {}
+        ETC1CompressionData();
+    };
+
+    class SurfaceStreamEncoder
+    {
+    protected:
+        SurfaceStreamEncoder() {}
     };
 
     namespace Kernels
@@ -238,6 +411,34 @@ namespace cvtt
         typedef void* allocFunc_t(void *context, size_t size);
         typedef void freeFunc_t(void *context, void* ptr, size_t size);
 
+        // Runs taskFunc once for each task index from 0 to numTasks - 1, and returns once all of them have finished.
+        // The tasks may run concurrently in any order.
+        typedef void parallelTaskFunc_t(void *taskData, unsigned int taskIndex);
+        typedef void runParallelTasksFunc_t(void *context, parallelTaskFunc_t *taskFunc, void *taskData, unsigned int numTasks);
+
+        // Receives one row of compressed blocks from a surface stream encoder.  pBC is only valid during the call.
+        typedef void surfaceStreamSinkFunc_t(void *context, uint32_t blockRow, const uint8_t *pBC, size_t size);
+
+        struct ParallelEncodeOptions
+        {
+            unsigned int numThreads;                // Maximum number of workers, 0 uses one per hardware thread
+            runParallelTasksFunc_t *runTasksFunc;   // If set, workers are run as tasks with this instead of on new threads
+            void *runTasksContext;
+            allocFunc_t *allocFunc;                 // Used to allocate per-worker ETC temporary storage, malloc is used if NULL
+            freeFunc_t *freeFunc;
+            void *allocContext;
+
+            ParallelEncodeOptions()
+                : numThreads(0)
+                , runTasksFunc(NULL)
+                , runTasksContext(NULL)
+                , allocFunc(NULL)
+                , freeFunc(NULL)
+                , allocContext(NULL)
+            {
+            }
+        };
+
         // NOTE: All functions accept and output NumParallelBlocks blocks at once
         void EncodeBC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options);
         void EncodeBC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options);
@@ -257,12 +458,50 @@ namespace cvtt
         void EncodeETC2Alpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options);
         void EncodeETC2Alpha11(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, bool isSigned, const cvtt::Options &options);
 
-        // Generates a BC7 encoding plan from a quality parameter that ranges from 1 (fastest) to 100 (best)
+        // Batch versions of the encode functions, which accept and output numBlocks blocks.  numBlocks can be any value.
+        void EncodeBC1Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC2Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC3Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC4UBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC4SBatch(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC5UBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC5SBatch(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC6HUBatch(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC6HSBatch(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const Options &options);
+        void EncodeBC7Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, const BC7EncodingPlan &encodingPlan);
+        void EncodeETC1Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC1CompressionData *compressionData);
+        void EncodeETC2Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC2CompressionData *compressionData);
+        void EncodeETC2RGBABatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData);
+        void EncodeETC2PunchthroughAlphaBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData);
+        void EncodeETC2AlphaBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options);
+        void EncodeETC2Alpha11Batch(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, size_t numBlocks, bool isSigned, const cvtt::Options &options);
+
+        // Generates a BC7 encoding plan from a quality parameter that ranges from 1 (fastest) to 100 (best).  Plans for each quality
+        // level are precomputed (see MakeTables/MakeBC7QualityPlans.cpp), so this is fast.
         void ConfigureBC7EncodingPlanFromQuality(BC7EncodingPlan &encodingPlan, int quality);
 
         // Generates a BC7 encoding plan from fine-tuning parameters.
         bool ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan &encodingPlan, const BC7FineTuningParams &params);
 
+        // Writes an encoding plan to BC7EncodingPlan::kSerializedSize bytes, in a versioned format that is the same on every platform
+        // and instruction set.
+        void SerializeBC7EncodingPlan(const BC7EncodingPlan &encodingPlan, uint8_t *outData);
+
+        // Reads an encoding plan written by SerializeBC7EncodingPlan.  Returns false and leaves the plan unchanged if the data is
+        // too small, invalid, or from an incompatible version.
+        bool DeserializeBC7EncodingPlan(BC7EncodingPlan &encodingPlan, const uint8_t *data, size_t size);
+
+        // Estimates the work done per block by the BC7 encoder with an encoding plan, counted in seed points evaluated per shape.
+        // Use this to compare plans or to get a work budget for TrainBC7FineTuningParams from a quality level.
+        uint32_t EstimateBC7EncodingPlanWork(const BC7EncodingPlan &encodingPlan);
+
+        // Picks BC7 mode configurations and seed point counts that work well for a set of sample blocks.  Each configuration
+        // is tried on every sample, then the ones that remove the most error for the work they add are chosen until the plan
+        // generated from the result would exceed workBudget (see EstimateBC7EncodingPlanWork).  This encodes the samples
+        // about a thousand times and stores an error for each one of those, so a few thousand samples is usually enough.
+        // Returns false if there are no samples.
+        bool TrainBC7FineTuningParams(BC7FineTuningParams &outParams, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, uint32_t workBudget);
+
         // ETC compression requires temporary storage that normally consumes a large amount of stack space.
         // To allocate and release it, use one of these functions.
         ETC2CompressionData *AllocETC2Data(allocFunc_t allocFunc, void *context, const cvtt::Options &options);
@@ -271,9 +510,111 @@ namespace cvtt
         ETC1CompressionData *AllocETC1Data(allocFunc_t allocFunc, void *context);
         void ReleaseETC1Data(ETC1CompressionData *compressionData, freeFunc_t freeFunc);
 
+        // Returns the size of one compressed block, in bytes
+        unsigned int GetBlockSizeBytes(SurfaceFormat format);
+
+        // Returns the size of one source pixel expected by EncodeSurface, in bytes
+        unsigned int GetSourcePixelSizeBytes(SurfaceFormat format);
+
+        // Encodes a whole surface.  Rows of source pixels are rowPitch bytes apart, and rows of output blocks are
+        // outRowPitch bytes apart.  Edge blocks of surfaces that aren't a multiple of 4 in size are padded by repeating
+        // the last row and column.  encodingPlan is only used by BC7 (NULL uses the default plan), etc1Data only by ETC1,
+        // and etc2Data by the other ETC2 color formats.  Returns false if a required argument is missing.
+        bool EncodeSurface(SurfaceFormat format, const void *pixels, size_t rowPitch, uint32_t width, uint32_t height, uint8_t *pBC, size_t outRowPitch,
+            const Options &options, const BC7EncodingPlan *encodingPlan = NULL, ETC1CompressionData *etc1Data = NULL, ETC2CompressionData *etc2Data = NULL);
+
+        // Same as EncodeSurface, but splits the surface into tiles that are encoded by multiple workers.  ETC temporary storage
+        // is allocated for each worker.  If Options::stats is set, each worker counts into its own stats, which are added to it once all
+        // workers finish.  Returns false if a required argument is missing or an allocation fails.
+        bool EncodeSurfaceParallel(SurfaceFormat format, const void *pixels, size_t rowPitch, uint32_t width, uint32_t height, uint8_t *pBC, size_t outRowPitch,
+            const Options &options, const ParallelEncodeOptions &parallelOptions, const BC7EncodingPlan *encodingPlan = NULL);
+
+        // Surface stream encoders encode a surface that is supplied a few rows at a time, and pass each row of blocks to a sink as soon
+        // as it is encoded.  Only one band of 4 rows of source pixels and one row of blocks are kept.  The options and encoding plan
+        // are copied.  freeFunc is only used to clean up if an allocation fails.  Returns NULL if an allocation fails or a required
+        // argument is missing.
+        SurfaceStreamEncoder *AllocSurfaceStreamEncoder(allocFunc_t allocFunc, freeFunc_t freeFunc, void *context, SurfaceFormat format, uint32_t width, uint32_t height,
+            const Options &options, const BC7EncodingPlan *encodingPlan, surfaceStreamSinkFunc_t *sinkFunc, void *sinkContext);
+        void ReleaseSurfaceStreamEncoder(SurfaceStreamEncoder *encoder, freeFunc_t freeFunc);
+
+        // Adds numRows rows of source pixels, rowPitch bytes apart, to the surface.  Rows can be supplied in any number per call.  Once
+        // the last row of the surface is added, the final row of blocks is padded and encoded.  Returns false if there are more rows
+        // than the surface has left.
+        bool PushSurfaceStreamRows(SurfaceStreamEncoder *encoder, const void *pixels, size_t rowPitch, uint32_t numRows);
+
+        // Retrieves the BC7 timing data accumulated by all threads since the last reset.  Returns false if instrumentation isn't
+        // compiled in (see CVTT_ENABLE_INSTRUMENTATION).
+        bool GetBC7InstrumentationStats(BC7InstrumentationStats &outStats);
+        void ResetBC7InstrumentationStats();
+
+        // Adds the modes and partitions of numBlocks encoded blocks to a set of stats.  The encoders do this automatically if
+        // Options::stats is set.
+        void AddBC7EncodingStats(EncodingStats &stats, const uint8_t *pBC, size_t numBlocks);
+        void AddBC6HEncodingStats(EncodingStats &stats, const uint8_t *pBC, size_t numBlocks);
+        void MergeEncodingStats(EncodingStats &stats, const EncodingStats &otherStats);
+
+        // Persistent block caches store encoded blocks in caller-provided memory, such as a memory-mapped file, so that unchanged
+        // blocks of a surface can be reused by later runs.  Blocks are keyed by their source pixels, the format, the options, and
+        // the BC7 encoding plan.  GetPersistentBlockCacheSize returns the storage size needed for a number of entries.
+        size_t GetPersistentBlockCacheSize(uint32_t numEntries);
+
+        // Prepares storage for use as a persistent block cache.  If the storage already holds a cache with the same layout, its
+        // entries are kept, otherwise it is cleared.  Storage must be 8-byte aligned.  Returns NULL if it is too small to hold one
+        // bucket of 4 entries.  Caches with a few times more entries than the blocks being encoded lose few blocks to replacement.
+        // The cache can be shared by the workers of EncodeSurfaceParallel, but not by multiple encodes at once.
+        PersistentBlockCache *InitPersistentBlockCache(void *storage, size_t size);
+
+        // Decoders for BC1-BC5 work on whole SIMD groups of blocks.  Interpolated colors use the same rounding that the encoders
+        // assume.  Channels that a format doesn't store are decoded as 0, except for alpha, which is opaque.  BC1 blocks in
+        // 3-color mode decode index 3 as transparent black.  The Batch versions decode numBlocks blocks.
+        void DecodeBC1(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC1Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC2(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC2Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC3(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC3Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC4U(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC4UBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC4S(PixelBlockS8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC4SBatch(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC5U(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC5UBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeBC5S(PixelBlockS8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC5SBatch(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+
+        // Decoders for ETC1, ETC2, and EAC.  ETC1 blocks are decoded as ETC2, which is a superset.  ETC2 alpha is decoded to
+        // the alpha channel with the color channels set to 0.  11-bit EAC values use the same range as EncodeETC2Alpha11, and
+        // RG11 blocks are decoded to separate red and green blocks.
+        void DecodeETC1(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeETC1Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeETC2(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeETC2Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeETC2RGBA(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeETC2RGBABatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeETC2PunchthroughAlpha(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeETC2PunchthroughAlphaBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeETC2Alpha(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeETC2AlphaBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+        void DecodeETC2Alpha11(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, bool isSigned);
+        void DecodeETC2Alpha11Batch(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned);
+        void DecodeETC2RG11(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, bool isSigned);
+        void DecodeETC2RG11Batch(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned);
+
+        // BC6H blocks are decoded with an alpha of 1.0.  Blocks with a reserved mode decode to black.
         void DecodeBC6HU(PixelBlockF16 *pBlocks, const uint8_t *pBC);
+        void DecodeBC6HUBatch(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks);
         void DecodeBC6HS(PixelBlockF16 *pBlocks, const uint8_t *pBC);
+        void DecodeBC6HSBatch(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+
+        // Decodes a whole BC6H surface.  Rows of blocks are bcRowPitch bytes apart, and rows of output pixels are rowPitch
+        // bytes apart.  Only pixels inside the surface are written.  Returns false if a required argument is missing, the
+        // format is unknown, or the decode buffer can't be allocated.
+        bool DecodeBC6HSurface(const uint8_t *pBC, size_t bcRowPitch, uint32_t width, uint32_t height, bool isSigned,
+            HDRSurfaceFormat format, void *pixels, size_t rowPitch);
+
+        // BC7 blocks with a reserved mode decode to 0.
         void DecodeBC7(PixelBlockU8 *pBlocks, const uint8_t *pBC);
+        void DecodeBC7Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
     }
 }
 
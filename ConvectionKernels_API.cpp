@@ -31,29 +31,338 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ConvectionKernels_BC67.h"
 #include "ConvectionKernels_ETC.h"
 #include "ConvectionKernels_S3TC.h"
+#include "ConvectionKernels_Dispatch.h"
 
 #include <assert.h>
+#include <string.h>
 
 namespace cvtt
 {
-    namespace Kernels
+    CVTT_ISA_NAMESPACE_BEGIN
+    namespace EntryPoints
     {
-        void EncodeBC7(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, const BC7EncodingPlan &encodingPlan)
+        // Input and output for one SIMD group of blocks.  Groups at the end of a batch that have fewer than ParallelSize
+        // blocks encode from a copy padded with the last block, and only the real blocks are copied to the output.
+        template<class TBlock, size_t TOutputSize>
+        class BlockGroup
         {
-            assert(pBlocks);
-            assert(pBC);
+        public:
+            BlockGroup(uint8_t *pBC, const TBlock *pBlocks, size_t blockBase, size_t numBlocks)
+                : m_pBC(pBC + blockBase * TOutputSize)
+                , m_pBlocks(pBlocks + blockBase)
+                , m_numBlocks(numBlocks - blockBase)
+            {
+                if (m_numBlocks < ParallelMath::ParallelSize)
+                {
+                    for (size_t block = 0; block < ParallelMath::ParallelSize; block++)
+                        m_paddedBlocks[block] = m_pBlocks[Util::Min(block, m_numBlocks - 1)];
+                }
+            }
 
-            float channelWeights[4];
-            Util::FillWeights(options, channelWeights);
+            const TBlock *GetInput() const
+            {
+                return (m_numBlocks < ParallelMath::ParallelSize) ? m_paddedBlocks : m_pBlocks;
+            }
+
+            uint8_t *GetOutput()
+            {
+                return (m_numBlocks < ParallelMath::ParallelSize) ? m_paddedOutput : m_pBC;
+            }
+
+            void Commit()
+            {
+                if (m_numBlocks < ParallelMath::ParallelSize)
+                    memcpy(m_pBC, m_paddedOutput, m_numBlocks * TOutputSize);
+            }
+
+        private:
+            uint8_t *m_pBC;
+            const TBlock *m_pBlocks;
+            size_t m_numBlocks;
+
+            TBlock m_paddedBlocks[ParallelMath::ParallelSize];
+            uint8_t m_paddedOutput[ParallelMath::ParallelSize * TOutputSize];
+        };
+
+        // Output and input for decoding one SIMD group of blocks.  Groups at the end of a batch that have fewer than ParallelSize
+        // blocks decode from a copy padded with the last block, and only the real blocks are copied to the output.
+        template<class TBlock, size_t TInputSize>
+        class UnpackGroup
+        {
+        public:
+            UnpackGroup(TBlock *pBlocks, const uint8_t *pBC, size_t blockBase, size_t numBlocks)
+                : m_pBlocks(pBlocks + blockBase)
+                , m_pBC(pBC + blockBase * TInputSize)
+                , m_numBlocks(numBlocks - blockBase)
+            {
+                if (m_numBlocks < ParallelMath::ParallelSize)
+                {
+                    for (size_t block = 0; block < ParallelMath::ParallelSize; block++)
+                        memcpy(m_paddedInput + block * TInputSize, m_pBC + Util::Min(block, m_numBlocks - 1) * TInputSize, TInputSize);
+                }
+            }
+
+            const uint8_t *GetInput() const
+            {
+                return (m_numBlocks < ParallelMath::ParallelSize) ? m_paddedInput : m_pBC;
+            }
+
+            TBlock *GetOutput()
+            {
+                return (m_numBlocks < ParallelMath::ParallelSize) ? m_paddedBlocks : m_pBlocks;
+            }
+
+            void Commit()
+            {
+                if (m_numBlocks < ParallelMath::ParallelSize)
+                {
+                    for (size_t block = 0; block < m_numBlocks; block++)
+                        m_pBlocks[block] = m_paddedBlocks[block];
+                }
+            }
+
+        private:
+            TBlock *m_pBlocks;
+            const uint8_t *m_pBC;
+            size_t m_numBlocks;
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            uint8_t m_paddedInput[ParallelMath::ParallelSize * TInputSize];
+            TBlock m_paddedBlocks[ParallelMath::ParallelSize];
+        };
+
+        // Encoders skip work such as alpha handling or shape refinement for a SIMD group only if every block in the group allows
+        // it, so one unusual block slows down the whole group.  To avoid that, batches are split into windows of a few groups,
+        // and the blocks in each window are sorted by class so that similar blocks are encoded together.  Each block's output
+        // doesn't depend on the other blocks in its group, so this doesn't change the result.
+        class BlockReorderWindow
+        {
+        public:
+            static const size_t kMaxBlocks = ParallelMath::ParallelSize * 8;
+
+            BlockReorderWindow(const PixelBlockU8 *pBlocks, size_t numBlocks)
+                : m_numBlocks(numBlocks)
+            {
+                assert(numBlocks <= kMaxBlocks);
+
+                uint8_t blockClasses[kMaxBlocks];
+                size_t classStarts[kNumClasses + 1];
+
+                for (int blockClass = 0; blockClass <= kNumClasses; blockClass++)
+                    classStarts[blockClass] = 0;
+
+                for (size_t block = 0; block < numBlocks; block++)
+                {
+                    blockClasses[block] = Classify(pBlocks[block]);
+                    classStarts[blockClasses[block] + 1]++;
+                }
+
+                for (int blockClass = 0; blockClass < kNumClasses; blockClass++)
+                    classStarts[blockClass + 1] += classStarts[blockClass];
+
+                for (size_t block = 0; block < numBlocks; block++)
+                {
+                    const size_t sortedIndex = classStarts[blockClasses[block]]++;
+                    m_blocks[sortedIndex] = pBlocks[block];
+                    m_order[sortedIndex] = static_cast<uint16_t>(block);
+                }
+            }
+
+            const PixelBlockU8 *GetBlocks() const
+            {
+                return m_blocks;
+            }
+
+            size_t GetNumBlocks() const
+            {
+                return m_numBlocks;
+            }
+
+            void Scatter(uint8_t *pBC, const uint8_t *sortedBC, size_t blockSize) const
+            {
+                for (size_t sortedIndex = 0; sortedIndex < m_numBlocks; sortedIndex++)
+                    memcpy(pBC + m_order[sortedIndex] * blockSize, sortedBC + sortedIndex * blockSize, blockSize);
+            }
+
+        private:
+            // Opaque, punch-through, or translucent, times solid, low contrast, or high contrast
+            static const int kNumClasses = 9;
+            static const int kLowContrastRange = 24;
+
+            static uint8_t Classify(const PixelBlockU8 &block)
+            {
+                uint8_t minValues[4];
+                uint8_t maxValues[4];
+                bool isPunchThrough = true;
+
+                for (int ch = 0; ch < 4; ch++)
+                    minValues[ch] = maxValues[ch] = block.m_pixels[0][ch];
+
+                for (int px = 0; px < 16; px++)
+                {
+                    for (int ch = 0; ch < 4; ch++)
+                    {
+                        minValues[ch] = Util::Min(minValues[ch], block.m_pixels[px][ch]);
+                        maxValues[ch] = Util::Max(maxValues[ch], block.m_pixels[px][ch]);
+                    }
+
+                    const uint8_t alpha = block.m_pixels[px][3];
+                    isPunchThrough = isPunchThrough && (alpha == 0 || alpha == 255);
+                }
+
+                int alphaClass = 2;
+                if (minValues[3] == 255)
+                    alphaClass = 0;
+                else if (isPunchThrough)
+                    alphaClass = 1;
+
+                int maxRange = 0;
+                for (int ch = 0; ch < 4; ch++)
+                    maxRange = Util::Max(maxRange, maxValues[ch] - minValues[ch]);
+
+                int contrastClass = 2;
+                if (maxRange == 0)
+                    contrastClass = 0;
+                else if (maxRange <= kLowContrastRange)
+                    contrastClass = 1;
+
+                return static_cast<uint8_t>(alphaClass * 3 + contrastClass);
+            }
+
+            PixelBlockU8 m_blocks[kMaxBlocks];
+            uint16_t m_order[kMaxBlocks];
+            size_t m_numBlocks;
+        };
+
+        // Encodes a batch with TGroupEncoder::EncodeGroup, reordering blocks if there is more than one group
+        template<size_t TOutputSize, class TGroupEncoder>
+        void EncodeReordered(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const TGroupEncoder &encoder)
+        {
+            if (numBlocks <= ParallelMath::ParallelSize)
+            {
+                BlockGroup<PixelBlockU8, TOutputSize> group(pBC, pBlocks, 0, numBlocks);
+                encoder.EncodeGroup(group.GetOutput(), group.GetInput());
+                group.Commit();
+                return;
+            }
+
+            for (size_t windowBase = 0; windowBase < numBlocks; windowBase += BlockReorderWindow::kMaxBlocks)
             {
-                Internal::BC7Computer::Pack(options.flags, pBlocks + blockBase, pBC, channelWeights, encodingPlan, options.refineRoundsBC7);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockReorderWindow window(pBlocks + windowBase, Util::Min(numBlocks - windowBase, static_cast<size_t>(BlockReorderWindow::kMaxBlocks)));
+                uint8_t windowBC[BlockReorderWindow::kMaxBlocks * TOutputSize];
+
+                for (size_t blockBase = 0; blockBase < window.GetNumBlocks(); blockBase += ParallelMath::ParallelSize)
+                {
+                    BlockGroup<PixelBlockU8, TOutputSize> group(windowBC, window.GetBlocks(), blockBase, window.GetNumBlocks());
+                    encoder.EncodeGroup(group.GetOutput(), group.GetInput());
+                    group.Commit();
+                }
+
+                window.Scatter(pBC + windowBase * TOutputSize, windowBC, TOutputSize);
             }
         }
 
-        void EncodeBC6HU(uint8_t *pBC, const PixelBlockF16 *pBlocks, const cvtt::Options &options)
+        class BC7GroupEncoder
+        {
+        public:
+            BC7GroupEncoder(const cvtt::Options &options, const BC7EncodingPlan &encodingPlan)
+                : m_options(options)
+                , m_encodingPlan(encodingPlan)
+            {
+                Util::FillWeights(options, m_channelWeights);
+            }
+
+            void EncodeGroup(uint8_t *pBC, const PixelBlockU8 *pBlocks) const
+            {
+                Internal::BC7Computer::Pack(m_options.flags, pBlocks, pBC, m_channelWeights, m_encodingPlan, m_options.refineRoundsBC7, m_options.pruneToleranceBC7);
+            }
+
+        private:
+            const cvtt::Options &m_options;
+            const BC7EncodingPlan &m_encodingPlan;
+            float m_channelWeights[4];
+        };
+
+        class ETC1GroupEncoder
+        {
+        public:
+            ETC1GroupEncoder(const cvtt::Options &options, cvtt::ETC1CompressionData *compressionData)
+                : m_options(options)
+                , m_compressionData(compressionData)
+            {
+            }
+
+            void EncodeGroup(uint8_t *pBC, const PixelBlockU8 *pBlocks) const
+            {
+                Internal::ETCComputer::CompressETC1Block(pBC, pBlocks, m_compressionData, m_options);
+            }
+
+        private:
+            const cvtt::Options &m_options;
+            cvtt::ETC1CompressionData *m_compressionData;
+        };
+
+        class ETC2GroupEncoder
+        {
+        public:
+            ETC2GroupEncoder(const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData, bool punchthroughAlpha)
+                : m_options(options)
+                , m_compressionData(compressionData)
+                , m_punchthroughAlpha(punchthroughAlpha)
+            {
+            }
+
+            void EncodeGroup(uint8_t *pBC, const PixelBlockU8 *pBlocks) const
+            {
+                Internal::ETCComputer::CompressETC2Block(pBC, pBlocks, m_compressionData, m_options, m_punchthroughAlpha);
+            }
+
+        private:
+            const cvtt::Options &m_options;
+            cvtt::ETC2CompressionData *m_compressionData;
+            bool m_punchthroughAlpha;
+        };
+
+        class ETC2RGBAGroupEncoder
+        {
+        public:
+            ETC2RGBAGroupEncoder(const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+                : m_options(options)
+                , m_compressionData(compressionData)
+            {
+            }
+
+            void EncodeGroup(uint8_t *pBC, const PixelBlockU8 *pBlocks) const
+            {
+                uint8_t alphaBlockData[ParallelMath::ParallelSize * 8];
+                uint8_t colorBlockData[ParallelMath::ParallelSize * 8];
+
+                Internal::ETCComputer::CompressETC2Block(colorBlockData, pBlocks, m_compressionData, m_options, false);
+                Internal::ETCComputer::CompressETC2AlphaBlock(alphaBlockData, pBlocks, m_options);
+
+                for (size_t block = 0; block < ParallelMath::ParallelSize; block++)
+                {
+                    for (size_t blockData = 0; blockData < 8; blockData++)
+                        pBC[block * 16 + blockData] = alphaBlockData[block * 8 + blockData];
+
+                    for (size_t blockData = 0; blockData < 8; blockData++)
+                        pBC[block * 16 + 8 + blockData] = colorBlockData[block * 8 + blockData];
+                }
+            }
+
+        private:
+            const cvtt::Options &m_options;
+            cvtt::ETC2CompressionData *m_compressionData;
+        };
+
+        void EncodeBC7(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, const BC7EncodingPlan &encodingPlan)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            EncodeReordered<16>(pBC, pBlocks, numBlocks, BC7GroupEncoder(options, encodingPlan));
+        }
+
+        void EncodeBC6HU(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const cvtt::Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -61,14 +370,15 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::BC6HComputer::Pack(options.flags, pBlocks + blockBase, pBC, channelWeights, false, options.seedPoints, options.refineRoundsBC6H);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockGroup<PixelBlockF16, 16> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::BC6HComputer::Pack(options.flags, group.GetInput(), group.GetOutput(), channelWeights, false, options.seedPoints, options.refineRoundsBC6H);
+                group.Commit();
             }
         }
 
-        void EncodeBC6HS(uint8_t *pBC, const PixelBlockF16 *pBlocks, const cvtt::Options &options)
+        void EncodeBC6HS(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const cvtt::Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -76,14 +386,15 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::BC6HComputer::Pack(options.flags, pBlocks + blockBase, pBC, channelWeights, true, options.seedPoints, options.refineRoundsBC6H);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockGroup<PixelBlockF16, 16> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::BC6HComputer::Pack(options.flags, group.GetInput(), group.GetOutput(), channelWeights, true, options.seedPoints, options.refineRoundsBC6H);
+                group.Commit();
             }
         }
 
-        void EncodeBC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options)
+        void EncodeBC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -91,14 +402,15 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::S3TCComputer::PackRGB(options.flags, pBlocks + blockBase, pBC, 8, channelWeights, true, options.threshold, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
-                pBC += ParallelMath::ParallelSize * 8;
+                BlockGroup<PixelBlockU8, 8> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::S3TCComputer::PackRGB(options.flags, group.GetInput(), group.GetOutput(), 8, channelWeights, true, options.threshold, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
+                group.Commit();
             }
         }
 
-        void EncodeBC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        void EncodeBC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -106,15 +418,16 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::S3TCComputer::PackRGB(options.flags, pBlocks + blockBase, pBC + 8, 16, channelWeights, false, 1.0f, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
-                Internal::S3TCComputer::PackExplicitAlpha(options.flags, pBlocks + blockBase, 3, pBC, 16);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockGroup<PixelBlockU8, 16> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::S3TCComputer::PackRGB(options.flags, group.GetInput(), group.GetOutput() + 8, 16, channelWeights, false, 1.0f, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
+                Internal::S3TCComputer::PackExplicitAlpha(options.flags, group.GetInput(), 3, group.GetOutput(), 16);
+                group.Commit();
             }
         }
 
-        void EncodeBC3(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        void EncodeBC3(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -122,15 +435,16 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::S3TCComputer::PackRGB(options.flags, pBlocks + blockBase, pBC + 8, 16, channelWeights, false, 1.0f, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, pBlocks + blockBase, 3, pBC, 16, false, options.seedPoints, options.refineRoundsIIC);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockGroup<PixelBlockU8, 16> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::S3TCComputer::PackRGB(options.flags, group.GetInput(), group.GetOutput() + 8, 16, channelWeights, false, 1.0f, (options.flags & Flags::S3TC_Exhaustive) != 0, options.seedPoints, options.refineRoundsS3TC);
+                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, group.GetInput(), 3, group.GetOutput(), 16, false, options.seedPoints, options.refineRoundsIIC);
+                group.Commit();
             }
         }
 
-        void EncodeBC4U(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        void EncodeBC4U(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -138,14 +452,15 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, pBlocks + blockBase, 0, pBC, 8, false, options.seedPoints, options.refineRoundsIIC);
-                pBC += ParallelMath::ParallelSize * 8;
+                BlockGroup<PixelBlockU8, 8> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, group.GetInput(), 0, group.GetOutput(), 8, false, options.seedPoints, options.refineRoundsIIC);
+                group.Commit();
             }
         }
 
-        void EncodeBC4S(uint8_t *pBC, const PixelBlockS8 *pBlocks, const Options &options)
+        void EncodeBC4S(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -153,17 +468,19 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
+                BlockGroup<PixelBlockS8, 8> group(pBC, pBlocks, blockBase, numBlocks);
+
                 PixelBlockU8 inputBlocks[ParallelMath::ParallelSize];
-                Util::BiasSignedInput(inputBlocks, pBlocks + blockBase);
+                Util::BiasSignedInput(inputBlocks, group.GetInput());
 
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, inputBlocks, 0, pBC, 8, true, options.seedPoints, options.refineRoundsIIC);
-                pBC += ParallelMath::ParallelSize * 8;
+                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, inputBlocks, 0, group.GetOutput(), 8, true, options.seedPoints, options.refineRoundsIIC);
+                group.Commit();
             }
         }
 
-        void EncodeBC5U(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        void EncodeBC5U(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -171,15 +488,15 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, pBlocks + blockBase, 0, pBC, 16, false, options.seedPoints, options.refineRoundsIIC);
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, pBlocks + blockBase, 1, pBC + 8, 16, false, options.seedPoints, options.refineRoundsIIC);
-                pBC += ParallelMath::ParallelSize * 16;
+                BlockGroup<PixelBlockU8, 16> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::S3TCComputer::PackInterpolatedAlphaRG(options.flags, group.GetInput(), group.GetOutput(), 16, false, options.seedPoints, options.refineRoundsIIC);
+                group.Commit();
             }
         }
 
-        void EncodeBC5S(uint8_t *pBC, const PixelBlockS8 *pBlocks, const Options &options)
+        void EncodeBC5S(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options)
         {
             assert(pBlocks);
             assert(pBC);
@@ -187,160 +504,947 @@ namespace cvtt
             float channelWeights[4];
             Util::FillWeights(options, channelWeights);
 
-            for (size_t blockBase = 0; blockBase < NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
+                BlockGroup<PixelBlockS8, 16> group(pBC, pBlocks, blockBase, numBlocks);
+
                 PixelBlockU8 inputBlocks[ParallelMath::ParallelSize];
-                Util::BiasSignedInput(inputBlocks, pBlocks + blockBase);
+                Util::BiasSignedInput(inputBlocks, group.GetInput());
 
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, inputBlocks, 0, pBC, 16, true, options.seedPoints, options.refineRoundsIIC);
-                Internal::S3TCComputer::PackInterpolatedAlpha(options.flags, inputBlocks, 1, pBC + 8, 16, true, options.seedPoints, options.refineRoundsIIC);
-                pBC += ParallelMath::ParallelSize * 16;
+                Internal::S3TCComputer::PackInterpolatedAlphaRG(options.flags, inputBlocks, group.GetOutput(), 16, true, options.seedPoints, options.refineRoundsIIC);
+                group.Commit();
             }
         }
 
-        void EncodeETC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC1CompressionData *compressionData)
+        void EncodeETC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC1CompressionData *compressionData)
         {
             assert(pBlocks);
             assert(pBC);
 
-            float channelWeights[4];
-            Util::FillWeights(options, channelWeights);
+            EncodeReordered<8>(pBC, pBlocks, numBlocks, ETC1GroupEncoder(options, compressionData));
+        }
+
+        void EncodeETC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            EncodeReordered<8>(pBC, pBlocks, numBlocks, ETC2GroupEncoder(options, compressionData, false));
+        }
+
+        void EncodeETC2PunchthroughAlpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            EncodeReordered<8>(pBC, pBlocks, numBlocks, ETC2GroupEncoder(options, compressionData, true));
+        }
+
+        void EncodeETC2Alpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options)
+        {
+            assert(pBlocks);
+            assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::ETCComputer::CompressETC1Block(pBC, pBlocks + blockBase, compressionData, options);
-                pBC += ParallelMath::ParallelSize * 8;
+                BlockGroup<PixelBlockU8, 8> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::ETCComputer::CompressETC2AlphaBlock(group.GetOutput(), group.GetInput(), options);
+                group.Commit();
             }
         }
 
-        void EncodeETC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        void EncodeETC2Alpha11(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, size_t numBlocks, bool isSigned, const cvtt::Options &options)
         {
             assert(pBlocks);
             assert(pBC);
 
-            float channelWeights[4];
-            Util::FillWeights(options, channelWeights);
-
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::ETCComputer::CompressETC2Block(pBC, pBlocks + blockBase, compressionData, options, false);
-                pBC += ParallelMath::ParallelSize * 8;
+                BlockGroup<PixelBlockScalarS16, 8> group(pBC, pBlocks, blockBase, numBlocks);
+                Internal::ETCComputer::CompressEACBlock(group.GetOutput(), group.GetInput(), isSigned, options);
+                group.Commit();
             }
         }
 
-        void EncodeETC2PunchthroughAlpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        void EncodeETC2RGBA(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
         {
             assert(pBlocks);
             assert(pBC);
 
-            float channelWeights[4];
-            Util::FillWeights(options, channelWeights);
+            EncodeReordered<16>(pBC, pBlocks, numBlocks, ETC2RGBAGroupEncoder(options, compressionData));
+        }
+
+        ETC1CompressionData *AllocETC1Data(Kernels::allocFunc_t allocFunc, void *context)
+        {
+            return cvtt::Internal::ETCComputer::AllocETC1Data(allocFunc, context);
+        }
+
+        void DecodeBC1(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            assert(pBlocks);
+            assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::ETCComputer::CompressETC2Block(pBC, pBlocks + blockBase, compressionData, options, true);
-                pBC += ParallelMath::ParallelSize * 8;
+                UnpackGroup<PixelBlockU8, 8> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 pixels[16][4];
+                Internal::S3TCComputer::UnpackRGB(group.GetInput(), 8, true, pixels);
+
+                for (int px = 0; px < 16; px++)
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixels[px]);
+
+                group.Commit();
             }
         }
 
-        void EncodeETC2Alpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options)
+        void DecodeBC2(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
         {
             assert(pBlocks);
             assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::ETCComputer::CompressETC2AlphaBlock(pBC, pBlocks + blockBase, options);
-                pBC += ParallelMath::ParallelSize * 8;
+                UnpackGroup<PixelBlockU8, 16> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 pixels[16][4];
+                ParallelMath::UInt15 alpha[16];
+                Internal::S3TCComputer::UnpackRGB(group.GetInput() + 8, 16, false, pixels);
+                Internal::S3TCComputer::UnpackExplicitAlpha(group.GetInput(), 16, alpha);
+
+                for (int px = 0; px < 16; px++)
+                {
+                    pixels[px][3] = alpha[px];
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixels[px]);
+                }
+
+                group.Commit();
             }
         }
 
-        void EncodeETC2Alpha11(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, bool isSigned, const cvtt::Options &options)
+        void DecodeBC3(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
         {
             assert(pBlocks);
             assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase += ParallelMath::ParallelSize)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::ETCComputer::CompressEACBlock(pBC, pBlocks + blockBase, isSigned, options);
-                pBC += ParallelMath::ParallelSize * 8;
+                UnpackGroup<PixelBlockU8, 16> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 pixels[16][4];
+                ParallelMath::UInt15 alpha[16];
+                Internal::S3TCComputer::UnpackRGB(group.GetInput() + 8, 16, false, pixels);
+                Internal::S3TCComputer::UnpackInterpolatedAlpha(group.GetInput(), 16, false, alpha);
+
+                for (int px = 0; px < 16; px++)
+                {
+                    pixels[px][3] = alpha[px];
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixels[px]);
+                }
+
+                group.Commit();
             }
         }
 
-        void EncodeETC2RGBA(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        // Decodes 1 or 2 interpolated channels to red and green.  Blue is 0 and alpha is opaque.
+        template<class TBlock, size_t TInputSize>
+        void DecodeInterpolatedChannels(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks, int numChannels, bool isSigned)
         {
-            uint8_t alphaBlockData[cvtt::NumParallelBlocks * 8];
-            uint8_t colorBlockData[cvtt::NumParallelBlocks * 8];
+            assert(pBlocks);
+            assert(pBC);
 
-            EncodeETC2(colorBlockData, pBlocks, options, compressionData);
-            EncodeETC2Alpha(alphaBlockData, pBlocks, options);
+            // Signed values are biased by 127 and need to be converted to two's complement bytes
+            const uint16_t toOutputOffset = isSigned ? 129 : 0;
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase++)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                for (size_t blockData = 0; blockData < 8; blockData++)
-                    pBC[blockBase * 16 + blockData] = alphaBlockData[blockBase * 8 + blockData];
-
-                for (size_t blockData = 0; blockData < 8; blockData++)
-                    pBC[blockBase * 16 + 8 + blockData] = colorBlockData[blockBase * 8 + blockData];
+                UnpackGroup<TBlock, TInputSize> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 channels[2][16];
+                for (int ch = 0; ch < 2; ch++)
+                {
+                    if (ch < numChannels)
+                        Internal::S3TCComputer::UnpackInterpolatedAlpha(group.GetInput() + ch * 8, TInputSize, isSigned, channels[ch]);
+                    else
+                    {
+                        for (int px = 0; px < 16; px++)
+                            channels[ch][px] = ParallelMath::MakeUInt15(isSigned ? 127 : 0);
+                    }
+                }
+
+                for (int px = 0; px < 16; px++)
+                {
+                    ParallelMath::UInt15 pixel[4];
+                    for (int ch = 0; ch < 2; ch++)
+                        pixel[ch] = (channels[ch][px] + ParallelMath::MakeUInt15(toOutputOffset)) & ParallelMath::MakeUInt15(255);
+
+                    pixel[2] = ParallelMath::MakeUInt15(0);
+                    pixel[3] = ParallelMath::MakeUInt15(isSigned ? 127 : 255);
+
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixel);
+                }
+
+                group.Commit();
             }
         }
 
-        void DecodeBC7(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        void DecodeBC4U(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeInterpolatedChannels<PixelBlockU8, 8>(pBlocks, pBC, numBlocks, 1, false);
+        }
+
+        void DecodeBC4S(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeInterpolatedChannels<PixelBlockS8, 8>(pBlocks, pBC, numBlocks, 1, true);
+        }
+
+        void DecodeBC5U(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeInterpolatedChannels<PixelBlockU8, 16>(pBlocks, pBC, numBlocks, 2, false);
+        }
+
+        void DecodeBC5S(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeInterpolatedChannels<PixelBlockS8, 16>(pBlocks, pBC, numBlocks, 2, true);
+        }
+
+        void DecodeETC2Color(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks, bool punchthroughAlpha)
         {
             assert(pBlocks);
             assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase++)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::BC7Computer::UnpackOne(pBlocks[blockBase], pBC);
-                pBC += 16;
+                UnpackGroup<PixelBlockU8, 8> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 pixels[16][4];
+                Internal::ETCComputer::UnpackColor(group.GetInput(), 8, punchthroughAlpha, pixels);
+
+                for (int px = 0; px < 16; px++)
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixels[px]);
+
+                group.Commit();
             }
         }
 
-        void DecodeBC6HU(PixelBlockF16 *pBlocks, const uint8_t *pBC)
+        void DecodeETC2(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeETC2Color(pBlocks, pBC, numBlocks, false);
+        }
+
+        void DecodeETC2PunchthroughAlpha(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            DecodeETC2Color(pBlocks, pBC, numBlocks, true);
+        }
+
+        void DecodeETC2RGBA(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
         {
             assert(pBlocks);
             assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase++)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::BC6HComputer::UnpackOne(pBlocks[blockBase], pBC, false);
-                pBC += 16;
+                UnpackGroup<PixelBlockU8, 16> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 pixels[16][4];
+                ParallelMath::UInt15 alpha[16];
+                Internal::ETCComputer::UnpackColor(group.GetInput() + 8, 16, false, pixels);
+                Internal::ETCComputer::UnpackAlpha(group.GetInput(), 16, false, false, alpha);
+
+                for (int px = 0; px < 16; px++)
+                {
+                    pixels[px][3] = alpha[px];
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixels[px]);
+                }
+
+                group.Commit();
             }
         }
 
-        void DecodeBC6HS(PixelBlockF16 *pBlocks, const uint8_t *pBC)
+        void DecodeETC2Alpha(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
         {
             assert(pBlocks);
             assert(pBC);
 
-            for (size_t blockBase = 0; blockBase < cvtt::NumParallelBlocks; blockBase++)
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
             {
-                Internal::BC6HComputer::UnpackOne(pBlocks[blockBase], pBC, true);
-                pBC += 16;
+                UnpackGroup<PixelBlockU8, 8> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 alpha[16];
+                Internal::ETCComputer::UnpackAlpha(group.GetInput(), 8, false, false, alpha);
+
+                for (int px = 0; px < 16; px++)
+                {
+                    ParallelMath::UInt15 pixel[4];
+                    for (int ch = 0; ch < 3; ch++)
+                        pixel[ch] = ParallelMath::MakeUInt15(0);
+                    pixel[3] = alpha[px];
+
+                    ParallelMath::ConvertLDROutputs(group.GetOutput(), px, pixel);
+                }
+
+                group.Commit();
             }
         }
 
-        ETC1CompressionData *AllocETC1Data(allocFunc_t allocFunc, void *context)
+        // Decodes one channel of 11-bit EAC blocks, which are TInputSize bytes apart
+        template<size_t TInputSize>
+        void DecodeEAC11Channel(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t channelOffset, size_t numBlocks, bool isSigned)
         {
-            return cvtt::Internal::ETCComputer::AllocETC1Data(allocFunc, context);
+            const ParallelMath::ScalarUInt16 bias = isSigned ? 1023 : 0;
+
+            for (size_t blockBase = 0; blockBase < numBlocks; blockBase += ParallelMath::ParallelSize)
+            {
+                UnpackGroup<PixelBlockScalarS16, TInputSize> group(pBlocks, pBC, blockBase, numBlocks);
+
+                ParallelMath::UInt15 values[16];
+                Internal::ETCComputer::UnpackAlpha(group.GetInput() + channelOffset, TInputSize, true, isSigned, values);
+
+                PixelBlockScalarS16 *outputBlocks = group.GetOutput();
+                for (int px = 0; px < 16; px++)
+                {
+                    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+                        outputBlocks[block].m_pixels[px] = static_cast<int16_t>(ParallelMath::Extract(values[px], block) - bias);
+                }
+
+                group.Commit();
+            }
         }
 
-        void ReleaseETC1Data(ETC1CompressionData *compressionData, freeFunc_t freeFunc)
+        void DecodeETC2Alpha11(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned)
         {
-            cvtt::Internal::ETCComputer::ReleaseETC1Data(compressionData, freeFunc);
+            assert(pBlocks);
+            assert(pBC);
+
+            DecodeEAC11Channel<8>(pBlocks, pBC, 0, numBlocks, isSigned);
         }
 
-        ETC2CompressionData *AllocETC2Data(allocFunc_t allocFunc, void *context, const cvtt::Options &options)
+        void DecodeETC2RG11(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned)
         {
-            return cvtt::Internal::ETCComputer::AllocETC2Data(allocFunc, context, options);
+            assert(pRedBlocks);
+            assert(pGreenBlocks);
+            assert(pBC);
+
+            DecodeEAC11Channel<16>(pRedBlocks, pBC, 0, numBlocks, isSigned);
+            DecodeEAC11Channel<16>(pGreenBlocks, pBC, 8, numBlocks, isSigned);
         }
 
-        void ReleaseETC2Data(ETC2CompressionData *compressionData, freeFunc_t freeFunc)
+        // BC6H and BC7 fields are laid out differently in each mode, so each SIMD group is decoded with a single mode.  Batches are
+        // split into windows of a few dozen groups, and the blocks in each window are sorted by mode.  TGroupDecoder::GetMode
+        // returns -1 for blocks with no valid mode, which are decoded with TGroupDecoder::DecodeInvalid.
+        template<class TBlock, class TGroupDecoder>
+        void DecodeSortedByMode(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks, const TGroupDecoder &decoder)
         {
-            cvtt::Internal::ETCComputer::ReleaseETC2Data(compressionData, freeFunc);
+            static const size_t kWindowSize = ParallelMath::ParallelSize * 32;
+            static const int kNumModes = TGroupDecoder::kNumModes;
+
+            for (size_t windowBase = 0; windowBase < numBlocks; windowBase += kWindowSize)
+            {
+                const size_t windowSize = Util::Min(kWindowSize, numBlocks - windowBase);
+                const uint8_t *windowBC = pBC + windowBase * 16;
+                TBlock *windowBlocks = pBlocks + windowBase;
+
+                // Invalid blocks are sorted after the last mode
+                uint8_t blockModes[kWindowSize];
+                size_t modeStarts[kNumModes + 2];
+                uint16_t order[kWindowSize];
+
+                for (int mode = 0; mode < kNumModes + 2; mode++)
+                    modeStarts[mode] = 0;
+
+                for (size_t block = 0; block < windowSize; block++)
+                {
+                    int mode = decoder.GetMode(windowBC + block * 16);
+                    if (mode < 0)
+                        mode = kNumModes;
+
+                    blockModes[block] = static_cast<uint8_t>(mode);
+                    modeStarts[mode + 1]++;
+                }
+
+                for (int mode = 0; mode < kNumModes; mode++)
+                    modeStarts[mode + 1] += modeStarts[mode];
+
+                size_t modeEnds[kNumModes + 1];
+                for (int mode = 0; mode <= kNumModes; mode++)
+                    modeEnds[mode] = modeStarts[mode];
+
+                for (size_t block = 0; block < windowSize; block++)
+                    order[modeEnds[blockModes[block]]++] = static_cast<uint16_t>(block);
+
+                for (size_t sortedIndex = modeStarts[kNumModes]; sortedIndex < windowSize; sortedIndex++)
+                    decoder.DecodeInvalid(windowBlocks[order[sortedIndex]]);
+
+                for (int mode = 0; mode < kNumModes; mode++)
+                {
+                    for (size_t groupBase = modeStarts[mode]; groupBase < modeEnds[mode]; groupBase += ParallelMath::ParallelSize)
+                    {
+                        const size_t groupSize = Util::Min<size_t>(ParallelMath::ParallelSize, modeEnds[mode] - groupBase);
+
+                        uint8_t groupInput[ParallelMath::ParallelSize * 16];
+                        for (size_t block = 0; block < ParallelMath::ParallelSize; block++)
+                            memcpy(groupInput + block * 16, windowBC + order[groupBase + Util::Min(block, groupSize - 1)] * 16, 16);
+
+                        TBlock groupOutput[ParallelMath::ParallelSize];
+                        decoder.DecodeGroup(mode, groupOutput, groupInput);
+
+                        for (size_t block = 0; block < groupSize; block++)
+                            windowBlocks[order[groupBase + block]] = groupOutput[block];
+                    }
+                }
+            }
         }
-    }
-}
+
+        class BC6HGroupDecoder
+        {
+        public:
+            static const int kNumModes = 14;
+
+            explicit BC6HGroupDecoder(bool isSigned)
+                : m_isSigned(isSigned)
+            {
+            }
+
+            int GetMode(const uint8_t *pBC) const
+            {
+                return Internal::BC6HComputer::GetModeIndex(pBC);
+            }
+
+            void DecodeGroup(int mode, PixelBlockF16 *pBlocks, const uint8_t *pBC) const
+            {
+                ParallelMath::SInt16 pixels[16][3];
+                Internal::BC6HComputer::UnpackMode(mode, pBC, m_isSigned, pixels);
+
+                for (int px = 0; px < 16; px++)
+                {
+                    for (int ch = 0; ch < 3; ch++)
+                        ParallelMath::ConvertHDROutputs(pBlocks, px, ch, pixels[px][ch]);
+
+                    ParallelMath::ConvertHDROutputs(pBlocks, px, 3, ParallelMath::MakeSInt16(0x3c00));
+                }
+            }
+
+            void DecodeInvalid(PixelBlockF16 &block) const
+            {
+                for (int px = 0; px < 16; px++)
+                {
+                    for (int ch = 0; ch < 3; ch++)
+                        block.m_pixels[px][ch] = 0;
+                    block.m_pixels[px][3] = 0x3c00;    // 1.0
+                }
+            }
+
+        private:
+            bool m_isSigned;
+        };
+
+        class BC7GroupDecoder
+        {
+        public:
+            static const int kNumModes = 8;
+
+            int GetMode(const uint8_t *pBC) const
+            {
+                return Internal::BC7Computer::GetMode(pBC);
+            }
+
+            void DecodeGroup(int mode, PixelBlockU8 *pBlocks, const uint8_t *pBC) const
+            {
+                ParallelMath::UInt15 pixels[16][4];
+                Internal::BC7Computer::UnpackMode(mode, pBC, pixels);
+
+                for (int px = 0; px < 16; px++)
+                    ParallelMath::ConvertLDROutputs(pBlocks, px, pixels[px]);
+            }
+
+            void DecodeInvalid(PixelBlockU8 &block) const
+            {
+                memset(&block, 0, sizeof(block));
+            }
+        };
+
+        void DecodeBC6HU(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            DecodeSortedByMode(pBlocks, pBC, numBlocks, BC6HGroupDecoder(false));
+        }
+
+        void DecodeBC6HS(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            DecodeSortedByMode(pBlocks, pBC, numBlocks, BC6HGroupDecoder(true));
+        }
+
+        void DecodeBC7(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            assert(pBlocks);
+            assert(pBC);
+
+            DecodeSortedByMode(pBlocks, pBC, numBlocks, BC7GroupDecoder());
+        }
+
+        void ReleaseETC1Data(ETC1CompressionData *compressionData, Kernels::freeFunc_t freeFunc)
+        {
+            cvtt::Internal::ETCComputer::ReleaseETC1Data(compressionData, freeFunc);
+        }
+
+        ETC2CompressionData *AllocETC2Data(Kernels::allocFunc_t allocFunc, void *context, const cvtt::Options &options)
+        {
+            return cvtt::Internal::ETCComputer::AllocETC2Data(allocFunc, context, options);
+        }
+
+        void ReleaseETC2Data(ETC2CompressionData *compressionData, Kernels::freeFunc_t freeFunc)
+        {
+            cvtt::Internal::ETCComputer::ReleaseETC2Data(compressionData, freeFunc);
+        }
+    }
+    CVTT_ISA_NAMESPACE_END
+}
+
+#if !defined(CVTT_USE_RUNTIME_DISPATCH)
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetCompiledKernelSet()
+#elif defined(CVTT_USE_AVX512)
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSetAVX512()
+#elif defined(CVTT_USE_AVX2)
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSetAVX2()
+#elif defined(CVTT_USE_SSE41)
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSetSSE41()
+#else
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSetSSE2()
+#endif
+{
+    static const KernelSet kernelSet =
+    {
+        &EntryPoints::EncodeBC1,
+        &EntryPoints::EncodeBC2,
+        &EntryPoints::EncodeBC3,
+        &EntryPoints::EncodeBC4U,
+        &EntryPoints::EncodeBC4S,
+        &EntryPoints::EncodeBC5U,
+        &EntryPoints::EncodeBC5S,
+        &EntryPoints::EncodeBC6HU,
+        &EntryPoints::EncodeBC6HS,
+        &EntryPoints::EncodeBC7,
+        &EntryPoints::EncodeETC1,
+        &EntryPoints::EncodeETC2,
+        &EntryPoints::EncodeETC2RGBA,
+        &EntryPoints::EncodeETC2PunchthroughAlpha,
+        &EntryPoints::EncodeETC2Alpha,
+        &EntryPoints::EncodeETC2Alpha11,
+        &EntryPoints::DecodeBC1,
+        &EntryPoints::DecodeBC2,
+        &EntryPoints::DecodeBC3,
+        &EntryPoints::DecodeBC4U,
+        &EntryPoints::DecodeBC4S,
+        &EntryPoints::DecodeBC5U,
+        &EntryPoints::DecodeBC5S,
+        &EntryPoints::DecodeETC2,
+        &EntryPoints::DecodeETC2RGBA,
+        &EntryPoints::DecodeETC2PunchthroughAlpha,
+        &EntryPoints::DecodeETC2Alpha,
+        &EntryPoints::DecodeETC2Alpha11,
+        &EntryPoints::DecodeETC2RG11,
+        &EntryPoints::DecodeBC6HU,
+        &EntryPoints::DecodeBC6HS,
+        &EntryPoints::DecodeBC7,
+        &EntryPoints::AllocETC1Data,
+        &EntryPoints::ReleaseETC1Data,
+        &EntryPoints::AllocETC2Data,
+        &EntryPoints::ReleaseETC2Data
+    };
+
+    return kernelSet;
+}
+
+#if !defined(CVTT_DISPATCH_ISA_IMPL)
+
+namespace cvtt
+{
+    // Defined here rather than inline so that the ISA-specific encoders don't emit their own copies
+    ETC2CompressionData::ETC2CompressionData()
+    {
+    }
+
+    ETC1CompressionData::ETC1CompressionData()
+    {
+    }
+
+    namespace Kernels
+    {
+        void EncodeBC7(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, const BC7EncodingPlan &encodingPlan)
+        {
+            Dispatch::GetKernelSet().m_encodeBC7(pBC, pBlocks, NumParallelBlocks, options, encodingPlan);
+
+            if (options.stats)
+                AddBC7EncodingStats(*options.stats, pBC, NumParallelBlocks);
+        }
+
+        void EncodeBC7Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, const BC7EncodingPlan &encodingPlan)
+        {
+            Dispatch::GetKernelSet().m_encodeBC7(pBC, pBlocks, numBlocks, options, encodingPlan);
+
+            if (options.stats)
+                AddBC7EncodingStats(*options.stats, pBC, numBlocks);
+        }
+
+        void EncodeBC6HU(uint8_t *pBC, const PixelBlockF16 *pBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC6HU(pBC, pBlocks, NumParallelBlocks, options);
+
+            if (options.stats)
+                AddBC6HEncodingStats(*options.stats, pBC, NumParallelBlocks);
+        }
+
+        void EncodeBC6HUBatch(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC6HU(pBC, pBlocks, numBlocks, options);
+
+            if (options.stats)
+                AddBC6HEncodingStats(*options.stats, pBC, numBlocks);
+        }
+
+        void EncodeBC6HS(uint8_t *pBC, const PixelBlockF16 *pBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC6HS(pBC, pBlocks, NumParallelBlocks, options);
+
+            if (options.stats)
+                AddBC6HEncodingStats(*options.stats, pBC, NumParallelBlocks);
+        }
+
+        void EncodeBC6HSBatch(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC6HS(pBC, pBlocks, numBlocks, options);
+
+            if (options.stats)
+                AddBC6HEncodingStats(*options.stats, pBC, numBlocks);
+        }
+
+        void EncodeBC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC1(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC1Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC1(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC2(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC2Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC2(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC3(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC3(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC3Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC3(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC4U(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC4U(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC4UBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC4U(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC4S(uint8_t *pBC, const PixelBlockS8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC4S(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC4SBatch(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC4S(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC5U(uint8_t *pBC, const PixelBlockU8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC5U(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC5UBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC5U(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeBC5S(uint8_t *pBC, const PixelBlockS8 *pBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC5S(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeBC5SBatch(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeBC5S(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeETC1(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC1CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC1(pBC, pBlocks, NumParallelBlocks, options, compressionData);
+        }
+
+        void EncodeETC1Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC1CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC1(pBC, pBlocks, numBlocks, options, compressionData);
+        }
+
+        void EncodeETC2(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2(pBC, pBlocks, NumParallelBlocks, options, compressionData);
+        }
+
+        void EncodeETC2Batch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2(pBC, pBlocks, numBlocks, options, compressionData);
+        }
+
+        void EncodeETC2PunchthroughAlpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2PunchthroughAlpha(pBC, pBlocks, NumParallelBlocks, options, compressionData);
+        }
+
+        void EncodeETC2PunchthroughAlphaBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2PunchthroughAlpha(pBC, pBlocks, numBlocks, options, compressionData);
+        }
+
+        void EncodeETC2Alpha(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2Alpha(pBC, pBlocks, NumParallelBlocks, options);
+        }
+
+        void EncodeETC2AlphaBatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2Alpha(pBC, pBlocks, numBlocks, options);
+        }
+
+        void EncodeETC2Alpha11(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, bool isSigned, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2Alpha11(pBC, pBlocks, NumParallelBlocks, isSigned, options);
+        }
+
+        void EncodeETC2Alpha11Batch(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, size_t numBlocks, bool isSigned, const cvtt::Options &options)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2Alpha11(pBC, pBlocks, numBlocks, isSigned, options);
+        }
+
+        void EncodeETC2RGBA(uint8_t *pBC, const PixelBlockU8 *pBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2RGBA(pBC, pBlocks, NumParallelBlocks, options, compressionData);
+        }
+
+        void EncodeETC2RGBABatch(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const cvtt::Options &options, cvtt::ETC2CompressionData *compressionData)
+        {
+            Dispatch::GetKernelSet().m_encodeETC2RGBA(pBC, pBlocks, numBlocks, options, compressionData);
+        }
+
+        void DecodeBC1(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC1(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC1Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC1(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC2(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC2(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC2Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC2(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC3(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC3(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC3Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC3(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC4U(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC4U(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC4UBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC4U(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC4S(PixelBlockS8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC4S(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC4SBatch(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC4S(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC5U(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC5U(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC5UBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC5U(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC5S(PixelBlockS8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC5S(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC5SBatch(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC5S(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC1(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeETC1Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC2(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeETC2Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC2RGBA(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2RGBA(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeETC2RGBABatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2RGBA(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC2PunchthroughAlpha(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2PunchthroughAlpha(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeETC2PunchthroughAlphaBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2PunchthroughAlpha(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC2Alpha(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2Alpha(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeETC2AlphaBatch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2Alpha(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeETC2Alpha11(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, bool isSigned)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2Alpha11(pBlocks, pBC, NumParallelBlocks, isSigned);
+        }
+
+        void DecodeETC2Alpha11Batch(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2Alpha11(pBlocks, pBC, numBlocks, isSigned);
+        }
+
+        void DecodeETC2RG11(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, bool isSigned)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2RG11(pRedBlocks, pGreenBlocks, pBC, NumParallelBlocks, isSigned);
+        }
+
+        void DecodeETC2RG11Batch(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned)
+        {
+            Dispatch::GetKernelSet().m_decodeETC2RG11(pRedBlocks, pGreenBlocks, pBC, numBlocks, isSigned);
+        }
+
+        void DecodeBC6HU(PixelBlockF16 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC6HU(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC6HUBatch(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC6HU(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC6HS(PixelBlockF16 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC6HS(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC6HSBatch(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC6HS(pBlocks, pBC, numBlocks);
+        }
+
+        void DecodeBC7(PixelBlockU8 *pBlocks, const uint8_t *pBC)
+        {
+            Dispatch::GetKernelSet().m_decodeBC7(pBlocks, pBC, NumParallelBlocks);
+        }
+
+        void DecodeBC7Batch(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+        {
+            Dispatch::GetKernelSet().m_decodeBC7(pBlocks, pBC, numBlocks);
+        }
+
+        ETC1CompressionData *AllocETC1Data(allocFunc_t allocFunc, void *context)
+        {
+            return Dispatch::GetKernelSet().m_allocETC1Data(allocFunc, context);
+        }
+
+        void ReleaseETC1Data(ETC1CompressionData *compressionData, freeFunc_t freeFunc)
+        {
+            Dispatch::GetKernelSet().m_releaseETC1Data(compressionData, freeFunc);
+        }
+
+        ETC2CompressionData *AllocETC2Data(allocFunc_t allocFunc, void *context, const cvtt::Options &options)
+        {
+            return Dispatch::GetKernelSet().m_allocETC2Data(allocFunc, context, options);
+        }
+
+        void ReleaseETC2Data(ETC2CompressionData *compressionData, freeFunc_t freeFunc)
+        {
+            Dispatch::GetKernelSet().m_releaseETC2Data(compressionData, freeFunc);
+        }
+    }
+}
+
+#endif
 
 #endif
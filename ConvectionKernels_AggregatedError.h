@@ -6,6 +6,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         template<int TVectorSize>
@@ -49,6 +50,7 @@ namespace cvtt
             MUInt31 m_errorUnweighted[TVectorSize];
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
@@ -44,11 +44,18 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 #include "ConvectionKernels_EndpointRefiner.h"
 #include "ConvectionKernels_EndpointSelector.h"
 #include "ConvectionKernels_IndexSelectorHDR.h"
+#include "ConvectionKernels_Instrumentation.h"
 #include "ConvectionKernels_ParallelMath.h"
 #include "ConvectionKernels_UnfinishedEndpoints.h"
+#include "ConvectionKernels_Util.h"
+
+#if !defined(CVTT_NO_PRECOMPUTED_BC7_PLANS)
+#include "ConvectionKernels_BC7_QualityPlans.h"
+#endif
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         namespace BC67
@@ -73,6 +80,10 @@ namespace cvtt
                         MUInt15 m_rotation;
                     } m_isr;
                 } m_u;
+
+#if defined(CVTT_ENABLE_INSTRUMENTATION)
+                BC7InstrumentationStats *m_stats;
+#endif
             };
         }
 
@@ -105,7 +116,7 @@ namespace cvtt
                 bool m_hasIndexSelector;
             };
 
-            BC7ModeInfo g_modes[] =
+            const BC7ModeInfo g_modes[] =
             {
                 { PBitMode_PerEndpoint, AlphaMode_None, 4, 0, 4, 3, 3, 0, false },     // 0
                 { PBitMode_PerSubset, AlphaMode_None, 6, 0, 6, 2, 3, 0, false },       // 1
@@ -148,7 +159,7 @@ namespace cvtt
                 { false, false, false, false, false, false, true,  true,  true,  true,  true,  true,  false, false, false, false, false },
             };
 
-            BC6HModeInfo g_hdrModes[] =
+            const BC6HModeInfo g_hdrModes[] =
             {
                 { 0x00, true,  true,  10,{ 5, 5, 5 } },
                 { 0x01, true,  true,  7,{ 6, 6, 6 } },
@@ -664,6 +675,9 @@ namespace cvtt
 
             void InitPacked(const uint32_t *v, int bits)
             {
+                for (int i = 0; i < 4; i++)
+                    m_vector[i] = 0;
+
                 for (int b = 0; b < bits; b += 32)
                     m_vector[b / 32] = v[b / 32];
 
@@ -697,6 +711,54 @@ namespace cvtt
             }
         };
 
+        // Packs the same field layout into every block of a group at once
+        struct ParallelPackingVector
+        {
+            ParallelMath::UInt16 m_words[8];
+            int m_offset;
+
+            void Init()
+            {
+                for (int i = 0; i < 8; i++)
+                    m_words[i] = ParallelMath::MakeUInt16(0);
+
+                m_offset = 0;
+            }
+
+            inline void Pack(const ParallelMath::UInt16 &value, int bits)
+            {
+                int wOffset = m_offset >> 4;
+                int bitOffset = m_offset & 0xf;
+
+                m_words[wOffset] = m_words[wOffset] | (value << bitOffset);
+
+                int overflowBits = bitOffset + bits - 16;
+                if (overflowBits > 0)
+                    m_words[wOffset + 1] = m_words[wOffset + 1] | ParallelMath::RightShift(value, bits - overflowBits);
+
+                m_offset += bits;
+            }
+
+            // Writes ParallelSize consecutive 16-byte blocks
+            inline void Flush(uint8_t* output) const
+            {
+                assert(m_offset == 128);
+
+                uint16_t chunks[8][ParallelMath::ParallelSize];
+                for (int w = 0; w < 8; w++)
+                    ParallelMath::StoreUInt16(chunks[w], m_words[w]);
+
+                for (int block = 0; block < ParallelMath::ParallelSize; block++)
+                {
+                    for (int w = 0; w < 8; w++)
+                    {
+                        output[block * 16 + w * 2] = static_cast<uint8_t>(chunks[w][block] & 0xff);
+                        output[block * 16 + w * 2 + 1] = static_cast<uint8_t>((chunks[w][block] >> 8) & 0xff);
+                    }
+                }
+            }
+        };
+
 
         struct UnpackingVector
         {
@@ -752,6 +814,54 @@ namespace cvtt
             }
         };
 
+        // Random-access reader for the fields of one 128-bit block
+        struct BlockBitReader
+        {
+            uint64_t m_low;
+            uint64_t m_high;
+
+            void Init(const uint8_t *bytes)
+            {
+                m_low = 0;
+                m_high = 0;
+
+                for (int b = 0; b < 8; b++)
+                {
+                    m_low |= static_cast<uint64_t>(bytes[b]) << (b * 8);
+                    m_high |= static_cast<uint64_t>(bytes[b + 8]) << (b * 8);
+                }
+            }
+
+            inline uint64_t Read(int offset, int bits) const
+            {
+                assert(bits > 0 && bits < 64);
+                assert(offset + bits <= 128);
+
+                uint64_t v;
+                if (offset >= 64)
+                    v = m_high >> (offset - 64);
+                else if (offset == 0)
+                    v = m_low;
+                else
+                    v = (m_low >> offset) | (m_high << (64 - offset));
+
+                return v & ((static_cast<uint64_t>(1) << bits) - 1);
+            }
+        };
+
+        // Inserts a 0 bit at a bit position, moving the higher bits up
+        inline uint64_t InsertZeroBit(uint64_t bits, int position)
+        {
+            const uint64_t lowMask = (static_cast<uint64_t>(1) << position) - 1;
+            return (bits & lowMask) | ((bits & ~lowMask) << 1);
+        }
+
+        inline ParallelMath::Int16CompFlag IsMaskBitSet(const ParallelMath::UInt16 &mask, int bit)
+        {
+            ParallelMath::UInt15 maskBit = ParallelMath::ToUInt15(ParallelMath::RightShift(mask, bit) & ParallelMath::MakeUInt16(1));
+            return ParallelMath::Equal(maskBit, ParallelMath::MakeUInt15(1));
+        }
+
         ParallelMath::Float ScaleHDRValue(const ParallelMath::Float &v, bool isSigned)
         {
             if (isSigned)
@@ -808,8 +918,13 @@ namespace cvtt
             ParallelMath::UInt15 fragmentBestIndexes[BC7Data::g_numFragments];
             ParallelMath::UInt15 shapeBestEP[BC7Data::g_numShapesAll][2][4];
             ParallelMath::Float shapeBestError[BC7Data::g_numShapesAll];
+
+            // Only used with BC7_PruneShapes
+            ParallelMath::Float shapeResidualRGB[BC7Data::g_numShapesAll];
+            ParallelMath::Float shapeResidualRGBA[BC7Data::g_numShapes12];
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 void cvtt::Internal::BC7Computer::TweakAlpha(const MUInt15 original[2], int tweak, int range, MUInt15 result[2])
@@ -995,7 +1110,7 @@ void cvtt::Internal::BC7Computer::TrySingleColorRGBAMultiTable(uint32_t flags, c
         }
 
         ParallelMath::Int16CompFlag better = ParallelMath::FloatFlagToInt16(ParallelMath::Less(avgError, bestAverageError));
-        better = ParallelMath::AndNot(pti, better); // Mask out punch-through invalidations
+        better = ParallelMath::AndNot(better, pti); // Mask out punch-through invalidations
 
         if (ParallelMath::AnySet(better))
         {
@@ -1039,7 +1154,7 @@ void cvtt::Internal::BC7Computer::TrySingleColorRGBAMultiTable(uint32_t flags, c
     }
 }
 
-void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, BC67::WorkInfo& work, const ParallelMath::RoundTowardNearestForScope *rtn)
+void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, float pruneTolerance, BC67::WorkInfo& work, const ParallelMath::RoundTowardNearestForScope *rtn)
 {
     if (numRefineRounds < 1)
         numRefineRounds = 1;
@@ -1051,6 +1166,9 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
 
     SinglePlaneTemporaries temps;
 
+    const bool pruneShapes = ((flags & Flags::BC7_PruneShapes) != 0);
+    const MFloat pruneScale = ParallelMath::MakeFloat(1.0f + pruneTolerance);
+
     MUInt15 maxAlpha = ParallelMath::MakeUInt15(0);
     MUInt15 minAlpha = ParallelMath::MakeUInt15(255);
     ParallelMath::Int16CompFlag isPunchThrough = ParallelMath::MakeBoolInt16(true);
@@ -1065,13 +1183,17 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
 
     ParallelMath::Int16CompFlag blockHasNonMaxAlpha = ParallelMath::Less(minAlpha, ParallelMath::MakeUInt15(255));
     ParallelMath::Int16CompFlag blockHasNonZeroAlpha = ParallelMath::Less(ParallelMath::MakeUInt15(0), maxAlpha);
+    ParallelMath::Int16CompFlag blockIsOpaque = ParallelMath::Not(blockHasNonMaxAlpha);
 
     bool anyBlockHasAlpha = ParallelMath::AnySet(blockHasNonMaxAlpha);
+    bool anyBlockIsOpaque = ParallelMath::AnySet(blockIsOpaque);
 
-    // Try RGB modes if any block has a min alpha 251 or higher
-    bool allowRGBModes = ParallelMath::AnySet(ParallelMath::Less(ParallelMath::MakeUInt15(250), minAlpha));
+    // Try RGB modes on blocks with a min alpha 251 or higher.
+    // Every mode decision below is masked per block, so a block's result doesn't depend on the other blocks in its group.
+    ParallelMath::Int16CompFlag blockAllowsRGBModes = ParallelMath::Less(ParallelMath::MakeUInt15(250), minAlpha);
+    bool allowRGBModes = ParallelMath::AnySet(blockAllowsRGBModes);
 
-    // Try mode 7 if any block has alpha.
+    // Try mode 7 on blocks with alpha.
     // Mode 7 is almost never selected for RGB blocks because mode 4 has very accurate 7.7.7.1 endpoints
     // and its parity bit doesn't affect alpha, meaning mode 7 can only be better in extremely specific
     // situations, and only by at most 1 unit of error per pixel.
@@ -1081,6 +1203,24 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
 
     BCCommon::PreWeightPixelsLDR<4>(preWeightedPixels, pixels, channelWeights);
 
+    MFloat blockStaticAlphaError = ParallelMath::MakeFloatZero();
+    if (pruneShapes && anyBlockHasAlpha)
+    {
+        AggregatedError<1> alphaAggError;
+        MUInt15 filledAlpha[1] = { ParallelMath::MakeUInt15(255) };
+
+        for (int px = 0; px < 16; px++)
+        {
+            MUInt15 original[1] = { pixels[px][3] };
+            BCCommon::ComputeErrorLDR<1>(flags, filledAlpha, original, alphaAggError);
+        }
+
+        float alphaWeightsSq[1] = { channelWeightsSq[3] };
+        blockStaticAlphaError = alphaAggError.Finalize(flags, alphaWeightsSq);
+    }
+
+    CVTT_INSTRUMENTATION_BEGIN(initialEndpoints);
+
     // Get initial RGB endpoints
     if (allowRGBModes)
     {
@@ -1106,6 +1246,9 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
                 epSelector.FinishPass(epPass);
             }
             temps.unfinishedRGB[shape] = epSelector.GetEndpoints(channelWeights);
+
+            if (pruneShapes)
+                temps.shapeResidualRGB[shape] = epSelector.GetLineResidual();
         }
     }
 
@@ -1118,7 +1261,7 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
         {
             int shape = shapeList[shapeIter];
 
-            if (anyBlockHasAlpha || !allowRGBModes)
+            if (anyBlockHasAlpha)
             {
                 int shapeStart = BC7Data::g_shapeRanges[shape][0];
                 int shapeSize = BC7Data::g_shapeRanges[shape][1];
@@ -1135,14 +1278,37 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
                     epSelector.FinishPass(epPass);
                 }
                 temps.unfinishedRGBA[shape] = epSelector.GetEndpoints(channelWeights);
+
+                if (pruneShapes)
+                    temps.shapeResidualRGBA[shape] = epSelector.GetLineResidual();
             }
-            else
+
+            // Opaque blocks always allow RGB modes, so they reuse the RGB endpoints
+            if (anyBlockIsOpaque)
             {
-                temps.unfinishedRGBA[shape] = temps.unfinishedRGB[shape].ExpandTo<4>(255);
+                UnfinishedEndpoints<4> expanded = temps.unfinishedRGB[shape].ExpandTo<4>(255);
+
+                if (anyBlockHasAlpha)
+                {
+                    temps.unfinishedRGBA[shape].ConditionalSet(blockIsOpaque, expanded);
+
+                    if (pruneShapes)
+                        ParallelMath::ConditionalSet(temps.shapeResidualRGBA[shape], ParallelMath::Int16FlagToFloat(blockIsOpaque), temps.shapeResidualRGB[shape]);
+                }
+                else
+                {
+                    temps.unfinishedRGBA[shape] = expanded;
+
+                    if (pruneShapes)
+                        temps.shapeResidualRGBA[shape] = temps.shapeResidualRGB[shape];
+                }
             }
         }
     }
 
+    CVTT_INSTRUMENTATION_END(initialEndpoints);
+    CVTT_INSTRUMENTATION_RECORD(initialEndpoints, work.m_stats->stageCycles[BC7InstrumentationStats::Stage_InitialEndpoints], work.m_stats->stageCalls[BC7InstrumentationStats::Stage_InitialEndpoints]);
+
     for (uint16_t mode = 0; mode <= 7; mode++)
     {
         if (mode == 4 || mode == 5)
@@ -1174,9 +1340,9 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
             break;
         case 7:
             if (anyBlockHasAlpha)
-                partitionEnabledBits = encodingPlan.mode7RGBAPartitionEnabled;
-            else
-                partitionEnabledBits = encodingPlan.mode7RGBPartitionEnabled;
+                partitionEnabledBits |= encodingPlan.mode7RGBAPartitionEnabled;
+            if (anyBlockIsOpaque)
+                partitionEnabledBits |= encodingPlan.mode7RGBPartitionEnabled;
             break;
         default:
             break;
@@ -1228,6 +1394,64 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
         for (int slot = 0; slot < BC7Data::g_numShapesAll; slot++)
             temps.shapeBestError[slot] = ParallelMath::MakeFloat(FLT_MAX);
 
+        // A partition's error is at least the total line residual of its shapes, plus the error from dropping alpha in RGB
+        // modes.  Shapes that are only used by partitions that can't beat the current error in any block are skipped.
+        bool shapeNeeded[BC7Data::g_numShapesAll];
+        ParallelMath::Int16CompFlag shapeNeededByBlock[BC7Data::g_numShapesAll];
+        if (pruneShapes)
+        {
+            for (int slot = 0; slot < BC7Data::g_numShapesAll; slot++)
+            {
+                shapeNeeded[slot] = false;
+                shapeNeededByBlock[slot] = ParallelMath::MakeBoolInt16(false);
+            }
+
+            for (unsigned int partition = 0; partition < numPartitions; partition++)
+            {
+                if (((partitionEnabledBits >> partition) & 1) == 0)
+                    continue;
+
+                const int *partitionShapes;
+                if (numSubsets == 1)
+                    partitionShapes = BC7Data::g_shapes1[partition];
+                else if (numSubsets == 2)
+                    partitionShapes = BC7Data::g_shapes2[partition];
+                else
+                    partitionShapes = BC7Data::g_shapes3[partition];
+
+                MFloat partitionMinError = isRGB ? blockStaticAlphaError : ParallelMath::MakeFloatZero();
+                for (int subset = 0; subset < numSubsets; subset++)
+                {
+                    if (isRGB)
+                        partitionMinError = partitionMinError + temps.shapeResidualRGB[partitionShapes[subset]];
+                    else
+                        partitionMinError = partitionMinError + temps.shapeResidualRGBA[partitionShapes[subset]];
+                }
+
+                ParallelMath::Int16CompFlag partitionNeeded = ParallelMath::FloatFlagToInt16(ParallelMath::Less(partitionMinError * pruneScale, work.m_error));
+                if (isRGB)
+                    partitionNeeded = partitionNeeded & blockAllowsRGBModes;
+                else if (mode == 7)
+                {
+                    if (((encodingPlan.mode7RGBAPartitionEnabled >> partition) & 1) == 0)
+                        partitionNeeded = partitionNeeded & blockIsOpaque;
+                    if (((encodingPlan.mode7RGBPartitionEnabled >> partition) & 1) == 0)
+                        partitionNeeded = partitionNeeded & blockHasNonMaxAlpha;
+                }
+
+                if (ParallelMath::AnySet(partitionNeeded))
+                {
+                    for (int subset = 0; subset < numSubsets; subset++)
+                    {
+                        shapeNeeded[partitionShapes[subset]] = true;
+                        shapeNeededByBlock[partitionShapes[subset]] = shapeNeededByBlock[partitionShapes[subset]] | partitionNeeded;
+                    }
+                }
+            }
+        }
+
+        CVTT_INSTRUMENTATION_BEGIN(shapeRefine);
+
         for (int shapeIter = 0; shapeIter < numShapes; shapeIter++)
         {
             int shape = shapeList[shapeIter];
@@ -1244,6 +1468,11 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
             if (numTweakRounds > MaxTweakRounds)
                 numTweakRounds = MaxTweakRounds;
 
+            if (pruneShapes && !shapeNeeded[shape])
+                continue;
+
+            CVTT_INSTRUMENTATION_BEGIN(shape);
+
             int shapeStart = BC7Data::g_shapeRanges[shape][0];
             int shapeLength = BC7Data::g_shapeRanges[shape][1];
 
@@ -1408,7 +1637,7 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
                             bool punchThroughOK = true;
                             if (needPunchThroughCheck)
                             {
-                                shapeErrorBetter16 = ParallelMath::AndNot(punchThroughInvalid[pIter], shapeErrorBetter16);
+                                shapeErrorBetter16 = ParallelMath::AndNot(shapeErrorBetter16, punchThroughInvalid[pIter]);
                                 shapeErrorBetter = ParallelMath::Int16FlagToFloat(shapeErrorBetter16);
 
                                 if (!ParallelMath::AnySet(shapeErrorBetter16))
@@ -1566,10 +1795,24 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
                     break;
                 }
 
+                CVTT_INSTRUMENTATION_BEGIN(singleColor);
+
                 TrySingleColorRGBAMultiTable(flags, pixels, average, numRealChannels, fragment, shapeLength, staticAlphaError, punchThroughInvalid, shapeBestError, shapeBestEP, fragmentBestIndexes, channelWeightsSq, scTables, numSCTables, rtn);
+
+                CVTT_INSTRUMENTATION_END(singleColor);
+                CVTT_INSTRUMENTATION_RECORD(singleColor, work.m_stats->stageCycles[BC7InstrumentationStats::Stage_SingleColor], work.m_stats->stageCalls[BC7InstrumentationStats::Stage_SingleColor]);
             }
+
+            CVTT_INSTRUMENTATION_END(shape);
+            CVTT_INSTRUMENTATION_RECORD(shape, work.m_stats->shapeCycles[shape], work.m_stats->shapeCalls[shape]);
+            CVTT_INSTRUMENTATION_RECORD(shape, work.m_stats->modeCycles[mode], work.m_stats->modeCalls[mode]);
         } // shapeIter
 
+        CVTT_INSTRUMENTATION_END(shapeRefine);
+        CVTT_INSTRUMENTATION_RECORD(shapeRefine, work.m_stats->stageCycles[BC7InstrumentationStats::Stage_ShapeRefine], work.m_stats->stageCalls[BC7InstrumentationStats::Stage_ShapeRefine]);
+
+        CVTT_INSTRUMENTATION_BEGIN(partitionSelection);
+
         uint64_t partitionsEnabledBits = 0xffffffffffffffffULL;
 
         switch (mode)
@@ -1622,18 +1865,21 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
             ParallelMath::FloatCompFlag errorBetter = ParallelMath::Less(totalError, work.m_error);
             ParallelMath::Int16CompFlag errorBetter16 = ParallelMath::FloatFlagToInt16(errorBetter);
 
-            if (mode == 7 && anyBlockHasAlpha)
-            {
-                // Some lanes could be better, but we filter them out to ensure consistency with scalar
-                bool isRGBAllowedForThisPartition = (((encodingPlan.mode7RGBPartitionEnabled >> partition) & 1) != 0);
+            // Some lanes could be better, but we filter out modes and shapes that the block wouldn't have tried on its own to
+            // ensure consistency with scalar
+            if (mode < 4)
+                errorBetter16 = (errorBetter16 & blockAllowsRGBModes);
+            else if (mode == 7 && encodingPlan.mode7RGBPartitionEnabled == 0)
+                errorBetter16 = (errorBetter16 & blockHasNonMaxAlpha);
 
-                if (!isRGBAllowedForThisPartition)
-                {
-                    errorBetter16 = (errorBetter16 & blockHasNonMaxAlpha);
-                    errorBetter = ParallelMath::Int16FlagToFloat(errorBetter16);
-                }
+            if (pruneShapes)
+            {
+                for (int subset = 0; subset < numSubsets; subset++)
+                    errorBetter16 = (errorBetter16 & shapeNeededByBlock[partitionShapes[subset]]);
             }
 
+            errorBetter = ParallelMath::Int16FlagToFloat(errorBetter16);
+
             if (ParallelMath::AnySet(errorBetter16))
             {
                 for (int subset = 0; subset < numSubsets; subset++)
@@ -1658,6 +1904,9 @@ void cvtt::Internal::BC7Computer::TrySinglePlane(uint32_t flags, const MUInt15 p
                 ParallelMath::ConditionalSet(work.m_u.m_partition, errorBetter16, ParallelMath::MakeUInt15(partition));
             }
         }
+
+        CVTT_INSTRUMENTATION_END(partitionSelection);
+        CVTT_INSTRUMENTATION_RECORD(partitionSelection, work.m_stats->stageCycles[BC7InstrumentationStats::Stage_PartitionSelection], work.m_stats->stageCalls[BC7InstrumentationStats::Stage_PartitionSelection]);
     }
 }
 
@@ -1692,6 +1941,8 @@ void cvtt::Internal::BC7Computer::TryDualPlane(uint32_t flags, const MUInt15 pix
             if (numSP[0] == 0 && numSP[1] == 0)
                 continue;
 
+            CVTT_INSTRUMENTATION_BEGIN(rotation);
+
             int alphaChannel = (rotation + 3) & 3;
             int redChannel = (rotation == 1) ? 3 : 0;
             int greenChannel = (rotation == 2) ? 3 : 1;
@@ -1960,6 +2211,10 @@ void cvtt::Internal::BC7Computer::TryDualPlane(uint32_t flags, const MUInt15 pix
                     for (int ch = 0; ch < 4; ch++)
                         ParallelMath::ConditionalSet(work.m_ep[0][ep][ch], errorBetter16, bestEP[ep][ch]);
             }
+
+            CVTT_INSTRUMENTATION_END(rotation);
+            CVTT_INSTRUMENTATION_RECORD(rotation, work.m_stats->rotationCycles[mode - 4][rotation], work.m_stats->rotationCalls[mode - 4][rotation]);
+            CVTT_INSTRUMENTATION_RECORD(rotation, work.m_stats->modeCycles[mode], work.m_stats->modeCalls[mode]);
         }
     }
 }
@@ -1972,8 +2227,14 @@ void cvtt::Internal::BC7Computer::Swap(T& a, T& b)
     b = temp;
 }
 
-void cvtt::Internal::BC7Computer::Pack(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds)
+void cvtt::Internal::BC7Computer::Pack(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, float pruneTolerance)
 {
+    if (flags & Flags::BC7_RealTime)
+    {
+        PackRealTime(flags, inputs, packedBlocks, channelWeights);
+        return;
+    }
+
     MUInt15 pixels[16][4];
     MFloat floatPixels[16][4];
 
@@ -1994,12 +2255,23 @@ void cvtt::Internal::BC7Computer::Pack(uint32_t flags, const PixelBlockU8* input
 
     work.m_error = ParallelMath::MakeFloat(FLT_MAX);
 
+#if defined(CVTT_ENABLE_INSTRUMENTATION)
+    BC7InstrumentationStats stats;
+    work.m_stats = &stats;
+#endif
+
     {
         ParallelMath::RoundTowardNearestForScope rtn;
-        TrySinglePlane(flags, pixels, floatPixels, channelWeights, encodingPlan, numRefineRounds, work, &rtn);
+        TrySinglePlane(flags, pixels, floatPixels, channelWeights, encodingPlan, numRefineRounds, pruneTolerance, work, &rtn);
+
+        CVTT_INSTRUMENTATION_BEGIN(dualPlane);
         TryDualPlane(flags, pixels, floatPixels, channelWeights, encodingPlan, numRefineRounds, work, &rtn);
+        CVTT_INSTRUMENTATION_END(dualPlane);
+        CVTT_INSTRUMENTATION_RECORD(dualPlane, stats.stageCycles[BC7InstrumentationStats::Stage_DualPlane], stats.stageCalls[BC7InstrumentationStats::Stage_DualPlane]);
     }
 
+    CVTT_INSTRUMENTATION_BEGIN(bitPacking);
+
     for (int block = 0; block < ParallelMath::ParallelSize; block++)
     {
         PackingVector pv;
@@ -2201,224 +2473,631 @@ void cvtt::Internal::BC7Computer::Pack(uint32_t flags, const PixelBlockU8* input
 
         packedBlocks += 16;
     }
+
+    CVTT_INSTRUMENTATION_END(bitPacking);
+    CVTT_INSTRUMENTATION_RECORD(bitPacking, stats.stageCycles[BC7InstrumentationStats::Stage_BitPacking], stats.stageCalls[BC7InstrumentationStats::Stage_BitPacking]);
+
+#if defined(CVTT_ENABLE_INSTRUMENTATION)
+    stats.numPackCalls++;
+    stats.numBlocks += ParallelMath::ParallelSize;
+    Instrumentation::AddBC7Stats(stats);
+#endif
 }
 
-void cvtt::Internal::BC7Computer::UnpackOne(PixelBlockU8 &output, const uint8_t* packedBlock)
+void cvtt::Internal::BC7Computer::GetBoundingBoxEndpoints(const MUInt15 minColor[4], const MUInt15 maxColor[4], const MFloat floatPixels[16][4], const float channelWeights[4], int numChannels, MUInt15 endPoints[2][4])
 {
-    UnpackingVector pv;
-    pv.Init(packedBlock);
+    // Pick the bounding box diagonal by the sign of each channel's covariance with the channel of largest weighted extent
+    MFloat center[4];
+    MFloat extent[4];
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        center[ch] = ParallelMath::ToFloat(minColor[ch] + maxColor[ch]) * 0.5f;
+        extent[ch] = ParallelMath::ToFloat(maxColor[ch] - minColor[ch]) * channelWeights[ch];
+    }
 
-    int mode = 8;
-    for (int i = 0; i < 8; i++)
+    MFloat cov[4][4];
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        for (int other = ch + 1; other < numChannels; other++)
+            cov[ch][other] = ParallelMath::MakeFloatZero();
+    }
+
+    for (int px = 0; px < 16; px++)
     {
-        if (pv.Unpack(1) == 1)
+        MFloat offset[4];
+        for (int ch = 0; ch < numChannels; ch++)
+            offset[ch] = floatPixels[px][ch] - center[ch];
+
+        for (int ch = 0; ch < numChannels; ch++)
         {
-            mode = i;
-            break;
+            for (int other = ch + 1; other < numChannels; other++)
+                cov[ch][other] = cov[ch][other] + offset[ch] * offset[other];
         }
     }
 
-    if (mode > 7)
+    ParallelMath::Int16CompFlag dominant[4];
+    MFloat dominantExtent = extent[0];
+    dominant[0] = ParallelMath::MakeBoolInt16(true);
+    for (int ch = 1; ch < numChannels; ch++)
     {
-        for (int px = 0; px < 16; px++)
-            for (int ch = 0; ch < 4; ch++)
-                output.m_pixels[px][ch] = 0;
+        dominant[ch] = ParallelMath::FloatFlagToInt16(ParallelMath::Less(dominantExtent, extent[ch]));
+        for (int prev = 0; prev < ch; prev++)
+            dominant[prev] = ParallelMath::AndNot(dominant[prev], dominant[ch]);
 
-        return;
+        dominantExtent = ParallelMath::Max(dominantExtent, extent[ch]);
     }
 
-    const BC7Data::BC7ModeInfo &modeInfo = BC7Data::g_modes[mode];
-
-    int partition = 0;
-    if (modeInfo.m_partitionBits)
-        partition = pv.Unpack(modeInfo.m_partitionBits);
+    // Inset the endpoints by 1/16 of the extent, which roughly centers the interpolated colors on the pixels
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        ParallelMath::Int16CompFlag flip = ParallelMath::MakeBoolInt16(false);
+        for (int other = 0; other < numChannels; other++)
+        {
+            if (other == ch)
+                continue;
 
-    int rotation = 0;
-    if (modeInfo.m_alphaMode == BC7Data::AlphaMode_Separate)
-        rotation = pv.Unpack(2);
+            const MFloat &pairCov = (other < ch) ? cov[other][ch] : cov[ch][other];
+            flip = flip | (dominant[other] & ParallelMath::FloatFlagToInt16(ParallelMath::Less(pairCov, ParallelMath::MakeFloatZero())));
+        }
 
-    int indexSelector = 0;
-    if (modeInfo.m_hasIndexSelector)
-        indexSelector = pv.Unpack(1);
+        MUInt15 inset = ParallelMath::RightShift(maxColor[ch] - minColor[ch], 4);
+        MUInt15 low = minColor[ch] + inset;
+        MUInt15 high = maxColor[ch] - inset;
 
-    // Resolve fixups
-    int fixups[3] = { 0, 0, 0 };
+        endPoints[0][ch] = ParallelMath::Select(flip, high, low);
+        endPoints[1][ch] = ParallelMath::Select(flip, low, high);
+    }
+}
 
-    if (modeInfo.m_alphaMode != BC7Data::AlphaMode_Separate)
+void cvtt::Internal::BC7Computer::QuantizeBestParity(MUInt15 ep[2][4], const float channelWeightsSq[4], const ParallelMath::Int16CompFlag &parityFromAlpha)
+{
+    for (int epi = 0; epi < 2; epi++)
     {
-        if (modeInfo.m_numSubsets == 2)
-            fixups[1] = BC7Data::g_fixupIndexes2[partition];
-        else if (modeInfo.m_numSubsets == 3)
+        MUInt15 candidates[2][4];
+        MFloat error[2];
+
+        for (int p = 0; p < 2; p++)
         {
-            fixups[1] = BC7Data::g_fixupIndexes3[partition][0];
-            fixups[2] = BC7Data::g_fixupIndexes3[partition][1];
+            for (int ch = 0; ch < 4; ch++)
+                candidates[p][ch] = ep[epi][ch];
+
+            QuantizeP(candidates[p], 7, static_cast<uint16_t>(p), 4);
+
+            error[p] = ParallelMath::MakeFloatZero();
+            for (int ch = 0; ch < 4; ch++)
+            {
+                MFloat diff = ParallelMath::ToFloat(candidates[p][ch]) - ParallelMath::ToFloat(ep[epi][ch]);
+                error[p] = error[p] + diff * diff * channelWeightsSq[ch];
+            }
         }
+
+        // Alpha can only be 0 with even parity and 255 with odd parity
+        ParallelMath::Int16CompFlag useOdd = ParallelMath::FloatFlagToInt16(ParallelMath::Less(error[1], error[0]));
+        ParallelMath::Int16CompFlag alphaHigh = ParallelMath::Less(ParallelMath::MakeUInt15(127), ep[epi][3]);
+        useOdd = (parityFromAlpha & alphaHigh) | ParallelMath::AndNot(useOdd, parityFromAlpha);
+
+        for (int ch = 0; ch < 4; ch++)
+            ep[epi][ch] = ParallelMath::Select(useOdd, candidates[1][ch], candidates[0][ch]);
     }
+}
 
-    int endPoints[3][2][4];
+void cvtt::Internal::BC7Computer::PackRealTime(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4])
+{
+    const int numRefineRounds = 2;
 
-    // Decode RGB
-    for (int ch = 0; ch < 3; ch++)
+    ParallelMath::RoundTowardNearestForScope rtn;
+
+    float channelWeightsSq[4];
+    for (int ch = 0; ch < 4; ch++)
+        channelWeightsSq[ch] = channelWeights[ch] * channelWeights[ch];
+
+    MUInt15 pixels[16][4];
+    MFloat floatPixels[16][4];
+    MFloat preWeightedPixels[16][4];
+
+    MUInt15 minColor[4];
+    MUInt15 maxColor[4];
+
+    for (int ch = 0; ch < 4; ch++)
     {
-        for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
-        {
-            for (int ep = 0; ep < 2; ep++)
-                endPoints[subset][ep][ch] = (pv.Unpack(modeInfo.m_rgbBits) << (8 - modeInfo.m_rgbBits));
-        }
+        minColor[ch] = ParallelMath::MakeUInt15(255);
+        maxColor[ch] = ParallelMath::MakeUInt15(0);
     }
 
-    // Decode alpha
-    if (modeInfo.m_alphaMode != BC7Data::AlphaMode_None)
+    for (int px = 0; px < 16; px++)
     {
-        for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
+        ParallelMath::ConvertLDRInputs(inputs, px, pixels[px]);
+
+        for (int ch = 0; ch < 4; ch++)
         {
-            for (int ep = 0; ep < 2; ep++)
-                endPoints[subset][ep][3] = (pv.Unpack(modeInfo.m_alphaBits) << (8 - modeInfo.m_alphaBits));
+            floatPixels[px][ch] = ParallelMath::ToFloat(pixels[px][ch]);
+            preWeightedPixels[px][ch] = floatPixels[px][ch] * channelWeights[ch];
+
+            minColor[ch] = ParallelMath::Min(minColor[ch], pixels[px][ch]);
+            maxColor[ch] = ParallelMath::Max(maxColor[ch], pixels[px][ch]);
         }
     }
-    else
+
+    bool anyBlockHasAlpha = ParallelMath::AnySet(ParallelMath::Less(minColor[3], ParallelMath::MakeUInt15(255)));
+
+    ParallelMath::Int16CompFlag isOpaque = ParallelMath::Equal(minColor[3], ParallelMath::MakeUInt15(255));
+    ParallelMath::Int16CompFlag isPunchThrough = ParallelMath::MakeBoolInt16(false);
+    if (flags & Flags::BC7_RespectPunchThrough)
     {
-        for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
+        isPunchThrough = ParallelMath::MakeBoolInt16(true);
+        for (int px = 0; px < 16; px++)
         {
-            for (int ep = 0; ep < 2; ep++)
-                endPoints[subset][ep][3] = 255;
+            MUInt15 a = pixels[px][3];
+            isPunchThrough = (isPunchThrough & (ParallelMath::Equal(a, ParallelMath::MakeUInt15(0)) | ParallelMath::Equal(a, ParallelMath::MakeUInt15(255))));
         }
     }
 
-    int parityBits = 0;
+    // Mode 6
+    MUInt15 ep6[2][4];
+    MUInt15 indexes6[16];
+    IndexSelector<4> indexSelector6;
+
+    GetBoundingBoxEndpoints(minColor, maxColor, floatPixels, channelWeights, 4, ep6);
 
-    // Decode parity bits
-    if (modeInfo.m_pBitMode == BC7Data::PBitMode_PerSubset)
+    for (int refine = 0; refine < numRefineRounds; refine++)
     {
-        for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
-        {
-            int p = pv.Unpack(1);
+        // Opaque blocks keep their alpha exact, since choosing parity by error alone often rounds it to 254
+        QuantizeBestParity(ep6, channelWeightsSq, isOpaque | isPunchThrough);
+        indexSelector6.Init<false>(channelWeights, ep6, 16);
 
-            for (int ep = 0; ep < 2; ep++)
-            {
-                for (int ch = 0; ch < 3; ch++)
-                    endPoints[subset][ep][ch] |= p << (7 - modeInfo.m_rgbBits);
+        EndpointRefiner<4> refiner;
+        refiner.Init(16, channelWeights);
 
-                if (modeInfo.m_alphaMode != BC7Data::AlphaMode_None)
-                    endPoints[subset][ep][3] |= p << (7 - modeInfo.m_alphaBits);
-            }
+        for (int px = 0; px < 16; px++)
+        {
+            indexes6[px] = indexSelector6.SelectIndexLDR(floatPixels[px], &rtn);
+
+            if (refine != numRefineRounds - 1)
+                refiner.ContributeUnweightedPW(preWeightedPixels[px], indexes6[px]);
         }
 
-        parityBits = 1;
+        if (refine != numRefineRounds - 1)
+            refiner.GetRefinedEndpointsLDR(ep6, &rtn);
     }
-    else if (modeInfo.m_pBitMode == BC7Data::PBitMode_PerEndpoint)
+
+    // Mode 5, with separate alpha and no rotation, is only tried if some block has alpha
+    MUInt15 ep5RGB[2][3];
+    MUInt15 ep5A[2][1];
+    MUInt15 indexes5RGB[16];
+    MUInt15 indexes5A[16];
+    ParallelMath::Int16CompFlag useMode5 = ParallelMath::MakeBoolInt16(false);
+
+    if (anyBlockHasAlpha)
     {
-        for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
+        MUInt15 initialEP[2][4];
+        GetBoundingBoxEndpoints(minColor, maxColor, floatPixels, channelWeights, 3, initialEP);
+
+        for (int epi = 0; epi < 2; epi++)
         {
-            for (int ep = 0; ep < 2; ep++)
+            for (int ch = 0; ch < 3; ch++)
+                ep5RGB[epi][ch] = initialEP[epi][ch];
+        }
+
+        ep5A[0][0] = minColor[3];
+        ep5A[1][0] = maxColor[3];
+
+        IndexSelector<3> indexSelectorRGB;
+        IndexSelector<1> indexSelectorA;
+
+        for (int refine = 0; refine < numRefineRounds; refine++)
+        {
+            for (int epi = 0; epi < 2; epi++)
             {
-                int p = pv.Unpack(1);
+                Quantize(ep5RGB[epi], 7, 3);
+                Unquantize(ep5RGB[epi], 7, 3);
+            }
 
-                for (int ch = 0; ch < 3; ch++)
-                    endPoints[subset][ep][ch] |= p << (7 - modeInfo.m_rgbBits);
+            indexSelectorRGB.Init<false>(channelWeights, ep5RGB, 4);
+            indexSelectorA.Init<false>(channelWeights + 3, ep5A, 4);
+
+            EndpointRefiner<3> refinerRGB;
+            EndpointRefiner<1> refinerA;
+            refinerRGB.Init(4, channelWeights);
+            refinerA.Init(4, channelWeights + 3);
+
+            for (int px = 0; px < 16; px++)
+            {
+                indexes5RGB[px] = indexSelectorRGB.SelectIndexLDR(floatPixels[px], &rtn);
+                indexes5A[px] = indexSelectorA.SelectIndexLDR(floatPixels[px] + 3, &rtn);
 
-                if (modeInfo.m_alphaMode != BC7Data::AlphaMode_None)
-                    endPoints[subset][ep][3] |= p << (7 - modeInfo.m_alphaBits);
+                if (refine != numRefineRounds - 1)
+                {
+                    refinerRGB.ContributeUnweightedPW(preWeightedPixels[px], indexes5RGB[px]);
+                    refinerA.ContributeUnweightedPW(preWeightedPixels[px] + 3, indexes5A[px]);
+                }
             }
-        }
 
-        parityBits = 1;
-    }
+            if (refine != numRefineRounds - 1)
+            {
+                refinerRGB.GetRefinedEndpointsLDR(ep5RGB, &rtn);
+                refinerA.GetRefinedEndpointsLDR(ep5A, &rtn);
+            }
+        }
 
-    // Fill endpoint bits
-    for (int subset = 0; subset < modeInfo.m_numSubsets; subset++)
-    {
-        for (int ep = 0; ep < 2; ep++)
+        AggregatedError<4> aggError6;
+        AggregatedError<4> aggError5;
+        for (int px = 0; px < 16; px++)
         {
-            for (int ch = 0; ch < 3; ch++)
-                endPoints[subset][ep][ch] |= (endPoints[subset][ep][ch] >> (modeInfo.m_rgbBits + parityBits));
+            MUInt15 reconstructed[4];
 
-            if (modeInfo.m_alphaMode != BC7Data::AlphaMode_None)
-                endPoints[subset][ep][3] |= (endPoints[subset][ep][3] >> (modeInfo.m_alphaBits + parityBits));
+            indexSelector6.ReconstructLDR_BC7(indexes6[px], reconstructed);
+            BCCommon::ComputeErrorLDR<4>(flags, reconstructed, pixels[px], aggError6);
+
+            indexSelectorRGB.ReconstructLDR_BC7(indexes5RGB[px], reconstructed);
+            indexSelectorA.ReconstructLDR_BC7(indexes5A[px], reconstructed + 3);
+            BCCommon::ComputeErrorLDR<4>(flags, reconstructed, pixels[px], aggError5);
         }
-    }
 
-    int indexes[16];
-    int indexes2[16];
+        useMode5 = ParallelMath::FloatFlagToInt16(ParallelMath::Less(aggError5.Finalize(flags, channelWeightsSq), aggError6.Finalize(flags, channelWeightsSq)));
 
-    // Decode indexes
-    for (int px = 0; px < 16; px++)
-    {
-        int bits = modeInfo.m_indexBits;
-        if ((px == 0) || (px == fixups[1]) || (px == fixups[2]))
-            bits--;
+        // Mode 6 parity bits can't keep both 0 and 255 alpha exact
+        useMode5 = useMode5 | (isPunchThrough & ParallelMath::Less(minColor[3], maxColor[3]));
 
-        indexes[px] = pv.Unpack(bits);
+        // Opaque blocks never try mode 5 on their own, so keep them on mode 6 when grouped with blocks that have alpha
+        useMode5 = ParallelMath::AndNot(useMode5, isOpaque);
     }
 
-    // Decode secondary indexes
-    if (modeInfo.m_alphaMode == BC7Data::AlphaMode_Separate)
+    // The first index of each index set must have its high bit clear
     {
+        ParallelMath::Int16CompFlag flip = ParallelMath::Less(ParallelMath::MakeUInt15(7), indexes6[0]);
         for (int px = 0; px < 16; px++)
-        {
-            int bits = modeInfo.m_alphaIndexBits;
-            if (px == 0)
-                bits--;
+            indexes6[px] = ParallelMath::Select(flip, ParallelMath::MakeUInt15(15) - indexes6[px], indexes6[px]);
 
-            indexes2[px] = pv.Unpack(bits);
+        for (int ch = 0; ch < 4; ch++)
+        {
+            MUInt15 ep0 = ep6[0][ch];
+            MUInt15 ep1 = ep6[1][ch];
+            ep6[0][ch] = ParallelMath::Select(flip, ep1, ep0);
+            ep6[1][ch] = ParallelMath::Select(flip, ep0, ep1);
         }
     }
-    else
+
+    ParallelPackingVector pv;
+    pv.Init();
+
+    pv.Pack(ParallelMath::MakeUInt16(1 << 6), 7);
+
+    for (int ch = 0; ch < 4; ch++)
     {
-        for (int px = 0; px < 16; px++)
-            indexes2[px] = 0;
+        for (int epi = 0; epi < 2; epi++)
+            pv.Pack(ParallelMath::ToUInt16(ParallelMath::RightShift(ep6[epi][ch], 1)), 7);
     }
 
-    const int *alphaWeights = BC7Data::g_weightTables[modeInfo.m_alphaIndexBits];
-    const int *rgbWeights = BC7Data::g_weightTables[modeInfo.m_indexBits];
+    for (int epi = 0; epi < 2; epi++)
+        pv.Pack(ParallelMath::ToUInt16(ep6[epi][0] & ParallelMath::MakeUInt15(1)), 1);
 
-    // Decode each pixel
     for (int px = 0; px < 16; px++)
+        pv.Pack(ParallelMath::ToUInt16(indexes6[px]), (px == 0) ? 3 : 4);
+
+    if (ParallelMath::AnySet(useMode5))
     {
-        int rgbWeight = 0;
-        int alphaWeight = 0;
+        ParallelMath::Int16CompFlag flipRGB = ParallelMath::Less(ParallelMath::MakeUInt15(1), indexes5RGB[0]);
+        ParallelMath::Int16CompFlag flipA = ParallelMath::Less(ParallelMath::MakeUInt15(1), indexes5A[0]);
 
-        int rgbIndex = indexes[px];
+        for (int px = 0; px < 16; px++)
+        {
+            indexes5RGB[px] = ParallelMath::Select(flipRGB, ParallelMath::MakeUInt15(3) - indexes5RGB[px], indexes5RGB[px]);
+            indexes5A[px] = ParallelMath::Select(flipA, ParallelMath::MakeUInt15(3) - indexes5A[px], indexes5A[px]);
+        }
 
-        rgbWeight = rgbWeights[indexes[px]];
+        for (int ch = 0; ch < 3; ch++)
+        {
+            MUInt15 ep0 = ep5RGB[0][ch];
+            MUInt15 ep1 = ep5RGB[1][ch];
+            ep5RGB[0][ch] = ParallelMath::Select(flipRGB, ep1, ep0);
+            ep5RGB[1][ch] = ParallelMath::Select(flipRGB, ep0, ep1);
+        }
+
+        {
+            MUInt15 ep0 = ep5A[0][0];
+            MUInt15 ep1 = ep5A[1][0];
+            ep5A[0][0] = ParallelMath::Select(flipA, ep1, ep0);
+            ep5A[1][0] = ParallelMath::Select(flipA, ep0, ep1);
+        }
+
+        ParallelPackingVector pv5;
+        pv5.Init();
 
-        if (modeInfo.m_alphaMode == BC7Data::AlphaMode_Combined)
-            alphaWeight = rgbWeight;
-        else if (modeInfo.m_alphaMode == BC7Data::AlphaMode_Separate)
-            alphaWeight = alphaWeights[indexes2[px]];
+        pv5.Pack(ParallelMath::MakeUInt16(1 << 5), 6);
+        pv5.Pack(ParallelMath::MakeUInt16(0), 2);
 
-        if (indexSelector == 1)
+        for (int ch = 0; ch < 3; ch++)
         {
-            int temp = rgbWeight;
-            rgbWeight = alphaWeight;
-            alphaWeight = temp;
+            for (int epi = 0; epi < 2; epi++)
+                pv5.Pack(ParallelMath::ToUInt16(ParallelMath::RightShift(ep5RGB[epi][ch], 1)), 7);
         }
 
-        int pixel[4] = { 0, 0, 0, 255 };
+        for (int epi = 0; epi < 2; epi++)
+            pv5.Pack(ParallelMath::ToUInt16(ep5A[epi][0]), 8);
 
-        int subset = 0;
+        for (int px = 0; px < 16; px++)
+            pv5.Pack(ParallelMath::ToUInt16(indexes5RGB[px]), (px == 0) ? 1 : 2);
 
-        if (modeInfo.m_numSubsets == 2)
-            subset = (BC7Data::g_partitionMap[partition] >> px) & 1;
-        else if (modeInfo.m_numSubsets == 3)
-            subset = (BC7Data::g_partitionMap2[partition] >> (px * 2)) & 3;
+        for (int px = 0; px < 16; px++)
+            pv5.Pack(ParallelMath::ToUInt16(indexes5A[px]), (px == 0) ? 1 : 2);
 
-        for (int ch = 0; ch < 3; ch++)
-            pixel[ch] = ((64 - rgbWeight) * endPoints[subset][0][ch] + rgbWeight * endPoints[subset][1][ch] + 32) >> 6;
+        for (int w = 0; w < 8; w++)
+            pv.m_words[w] = ParallelMath::Select(useMode5, pv5.m_words[w], pv.m_words[w]);
+    }
 
-        if (modeInfo.m_alphaMode != BC7Data::AlphaMode_None)
-            pixel[3] = ((64 - alphaWeight) * endPoints[subset][0][3] + alphaWeight * endPoints[subset][1][3] + 32) >> 6;
+    pv.Flush(packedBlocks);
+}
+
+int cvtt::Internal::BC7Computer::GetMode(const uint8_t *packedBlock)
+{
+    for (int mode = 0; mode < 8; mode++)
+    {
+        if (packedBlock[0] & (1 << mode))
+            return mode;
+    }
+
+    return -1;
+}
+
+template<int TMode>
+void cvtt::Internal::BC7Computer::UnpackModeTyped(const uint8_t *packedBlocks, MUInt15 outPixels[16][4])
+{
+    const BC7Data::BC7ModeInfo &modeInfo = BC7Data::g_modes[TMode];
 
-        if (rotation != 0)
+    const int numSubsets = modeInfo.m_numSubsets;
+    const bool hasAlpha = (modeInfo.m_alphaMode != BC7Data::AlphaMode_None);
+    const bool isDualPlane = (modeInfo.m_alphaMode == BC7Data::AlphaMode_Separate);
+    const int parityBits = (modeInfo.m_pBitMode == BC7Data::PBitMode_None) ? 0 : 1;
+    const int numEPChannels = hasAlpha ? 4 : 3;
+
+    const int *rgbWeightTable = BC7Data::g_weightTables[modeInfo.m_indexBits];
+    const int *alphaWeightTable = BC7Data::g_weightTables[modeInfo.m_alphaIndexBits];
+
+    // Endpoints are stored as e0 * 64 + 32 and e1 - e0 so that each channel interpolates with one multiply-add
+    int16_t epBaseValues[3][4][ParallelMath::ParallelSize];
+    int16_t epDeltaValues[3][4][ParallelMath::ParallelSize];
+    uint16_t rgbWeightValues[16][ParallelMath::ParallelSize];
+    uint16_t alphaWeightValues[16][ParallelMath::ParallelSize];
+    uint16_t subsetMaskValues[2][ParallelMath::ParallelSize];
+    uint16_t rotationValues[ParallelMath::ParallelSize];
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        BlockBitReader reader;
+        reader.Init(packedBlocks + block * 16);
+
+        rotationValues[block] = 0;
+
+        int offset = TMode + 1;
+
+        int partition = 0;
+        if (modeInfo.m_partitionBits)
         {
-            int ch = rotation - 1;
-            int temp = pixel[ch];
-            pixel[ch] = pixel[3];
-            pixel[3] = temp;
+            partition = static_cast<int>(reader.Read(offset, modeInfo.m_partitionBits));
+            offset += modeInfo.m_partitionBits;
+        }
+
+        if (isDualPlane)
+        {
+            rotationValues[block] = static_cast<uint16_t>(reader.Read(offset, 2));
+            offset += 2;
+        }
+
+        int indexSelector = 0;
+        if (modeInfo.m_hasIndexSelector)
+        {
+            indexSelector = static_cast<int>(reader.Read(offset, 1));
+            offset++;
+        }
+
+        int endPoints[3][2][4];
+
+        for (int ch = 0; ch < numEPChannels; ch++)
+        {
+            const int bits = (ch == 3) ? modeInfo.m_alphaBits : modeInfo.m_rgbBits;
+
+            for (int subset = 0; subset < numSubsets; subset++)
+            {
+                for (int ep = 0; ep < 2; ep++)
+                {
+                    endPoints[subset][ep][ch] = static_cast<int>(reader.Read(offset, bits)) << (8 - bits);
+                    offset += bits;
+                }
+            }
+        }
+
+        if (modeInfo.m_pBitMode != BC7Data::PBitMode_None)
+        {
+            for (int subset = 0; subset < numSubsets; subset++)
+            {
+                for (int ep = 0; ep < 2; ep++)
+                {
+                    int p = static_cast<int>(reader.Read(offset, 1));
+                    if (modeInfo.m_pBitMode == BC7Data::PBitMode_PerEndpoint || ep == 1)
+                        offset++;
+
+                    for (int ch = 0; ch < numEPChannels; ch++)
+                        endPoints[subset][ep][ch] |= p << (7 - ((ch == 3) ? modeInfo.m_alphaBits : modeInfo.m_rgbBits));
+                }
+            }
+        }
+
+        for (int subset = 0; subset < numSubsets; subset++)
+        {
+            for (int ch = 0; ch < numEPChannels; ch++)
+            {
+                const int bits = (ch == 3) ? modeInfo.m_alphaBits : modeInfo.m_rgbBits;
+
+                int ep[2];
+                for (int epi = 0; epi < 2; epi++)
+                    ep[epi] = endPoints[subset][epi][ch] | (endPoints[subset][epi][ch] >> (bits + parityBits));
+
+                epBaseValues[subset][ch][block] = static_cast<int16_t>(ep[0] * 64 + 32);
+                epDeltaValues[subset][ch][block] = static_cast<int16_t>(ep[1] - ep[0]);
+            }
+        }
+
+        int fixups[3] = { 0, 0, 0 };
+        if (numSubsets == 2)
+        {
+            fixups[1] = BC7Data::g_fixupIndexes2[partition];
+            subsetMaskValues[0][block] = BC7Data::g_partitionMap[partition];
+        }
+        else if (numSubsets == 3)
+        {
+            fixups[1] = Util::Min(BC7Data::g_fixupIndexes3[partition][0], BC7Data::g_fixupIndexes3[partition][1]);
+            fixups[2] = Util::Max(BC7Data::g_fixupIndexes3[partition][0], BC7Data::g_fixupIndexes3[partition][1]);
+
+            const uint32_t partitionMap = BC7Data::g_partitionMap2[partition];
+            uint16_t masks[2] = { 0, 0 };
+            for (int px = 0; px < 16; px++)
+            {
+                const int subset = (partitionMap >> (px * 2)) & 3;
+                if (subset != 0)
+                    masks[subset - 1] |= static_cast<uint16_t>(1 << px);
+            }
+
+            subsetMaskValues[0][block] = masks[0];
+            subsetMaskValues[1][block] = masks[1];
+        }
+
+        // Each index plane is at most 63 bits, so it can be read at once.  Anchor indexes are stored without their high bit,
+        // which is always 0, so a 0 bit is inserted for each of them in increasing order to give every index the same width.
+        const int rgbIndexMask = (1 << modeInfo.m_indexBits) - 1;
+        uint64_t rgbIndexBits = reader.Read(offset, modeInfo.m_indexBits * 16 - numSubsets);
+        offset += modeInfo.m_indexBits * 16 - numSubsets;
+
+        for (int subset = 0; subset < numSubsets; subset++)
+            rgbIndexBits = InsertZeroBit(rgbIndexBits, fixups[subset] * modeInfo.m_indexBits + modeInfo.m_indexBits - 1);
+
+        const int alphaIndexMask = (1 << modeInfo.m_alphaIndexBits) - 1;
+        uint64_t alphaIndexBits = 0;
+        if (isDualPlane)
+            alphaIndexBits = InsertZeroBit(reader.Read(offset, modeInfo.m_alphaIndexBits * 16 - 1), modeInfo.m_alphaIndexBits - 1);
+
+        for (int px = 0; px < 16; px++)
+        {
+            int rgbWeight = rgbWeightTable[(rgbIndexBits >> (px * modeInfo.m_indexBits)) & rgbIndexMask];
+            int alphaWeight = rgbWeight;
+
+            if (isDualPlane)
+            {
+                alphaWeight = alphaWeightTable[(alphaIndexBits >> (px * modeInfo.m_alphaIndexBits)) & alphaIndexMask];
+
+                if (indexSelector)
+                    Swap(rgbWeight, alphaWeight);
+            }
+
+            rgbWeightValues[px][block] = static_cast<uint16_t>(rgbWeight);
+            alphaWeightValues[px][block] = static_cast<uint16_t>(alphaWeight);
+        }
+    }
+
+    MSInt16 epBase[3][4];
+    MSInt16 epDelta[3][4];
+    for (int subset = 0; subset < numSubsets; subset++)
+    {
+        for (int ch = 0; ch < numEPChannels; ch++)
+        {
+            epBase[subset][ch] = ParallelMath::LoadSInt16(epBaseValues[subset][ch]);
+            epDelta[subset][ch] = ParallelMath::LoadSInt16(epDeltaValues[subset][ch]);
+        }
+    }
+
+    MUInt16 subsetMasks[2];
+    for (int i = 0; i < numSubsets - 1; i++)
+        subsetMasks[i] = ParallelMath::LoadUInt16(subsetMaskValues[i]);
+
+    MUInt15 rgbWeights[16];
+    MUInt15 alphaWeights[16];
+    for (int px = 0; px < 16; px++)
+    {
+        rgbWeights[px] = ParallelMath::LoadUInt15(rgbWeightValues[px]);
+        alphaWeights[px] = ParallelMath::LoadUInt15(alphaWeightValues[px]);
+    }
+
+    const MUInt15 rotation = ParallelMath::LoadUInt15(rotationValues);
+
+    ParallelMath::Int16CompFlag rotationFlags[3];
+    if (isDualPlane)
+    {
+        for (int i = 0; i < 3; i++)
+            rotationFlags[i] = ParallelMath::Equal(rotation, ParallelMath::MakeUInt15(static_cast<uint16_t>(i + 1)));
+    }
+
+    for (int px = 0; px < 16; px++)
+    {
+        ParallelMath::Int16CompFlag subsetFlags[2];
+        for (int i = 0; i < numSubsets - 1; i++)
+            subsetFlags[i] = IsMaskBitSet(subsetMasks[i], px);
+
+        MUInt15 pixel[4];
+        for (int ch = 0; ch < numEPChannels; ch++)
+        {
+            MSInt16 base = epBase[0][ch];
+            MSInt16 delta = epDelta[0][ch];
+
+            for (int subset = 1; subset < numSubsets; subset++)
+            {
+                ParallelMath::ConditionalSet(base, subsetFlags[subset - 1], epBase[subset][ch]);
+                ParallelMath::ConditionalSet(delta, subsetFlags[subset - 1], epDelta[subset][ch]);
+            }
+
+            const MUInt15 &weight = (ch == 3 && isDualPlane) ? alphaWeights[px] : rgbWeights[px];
+
+            pixel[ch] = ParallelMath::ToUInt15(ParallelMath::RightShift(base + ParallelMath::CompactMultiply(delta, weight), 6));
+        }
+
+        if (!hasAlpha)
+            pixel[3] = ParallelMath::MakeUInt15(255);
+
+        if (isDualPlane)
+        {
+            MUInt15 alpha = pixel[3];
+            for (int ch = 0; ch < 3; ch++)
+            {
+                ParallelMath::ConditionalSet(alpha, rotationFlags[ch], pixel[ch]);
+                ParallelMath::ConditionalSet(pixel[ch], rotationFlags[ch], pixel[3]);
+            }
+            pixel[3] = alpha;
         }
 
         for (int ch = 0; ch < 4; ch++)
-            output.m_pixels[px][ch] = static_cast<uint8_t>(pixel[ch]);
+            outPixels[px][ch] = pixel[ch];
+    }
+}
+
+void cvtt::Internal::BC7Computer::UnpackMode(int mode, const uint8_t *packedBlocks, ParallelMath::UInt15 outPixels[16][4])
+{
+    switch (mode)
+    {
+    case 0:
+        UnpackModeTyped<0>(packedBlocks, outPixels);
+        break;
+    case 1:
+        UnpackModeTyped<1>(packedBlocks, outPixels);
+        break;
+    case 2:
+        UnpackModeTyped<2>(packedBlocks, outPixels);
+        break;
+    case 3:
+        UnpackModeTyped<3>(packedBlocks, outPixels);
+        break;
+    case 4:
+        UnpackModeTyped<4>(packedBlocks, outPixels);
+        break;
+    case 5:
+        UnpackModeTyped<5>(packedBlocks, outPixels);
+        break;
+    case 6:
+        UnpackModeTyped<6>(packedBlocks, outPixels);
+        break;
+    case 7:
+        UnpackModeTyped<7>(packedBlocks, outPixels);
+        break;
+    default:
+        assert(false);
+        break;
     }
 }
 
@@ -2872,7 +3551,10 @@ void cvtt::Internal::BC6HComputer::Pack(uint32_t flags, const PixelBlockF16* inp
                                 if (ParallelMath::AllSet(anySame))
                                 {
                                     roundValid[metaRound][subset] = false;
-                                    continue;
+
+                                    // The next refine pass starts from this pass's indexes, so only skip it if it's the last one
+                                    if (refinePass == numRefineRounds - 1)
+                                        continue;
                                 }
                             }
 
@@ -2950,7 +3632,7 @@ void cvtt::Internal::BC6HComputer::Pack(uint32_t flags, const PixelBlockF16* inp
                             else
                                 EvaluateSingleLegality(metaEndPointsQuantized[meta0][0], modeInfo.m_aPrec, modeInfo.m_bPrec, modeInfo.m_transformed, encodedEPs[0], isLegal);
 
-                            ParallelMath::Int16CompFlag isLegalAndBetter = (ParallelMath::FloatFlagToInt16(errorBetter) & isLegal);
+                            ParallelMath::Int16CompFlag isLegalAndBetter = (needsCommit & isLegal);
                             if (!ParallelMath::AnySet(isLegalAndBetter))
                                 continue;
 
@@ -3056,238 +3738,425 @@ void cvtt::Internal::BC6HComputer::SignExtendSingle(int &v, int bits)
         v |= -(1 << bits);
 }
 
-void cvtt::Internal::BC6HComputer::UnpackOne(PixelBlockF16 &output, const uint8_t *pBC, bool isSigned)
+int cvtt::Internal::BC6HComputer::GetModeIndex(const uint8_t *packedBlock)
 {
-    int numModeBits = 2;
-    int modeBits = pBC[0] & 0x3;
+    int modeBits = packedBlock[0] & 0x3;
     if (modeBits != 0 && modeBits != 1)
-    {
-        modeBits = pBC[0] & 0x1f;
-        numModeBits += 3;
-    }
+        modeBits = packedBlock[0] & 0x1f;
 
-    int mode = -1;
-    for (int possibleMode = 0; possibleMode < BC7Data::g_numHDRModes; possibleMode++)
+    for (int modeIndex = 0; modeIndex < static_cast<int>(BC7Data::g_numHDRModes); modeIndex++)
     {
-        if (BC7Data::g_hdrModes[possibleMode].m_modeID == modeBits)
-        {
-            mode = possibleMode;
-            break;
-        }
+        if (BC7Data::g_hdrModes[modeIndex].m_modeID == modeBits)
+            return modeIndex;
     }
 
-    if (mode < 0)
-    {
-        for (int px = 0; px < 16; px++)
-        {
-            for (int ch = 0; ch < 3; ch++)
-                output.m_pixels[px][ch] = 0;
-            output.m_pixels[px][3] = 0x3c00;	// 1.0
-        }
-        return;
-    }
+    return -1;
+}
+
+template<int TModeIndex, cvtt::BC6H_IO::ReadFunc_t TReadFunc>
+void cvtt::Internal::BC6HComputer::UnpackModeTyped(const uint8_t *packedBlocks, bool isSigned, MSInt16 outPixels[16][3])
+{
+    const BC7Data::BC6HModeInfo &modeInfo = BC7Data::g_hdrModes[TModeIndex];
 
-    const BC7Data::BC6HModeInfo& modeInfo = BC7Data::g_hdrModes[mode];
+    const int numSubsets = modeInfo.m_partitioned ? 2 : 1;
     const int headerBits = modeInfo.m_partitioned ? 82 : 65;
-    const BC6H_IO::ReadFunc_t readFunc = BC6H_IO::g_readFuncs[mode];
+    const int indexBits = modeInfo.m_partitioned ? 3 : 4;
+    const int aPrec = modeInfo.m_aPrec;
+    const int *weightTable = BC7Data::g_weightTables[indexBits];
 
-    uint16_t partition = 0;
-    int32_t eps[2][2][3];
+    int16_t epValues[2][2][3][ParallelMath::ParallelSize];
+    uint16_t weightValues[16][ParallelMath::ParallelSize];
+    uint16_t subsetMaskValues[ParallelMath::ParallelSize];
 
-    for (int subset = 0; subset < 2; subset++)
-        for (int epi = 0; epi < 2; epi++)
-            for (int ch = 0; ch < 3; ch++)
-                eps[subset][epi][ch] = 0;
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        BlockBitReader reader;
+        reader.Init(packedBlocks + block * 16);
 
-    UnpackingVector pv;
-    pv.Init(pBC);
+        subsetMaskValues[block] = 0;
 
-    {
-        uint32_t header[3];
-        uint16_t codedEPs[2][2][3];
-        pv.UnpackStart(header, headerBits);
+        const uint32_t header[3] = { static_cast<uint32_t>(reader.m_low), static_cast<uint32_t>(reader.m_low >> 32), static_cast<uint32_t>(reader.m_high) };
 
-        readFunc(header, partition,
+        uint16_t partition = 0;
+        uint16_t codedEPs[2][2][3];
+        TReadFunc(header, partition,
             codedEPs[0][0][0], codedEPs[0][1][0], codedEPs[1][0][0], codedEPs[1][1][0],
             codedEPs[0][0][1], codedEPs[0][1][1], codedEPs[1][0][1], codedEPs[1][1][1],
             codedEPs[0][0][2], codedEPs[0][1][2], codedEPs[1][0][2], codedEPs[1][1][2]
         );
 
-        for (int subset = 0; subset < 2; subset++)
+        for (int subset = 0; subset < numSubsets; subset++)
+        {
             for (int epi = 0; epi < 2; epi++)
+            {
                 for (int ch = 0; ch < 3; ch++)
-                    eps[subset][epi][ch] = codedEPs[subset][epi][ch];
-    }
+                    epValues[subset][epi][ch][block] = static_cast<int16_t>(codedEPs[subset][epi][ch]);
+            }
+        }
 
-    uint16_t modeID = modeInfo.m_modeID;
+        // Anchor indexes are stored without their high bit, which is always 0
+        uint64_t indexBitsValue = reader.Read(headerBits, indexBits * 16 - numSubsets);
+        indexBitsValue = InsertZeroBit(indexBitsValue, indexBits - 1);
 
-    int fixupIndex1 = 0;
-    int indexBits = 4;
-    int numSubsets = 1;
-    if (modeInfo.m_partitioned)
-    {
-        fixupIndex1 = BC7Data::g_fixupIndexes2[partition];
-        indexBits = 3;
-        numSubsets = 2;
-    }
-
-    int indexes[16];
-    for (int px = 0; px < 16; px++)
-    {
-        if (px == 0 || px == fixupIndex1)
-            indexes[px] = pv.Unpack(indexBits - 1);
-        else
-            indexes[px] = pv.Unpack(indexBits);
-    }
-
-    if (modeInfo.m_partitioned)
-    {
-        for (int ch = 0; ch < 3; ch++)
+        if (modeInfo.m_partitioned)
         {
-            if (isSigned)
-                SignExtendSingle(eps[0][0][ch], modeInfo.m_aPrec);
-            if (modeInfo.m_transformed || isSigned)
-            {
-                SignExtendSingle(eps[0][1][ch], modeInfo.m_bPrec[ch]);
-                SignExtendSingle(eps[1][0][ch], modeInfo.m_bPrec[ch]);
-                SignExtendSingle(eps[1][1][ch], modeInfo.m_bPrec[ch]);
-            }
+            indexBitsValue = InsertZeroBit(indexBitsValue, BC7Data::g_fixupIndexes2[partition] * indexBits + indexBits - 1);
+            subsetMaskValues[block] = BC7Data::g_partitionMap[partition];
         }
+
+        const int indexMask = (1 << indexBits) - 1;
+        for (int px = 0; px < 16; px++)
+            weightValues[px][block] = static_cast<uint16_t>(weightTable[(indexBitsValue >> (px * indexBits)) & indexMask]);
     }
-    else
+
+    MSInt16 eps[2][2][3];
+    for (int subset = 0; subset < numSubsets; subset++)
     {
-        for (int ch = 0; ch < 3; ch++)
+        for (int epi = 0; epi < 2; epi++)
         {
-            if (isSigned)
-                SignExtendSingle(eps[0][0][ch], modeInfo.m_aPrec);
-            if (modeInfo.m_transformed || isSigned)
-                SignExtendSingle(eps[0][1][ch], modeInfo.m_bPrec[ch]);
+            for (int ch = 0; ch < 3; ch++)
+                eps[subset][epi][ch] = ParallelMath::LoadSInt16(epValues[subset][epi][ch]);
         }
     }
 
-    int aPrec = modeInfo.m_aPrec;
+    MUInt15 weights[16];
+    for (int px = 0; px < 16; px++)
+        weights[px] = ParallelMath::LoadUInt15(weightValues[px]);
+
+    const MUInt16 subsetMask = ParallelMath::LoadUInt16(subsetMaskValues);
 
-    if (modeInfo.m_transformed)
+    // The first endpoint is stored at full precision, the others may be deltas from it
+    for (int subset = 0; subset < numSubsets; subset++)
     {
-        for (int ch = 0; ch < 3; ch++)
+        for (int epi = 0; epi < 2; epi++)
         {
-            int wrapMask = (1 << aPrec) - 1;
-
-            eps[0][1][ch] = ((eps[0][0][ch] + eps[0][1][ch]) & wrapMask);
-            if (isSigned)
-                SignExtendSingle(eps[0][1][ch], aPrec);
-
-            if (modeInfo.m_partitioned)
+            for (int ch = 0; ch < 3; ch++)
             {
-                eps[1][0][ch] = ((eps[0][0][ch] + eps[1][0][ch]) & wrapMask);
-                eps[1][1][ch] = ((eps[0][0][ch] + eps[1][1][ch]) & wrapMask);
+                MSInt16 &ep = eps[subset][epi][ch];
 
-                if (isSigned)
+                if (subset == 0 && epi == 0)
                 {
-                    SignExtendSingle(eps[1][0][ch], aPrec);
-                    SignExtendSingle(eps[1][1][ch], aPrec);
+                    if (isSigned)
+                        ep = ParallelMath::TruncateToPrecisionSigned(ep, aPrec);
+                }
+                else if (modeInfo.m_transformed || isSigned)
+                {
+                    ep = ParallelMath::TruncateToPrecisionSigned(ep, modeInfo.m_bPrec[ch]);
+
+                    if (modeInfo.m_transformed)
+                    {
+                        ep = ep + eps[0][0][ch];
+                        if (isSigned)
+                            ep = ParallelMath::TruncateToPrecisionSigned(ep, aPrec);
+                    }
                 }
             }
         }
     }
 
-    // Unquantize endpoints
+    // Unquantize endpoints to 16-bit unsigned values or 16-bit signed values, depending on the format
+    MUInt16 unsignedEPs[2][2][3];
+    MSInt16 signedEPs[2][2][3];
+
     for (int subset = 0; subset < numSubsets; subset++)
     {
         for (int epi = 0; epi < 2; epi++)
         {
             for (int ch = 0; ch < 3; ch++)
             {
-                int &v = eps[subset][epi][ch];
-
                 if (isSigned)
                 {
-                    if (aPrec >= 16)
-                    {
-                        // Nothing
-                    }
-                    else
-                    {
-                        bool s = false;
-                        int comp = v;
-                        if (v < 0)
-                        {
-                            s = true;
-                            comp = -comp;
-                        }
+                    const MSInt16 ep = eps[subset][epi][ch];
 
-                        int unq = 0;
-                        if (comp == 0)
-                            unq = 0;
-                        else if (comp >= ((1 << (aPrec - 1)) - 1))
-                            unq = 0x7fff;
-                        else
-                            unq = ((comp << 15) + 0x4000) >> (aPrec - 1);
+                    if (aPrec < 16)
+                    {
+                        const MUInt15 comp = ParallelMath::ToUInt15(ParallelMath::Abs(ep));
 
-                        if (s)
-                            unq = -unq;
+                        MUInt15 unq = (comp << (16 - aPrec)) + ParallelMath::MakeUInt15(static_cast<uint16_t>(0x4000 >> (aPrec - 1)));
+                        ParallelMath::ConditionalSet(unq, ParallelMath::Equal(comp, ParallelMath::MakeUInt15(0)), ParallelMath::MakeUInt15(0));
+                        ParallelMath::ConditionalSet(unq, ParallelMath::Less(ParallelMath::MakeUInt15(static_cast<uint16_t>((1 << (aPrec - 1)) - 2)), comp), ParallelMath::MakeUInt15(0x7fff));
 
-                        v = unq;
+                        signedEPs[subset][epi][ch] = ParallelMath::ConditionalNegate(ParallelMath::Less(ep, ParallelMath::MakeSInt16(0)), ParallelMath::ToSInt16(unq));
                     }
+                    else
+                        signedEPs[subset][epi][ch] = ep;
                 }
                 else
                 {
-                    if (aPrec >= 15)
-                    {
-                        // Nothing
-                    }
-                    else if (v == 0)
+                    const MUInt16 ep = ParallelMath::TruncateToPrecisionUnsigned(ParallelMath::LosslessCast<MUInt16>::Cast(eps[subset][epi][ch]), aPrec);
+
+                    if (aPrec < 15)
                     {
-                        // Nothing
+                        MUInt16 unq = (ep << (16 - aPrec)) + ParallelMath::MakeUInt16(static_cast<uint16_t>(0x8000 >> aPrec));
+                        ParallelMath::ConditionalSet(unq, ParallelMath::Equal(ep, ParallelMath::MakeUInt16(0)), ParallelMath::MakeUInt16(0));
+                        ParallelMath::ConditionalSet(unq, ParallelMath::Equal(ep, ParallelMath::MakeUInt16(static_cast<uint16_t>((1 << aPrec) - 1))), ParallelMath::MakeUInt16(0xffff));
+
+                        unsignedEPs[subset][epi][ch] = unq;
                     }
-                    else if (v == ((1 << aPrec) - 1))
-                        v = 0xffff;
                     else
-                        v = ((v << 16) + 0x8000) >> aPrec;
+                        unsignedEPs[subset][epi][ch] = ep;
                 }
             }
         }
     }
 
-    const int *weights = BC7Data::g_weightTables[indexBits];
+    const ParallelMath::UInt31 roundingBias = ParallelMath::ToUInt31(ParallelMath::MakeUInt16(32));
+    const MSInt32 signedRoundingBias = ParallelMath::ToInt32(ParallelMath::MakeUInt15(32));
 
     for (int px = 0; px < 16; px++)
     {
-        int subset = 0;
+        const MUInt15 weight = weights[px];
+        const MUInt15 invWeight = ParallelMath::MakeUInt15(64) - weight;
+
+        ParallelMath::Int16CompFlag isSubset1 = ParallelMath::MakeBoolInt16(false);
         if (modeInfo.m_partitioned)
-            subset = (BC7Data::g_partitionMap[partition] >> px) & 1;
+            isSubset1 = IsMaskBitSet(subsetMask, px);
 
-        int w = weights[indexes[px]];
         for (int ch = 0; ch < 3; ch++)
         {
-            int comp = ((64 - w) * eps[subset][0][ch] + w * eps[subset][1][ch] + 32) >> 6;
-
+            // Interpolate, then scale the interpolated value by 31/32 (signed) or 31/64 (unsigned) to get half float bits
             if (isSigned)
             {
-                if (comp < 0)
-                    comp = -(((-comp) * 31) >> 5);
-                else
-                    comp = (comp * 31) >> 5;
+                MSInt16 ep0 = ParallelMath::Select(isSubset1, signedEPs[1][0][ch], signedEPs[0][0][ch]);
+                MSInt16 ep1 = ParallelMath::Select(isSubset1, signedEPs[1][1][ch], signedEPs[0][1][ch]);
 
-                int s = 0;
-                if (comp < 0)
-                {
-                    s = 0x8000;
-                    comp = -comp;
-                }
+                MSInt32 interpolated = ParallelMath::RightShift(ParallelMath::XMultiply(ep0, invWeight) + ParallelMath::XMultiply(ep1, weight) + signedRoundingBias, 6);
+                MSInt16 comp = ParallelMath::ToSInt16(interpolated);
+
+                // floor(x * 31 / 32) = x - ceil(x / 32)
+                MUInt16 absComp = ParallelMath::Abs(comp);
+                absComp = absComp - ParallelMath::RightShift(absComp + ParallelMath::MakeUInt16(31), 5);
 
-                output.m_pixels[px][ch] = static_cast<uint16_t>(s | comp);
+                // Values that scale to zero are positive zero
+                MSInt16 result = ParallelMath::ToSInt16(ParallelMath::ToUInt15(absComp));
+                ParallelMath::Int16CompFlag isNegative = ParallelMath::Less(comp, ParallelMath::MakeSInt16(0)) & ParallelMath::Less(ParallelMath::MakeSInt16(0), result);
+                ParallelMath::ConditionalSet(result, isNegative, result + ParallelMath::MakeSInt16(-32768));
+
+                outPixels[px][ch] = result;
             }
             else
             {
-                comp = (comp * 31) >> 6;
-                output.m_pixels[px][ch] = static_cast<uint16_t>(comp);
+                MUInt16 ep0 = ParallelMath::Select(isSubset1, unsignedEPs[1][0][ch], unsignedEPs[0][0][ch]);
+                MUInt16 ep1 = ParallelMath::Select(isSubset1, unsignedEPs[1][1][ch], unsignedEPs[0][1][ch]);
+
+                ParallelMath::UInt31 interpolated = ParallelMath::RightShift(ParallelMath::XMultiply(ep0, invWeight) + ParallelMath::XMultiply(ep1, weight) + roundingBias, 6);
+                interpolated = ParallelMath::RightShift((interpolated << 5) - interpolated, 6);
+
+                outPixels[px][ch] = ParallelMath::ToSInt16(ParallelMath::ToUInt15(interpolated));
             }
         }
-        output.m_pixels[px][3] = 0x3c00;	// 1.0
     }
 }
 
+void cvtt::Internal::BC6HComputer::UnpackMode(int modeIndex, const uint8_t *packedBlocks, bool isSigned, ParallelMath::SInt16 outPixels[16][3])
+{
+    switch (modeIndex)
+    {
+    case 0:
+        UnpackModeTyped<0, BC6H_IO::ReadMode0>(packedBlocks, isSigned, outPixels);
+        break;
+    case 1:
+        UnpackModeTyped<1, BC6H_IO::ReadMode1>(packedBlocks, isSigned, outPixels);
+        break;
+    case 2:
+        UnpackModeTyped<2, BC6H_IO::ReadMode2>(packedBlocks, isSigned, outPixels);
+        break;
+    case 3:
+        UnpackModeTyped<3, BC6H_IO::ReadMode3>(packedBlocks, isSigned, outPixels);
+        break;
+    case 4:
+        UnpackModeTyped<4, BC6H_IO::ReadMode4>(packedBlocks, isSigned, outPixels);
+        break;
+    case 5:
+        UnpackModeTyped<5, BC6H_IO::ReadMode5>(packedBlocks, isSigned, outPixels);
+        break;
+    case 6:
+        UnpackModeTyped<6, BC6H_IO::ReadMode6>(packedBlocks, isSigned, outPixels);
+        break;
+    case 7:
+        UnpackModeTyped<7, BC6H_IO::ReadMode7>(packedBlocks, isSigned, outPixels);
+        break;
+    case 8:
+        UnpackModeTyped<8, BC6H_IO::ReadMode8>(packedBlocks, isSigned, outPixels);
+        break;
+    case 9:
+        UnpackModeTyped<9, BC6H_IO::ReadMode9>(packedBlocks, isSigned, outPixels);
+        break;
+    case 10:
+        UnpackModeTyped<10, BC6H_IO::ReadMode10>(packedBlocks, isSigned, outPixels);
+        break;
+    case 11:
+        UnpackModeTyped<11, BC6H_IO::ReadMode11>(packedBlocks, isSigned, outPixels);
+        break;
+    case 12:
+        UnpackModeTyped<12, BC6H_IO::ReadMode12>(packedBlocks, isSigned, outPixels);
+        break;
+    case 13:
+        UnpackModeTyped<13, BC6H_IO::ReadMode13>(packedBlocks, isSigned, outPixels);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+}
+
+// Encoding plans don't depend on the instruction set, so runtime dispatch builds only compile them once
+#if !defined(CVTT_DISPATCH_ISA_IMPL)
+namespace cvtt
+{
+    namespace BC7PlanSerialization
+    {
+        // Version 1 layout, all little-endian:
+        //   0  Magic "CVP7"
+        //   4  uint16 version, uint16 size
+        //   8  Partition masks for modes 0, 1, 2, 3, 7 (RGBA), and 7 (RGB)
+        //  50  Mode 4, 5, and 6 settings
+        //  63  Seed points for each RGB shape and then each RGBA shape, two per byte
+        // Shape lists aren't stored, they're rebuilt from the shapes that have seed points.
+        static const uint16_t kVersion = 1;
+        static const uint8_t kMagic[4] = { 'C', 'V', 'P', '7' };
+        static const int kMaxSeedPoints = 4;
+
+        static void WriteLE(uint8_t *&data, uint64_t value, int numBytes)
+        {
+            for (int i = 0; i < numBytes; i++)
+                *data++ = static_cast<uint8_t>(value >> (i * 8));
+        }
+
+        static uint64_t ReadLE(const uint8_t *&data, int numBytes)
+        {
+            uint64_t value = 0;
+            for (int i = 0; i < numBytes; i++)
+                value |= static_cast<uint64_t>(*data++) << (i * 8);
+            return value;
+        }
+
+        static bool ReadSeedPointCount(const uint8_t *&data, uint8_t &outSeedPoints)
+        {
+            outSeedPoints = *data++;
+            return outSeedPoints <= kMaxSeedPoints;
+        }
+
+        static void WriteSeedPoints(uint8_t *&data, const uint8_t *seedPoints, int numShapes)
+        {
+            for (int shape = 0; shape < numShapes; shape += 2)
+            {
+                uint8_t packed = seedPoints[shape];
+                if (shape + 1 < numShapes)
+                    packed |= static_cast<uint8_t>(seedPoints[shape + 1] << 4);
+                *data++ = packed;
+            }
+        }
+
+        static bool ReadSeedPoints(const uint8_t *&data, uint8_t *seedPoints, uint8_t *shapeList, uint8_t &numShapesToEvaluate, int numShapes)
+        {
+            numShapesToEvaluate = 0;
+            for (int shape = 0; shape < numShapes; shape++)
+            {
+                const uint8_t sp = (shape & 1) ? (*data++ >> 4) : (*data & 0xf);
+                if (sp > kMaxSeedPoints)
+                    return false;
+
+                seedPoints[shape] = sp;
+                if (sp > 0)
+                    shapeList[numShapesToEvaluate++] = static_cast<uint8_t>(shape);
+            }
+
+            if (numShapes & 1)
+                data++;
+
+            return true;
+        }
+    }
+}
+
+void cvtt::Kernels::SerializeBC7EncodingPlan(const BC7EncodingPlan &encodingPlan, uint8_t *outData)
+{
+    assert(outData);
+
+    uint8_t *data = outData;
+
+    for (int i = 0; i < 4; i++)
+        *data++ = BC7PlanSerialization::kMagic[i];
+    BC7PlanSerialization::WriteLE(data, BC7PlanSerialization::kVersion, 2);
+    BC7PlanSerialization::WriteLE(data, BC7EncodingPlan::kSerializedSize, 2);
+
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode0PartitionEnabled, 2);
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode1PartitionEnabled, 8);
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode2PartitionEnabled, 8);
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode3PartitionEnabled, 8);
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode7RGBAPartitionEnabled, 8);
+    BC7PlanSerialization::WriteLE(data, encodingPlan.mode7RGBPartitionEnabled, 8);
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        for (int indexSelector = 0; indexSelector < 2; indexSelector++)
+            *data++ = encodingPlan.mode4SP[rotation][indexSelector];
+    }
+    for (int rotation = 0; rotation < 4; rotation++)
+        *data++ = encodingPlan.mode5SP[rotation];
+    *data++ = encodingPlan.mode6Enabled ? 1 : 0;
+
+    BC7PlanSerialization::WriteSeedPoints(data, encodingPlan.seedPointsForShapeRGB, BC7EncodingPlan::kNumRGBShapes);
+    BC7PlanSerialization::WriteSeedPoints(data, encodingPlan.seedPointsForShapeRGBA, BC7EncodingPlan::kNumRGBAShapes);
+
+    assert(data == outData + BC7EncodingPlan::kSerializedSize);
+}
+
+bool cvtt::Kernels::DeserializeBC7EncodingPlan(BC7EncodingPlan &encodingPlan, const uint8_t *data, size_t size)
+{
+    if (data == NULL || size < static_cast<size_t>(BC7EncodingPlan::kSerializedSize))
+        return false;
+
+    const uint8_t *dataStart = data;
+
+    if (memcmp(data, BC7PlanSerialization::kMagic, 4) != 0)
+        return false;
+    data += 4;
+
+    if (BC7PlanSerialization::ReadLE(data, 2) != BC7PlanSerialization::kVersion || BC7PlanSerialization::ReadLE(data, 2) != BC7EncodingPlan::kSerializedSize)
+        return false;
+
+    // Decode into a temporary so that the output is left alone if the data is invalid
+    BC7EncodingPlan plan = BC7EncodingPlan();
+
+    plan.mode0PartitionEnabled = static_cast<uint16_t>(BC7PlanSerialization::ReadLE(data, 2));
+    plan.mode1PartitionEnabled = BC7PlanSerialization::ReadLE(data, 8);
+    plan.mode2PartitionEnabled = BC7PlanSerialization::ReadLE(data, 8);
+    plan.mode3PartitionEnabled = BC7PlanSerialization::ReadLE(data, 8);
+    plan.mode7RGBAPartitionEnabled = BC7PlanSerialization::ReadLE(data, 8);
+    plan.mode7RGBPartitionEnabled = BC7PlanSerialization::ReadLE(data, 8);
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        for (int indexSelector = 0; indexSelector < 2; indexSelector++)
+        {
+            if (!BC7PlanSerialization::ReadSeedPointCount(data, plan.mode4SP[rotation][indexSelector]))
+                return false;
+        }
+    }
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        if (!BC7PlanSerialization::ReadSeedPointCount(data, plan.mode5SP[rotation]))
+            return false;
+    }
+
+    const uint8_t mode6Enabled = *data++;
+    if (mode6Enabled > 1)
+        return false;
+    plan.mode6Enabled = (mode6Enabled != 0);
+
+    if (!BC7PlanSerialization::ReadSeedPoints(data, plan.seedPointsForShapeRGB, plan.rgbShapeList, plan.rgbNumShapesToEvaluate, BC7EncodingPlan::kNumRGBShapes))
+        return false;
+    if (!BC7PlanSerialization::ReadSeedPoints(data, plan.seedPointsForShapeRGBA, plan.rgbaShapeList, plan.rgbaNumShapesToEvaluate, BC7EncodingPlan::kNumRGBAShapes))
+        return false;
+
+    assert(data == dataStart + BC7EncodingPlan::kSerializedSize);
+
+    encodingPlan = plan;
+    return true;
+}
+
 void cvtt::Kernels::ConfigureBC7EncodingPlanFromQuality(BC7EncodingPlan &encodingPlan, int quality)
 {
     static const int kMaxQuality = 100;
@@ -3297,6 +4166,13 @@ void cvtt::Kernels::ConfigureBC7EncodingPlanFromQuality(BC7EncodingPlan &encodin
     else if (quality > kMaxQuality)
         quality = kMaxQuality;
 
+#if !defined(CVTT_NO_PRECOMPUTED_BC7_PLANS)
+    // The precomputed table is only out of date if the serialization format changed without regenerating it, in which
+    // case the plan is built from the priority lists instead
+    if (DeserializeBC7EncodingPlan(encodingPlan, cvtt::Tables::BC7QualityPlans::g_serializedPlans[quality - 1], BC7EncodingPlan::kSerializedSize))
+        return;
+#endif
+
     const int numRGBModes = cvtt::Tables::BC7Prio::g_bc7NumPrioCodesRGB * quality / kMaxQuality;
     const int numRGBAModes = cvtt::Tables::BC7Prio::g_bc7NumPrioCodesRGBA * quality / kMaxQuality;
 
@@ -3368,7 +4244,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
         for (int subset = 0; subset < 3; subset++)
         {
             int shape = cvtt::Internal::BC7Data::g_shapes3[partition][subset];
-            encodingPlan.seedPointsForShapeRGB[shape] = std::max(encodingPlan.seedPointsForShapeRGB[shape], sp);
+            encodingPlan.seedPointsForShapeRGB[shape] = Util::Max(encodingPlan.seedPointsForShapeRGB[shape], sp);
         }
     }
 
@@ -3384,7 +4260,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
         for (int subset = 0; subset < 2; subset++)
         {
             int shape = cvtt::Internal::BC7Data::g_shapes2[partition][subset];
-            encodingPlan.seedPointsForShapeRGB[shape] = std::max(encodingPlan.seedPointsForShapeRGB[shape], sp);
+            encodingPlan.seedPointsForShapeRGB[shape] = Util::Max(encodingPlan.seedPointsForShapeRGB[shape], sp);
         }
     }
 
@@ -3400,7 +4276,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
         for (int subset = 0; subset < 3; subset++)
         {
             int shape = cvtt::Internal::BC7Data::g_shapes3[partition][subset];
-            encodingPlan.seedPointsForShapeRGB[shape] = std::max(encodingPlan.seedPointsForShapeRGB[shape], sp);
+            encodingPlan.seedPointsForShapeRGB[shape] = Util::Max(encodingPlan.seedPointsForShapeRGB[shape], sp);
         }
     }
 
@@ -3416,7 +4292,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
         for (int subset = 0; subset < 2; subset++)
         {
             int shape = cvtt::Internal::BC7Data::g_shapes2[partition][subset];
-            encodingPlan.seedPointsForShapeRGB[shape] = std::max(encodingPlan.seedPointsForShapeRGB[shape], sp);
+            encodingPlan.seedPointsForShapeRGB[shape] = Util::Max(encodingPlan.seedPointsForShapeRGB[shape], sp);
         }
     }
 
@@ -3439,7 +4315,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
             encodingPlan.mode6Enabled = true;
 
             int shape = cvtt::Internal::BC7Data::g_shapes1[0][0];
-            encodingPlan.seedPointsForShapeRGBA[shape] = std::max(encodingPlan.seedPointsForShapeRGBA[shape], sp);
+            encodingPlan.seedPointsForShapeRGBA[shape] = Util::Max(encodingPlan.seedPointsForShapeRGBA[shape], sp);
         }
     }
 
@@ -3455,7 +4331,7 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
         for (int subset = 0; subset < 2; subset++)
         {
             int shape = cvtt::Internal::BC7Data::g_shapes2[partition][subset];
-            encodingPlan.seedPointsForShapeRGBA[shape] = std::max(encodingPlan.seedPointsForShapeRGBA[shape], sp);
+            encodingPlan.seedPointsForShapeRGBA[shape] = Util::Max(encodingPlan.seedPointsForShapeRGBA[shape], sp);
         }
     }
 
@@ -3481,5 +4357,6 @@ bool cvtt::Kernels::ConfigureBC7EncodingPlanFromFineTuningParams(BC7EncodingPlan
 
     return true;
 }
+#endif
 
 #endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ConvectionKernels_ParallelMath.h"
+#include "ConvectionKernels_BC6H_IO.h"
 
 
 namespace cvtt
@@ -13,6 +14,7 @@ namespace cvtt
         }
     }
 
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         namespace BC67
@@ -23,19 +25,22 @@ namespace cvtt
         template<int TVectorSize>
         class IndexSelectorHDR;
     }
+    CVTT_ISA_NAMESPACE_END
 
     struct PixelBlockU8;
 }
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         class BC7Computer
         {
         public:
-            static void Pack(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds);
-            static void UnpackOne(PixelBlockU8 &output, const uint8_t* packedBlock);
+            static void Pack(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, float pruneTolerance);
+            static int GetMode(const uint8_t *packedBlock);
+            static void UnpackMode(int mode, const uint8_t *packedBlocks, ParallelMath::UInt15 outPixels[16][4]);
 
         private:
             static const int MaxTweakRounds = 4;
@@ -59,8 +64,14 @@ namespace cvtt
             static void CompressEndpoints6(MUInt15 ep[2][4], uint16_t p[2]);
             static void CompressEndpoints7(MUInt15 ep[2][4], uint16_t p[2]);
             static void TrySingleColorRGBAMultiTable(uint32_t flags, const MUInt15 pixels[16][4], const MFloat average[4], int numRealChannels, const uint8_t *fragmentStart, int shapeLength, const MFloat &staticAlphaError, const ParallelMath::Int16CompFlag punchThroughInvalid[4], MFloat& shapeBestError, MUInt15 shapeBestEP[2][4], MUInt15 *fragmentBestIndexes, const float *channelWeightsSq, const cvtt::Tables::BC7SC::Table*const* tables, int numTables, const ParallelMath::RoundTowardNearestForScope *rtn);
-            static void TrySinglePlane(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, BC67::WorkInfo& work, const ParallelMath::RoundTowardNearestForScope *rtn);
+            static void TrySinglePlane(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, float pruneTolerance, BC67::WorkInfo& work, const ParallelMath::RoundTowardNearestForScope *rtn);
             static void TryDualPlane(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const float channelWeights[4], const BC7EncodingPlan &encodingPlan, int numRefineRounds, BC67::WorkInfo& work, const ParallelMath::RoundTowardNearestForScope *rtn);
+            static void GetBoundingBoxEndpoints(const MUInt15 minColor[4], const MUInt15 maxColor[4], const MFloat floatPixels[16][4], const float channelWeights[4], int numChannels, MUInt15 endPoints[2][4]);
+            static void QuantizeBestParity(MUInt15 ep[2][4], const float channelWeightsSq[4], const ParallelMath::Int16CompFlag &parityFromAlpha);
+            static void PackRealTime(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, const float channelWeights[4]);
+
+            template<int TMode>
+            static void UnpackModeTyped(const uint8_t *packedBlocks, MUInt15 outPixels[16][4]);
 
             template<class T>
             static void Swap(T& a, T& b);
@@ -71,7 +82,8 @@ namespace cvtt
         {
         public:
             static void Pack(uint32_t flags, const PixelBlockF16* inputs, uint8_t* packedBlocks, const float channelWeights[4], bool isSigned, int numTweakRounds, int numRefineRounds);
-            static void UnpackOne(PixelBlockF16 &output, const uint8_t *pBC, bool isSigned);
+            static int GetModeIndex(const uint8_t *packedBlock);
+            static void UnpackMode(int modeIndex, const uint8_t *packedBlocks, bool isSigned, ParallelMath::SInt16 outPixels[16][3]);
 
         private:
             typedef ParallelMath::Float MFloat;
@@ -94,6 +106,10 @@ namespace cvtt
             static void EvaluatePartitionedLegality(const MAInt16 ep0[2][3], const MAInt16 ep1[2][3], int aPrec, const int bPrec[3], bool isTransformed, MAInt16 outEncodedEPs[2][2][3], ParallelMath::Int16CompFlag& outIsLegal);
             static void EvaluateSingleLegality(const MAInt16 ep[2][3], int aPrec, const int bPrec[3], bool isTransformed, MAInt16 outEncodedEPs[2][3], ParallelMath::Int16CompFlag& outIsLegal);
             static void SignExtendSingle(int &v, int bits);
+
+            template<int TModeIndex, BC6H_IO::ReadFunc_t TReadFunc>
+            static void UnpackModeTyped(const uint8_t *packedBlocks, bool isSigned, MSInt16 outPixels[16][3]);
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
@@ -0,0 +1,261 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cvtt
+{
+    namespace BC7Training
+    {
+        // One mode configuration at one seed point count.  config is the partition for modes 0-3 and 7, the rotation
+        // for mode 5, and the rotation times 2 plus the index selector for mode 4.
+        struct Candidate
+        {
+            uint8_t m_mode;
+            uint8_t m_config;
+            uint8_t m_seedPoints;
+        };
+
+        static const int kMaxSeedPoints = 4;
+        static const int kNumModes = 8;
+
+        static const int g_numConfigs[kNumModes] = { 16, 64, 64, 64, 8, 4, 1, 64 };
+
+        // Dual-plane configurations fit two sets of endpoints, so each seed point is counted as two shape evaluations
+        static const uint32_t kDualPlaneWorkPerSeedPoint = 2;
+
+        static uint8_t &GetSeedPoints(BC7FineTuningParams &params, int mode, int config)
+        {
+            switch (mode)
+            {
+            case 0:
+                return params.mode0SP[config];
+            case 1:
+                return params.mode1SP[config];
+            case 2:
+                return params.mode2SP[config];
+            case 3:
+                return params.mode3SP[config];
+            case 4:
+                return params.mode4SP[config / 2][config % 2];
+            case 5:
+                return params.mode5SP[config];
+            case 6:
+                return params.mode6SP;
+            default:
+                assert(mode == 7);
+                return params.mode7SP[config];
+            }
+        }
+
+        // Returns params with every mode configuration disabled
+        static BC7FineTuningParams MakeEmptyParams()
+        {
+            BC7FineTuningParams params = BC7FineTuningParams();
+            for (int mode = 0; mode < kNumModes; mode++)
+            {
+                for (int config = 0; config < g_numConfigs[mode]; config++)
+                    GetSeedPoints(params, mode, config) = 0;
+            }
+            return params;
+        }
+
+        static void AddCandidates(std::vector<Candidate> &candidates, int mode)
+        {
+            for (int config = 0; config < g_numConfigs[mode]; config++)
+            {
+                for (int seedPoints = 1; seedPoints <= kMaxSeedPoints; seedPoints++)
+                {
+                    Candidate candidate;
+                    candidate.m_mode = static_cast<uint8_t>(mode);
+                    candidate.m_config = static_cast<uint8_t>(config);
+                    candidate.m_seedPoints = static_cast<uint8_t>(seedPoints);
+                    candidates.push_back(candidate);
+                }
+            }
+        }
+
+        static float ComputeBlockError(const PixelBlockU8 &original, const PixelBlockU8 &decoded, const float channelWeights[4])
+        {
+            float error = 0.0f;
+            for (int px = 0; px < 16; px++)
+            {
+                for (int ch = 0; ch < 4; ch++)
+                {
+                    const float diff = static_cast<float>(static_cast<int>(original.m_pixels[px][ch]) - static_cast<int>(decoded.m_pixels[px][ch]));
+                    error += diff * diff * channelWeights[ch];
+                }
+            }
+            return error;
+        }
+    }
+}
+
+uint32_t cvtt::Kernels::EstimateBC7EncodingPlanWork(const BC7EncodingPlan &encodingPlan)
+{
+    uint32_t work = 0;
+
+    for (int i = 0; i < encodingPlan.rgbNumShapesToEvaluate; i++)
+        work += encodingPlan.seedPointsForShapeRGB[encodingPlan.rgbShapeList[i]];
+
+    for (int i = 0; i < encodingPlan.rgbaNumShapesToEvaluate; i++)
+        work += encodingPlan.seedPointsForShapeRGBA[encodingPlan.rgbaShapeList[i]];
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        for (int indexSelector = 0; indexSelector < 2; indexSelector++)
+            work += encodingPlan.mode4SP[rotation][indexSelector] * BC7Training::kDualPlaneWorkPerSeedPoint;
+
+        work += encodingPlan.mode5SP[rotation] * BC7Training::kDualPlaneWorkPerSeedPoint;
+    }
+
+    return work;
+}
+
+bool cvtt::Kernels::TrainBC7FineTuningParams(BC7FineTuningParams &outParams, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, uint32_t workBudget)
+{
+    using namespace BC7Training;
+
+    if (pBlocks == NULL || numBlocks == 0)
+        return false;
+
+    Options trainingOptions = options;
+    trainingOptions.stats = NULL;
+
+    const float channelWeights[4] = { options.redWeight, options.greenWeight, options.blueWeight, options.alphaWeight };
+
+    std::vector<Candidate> candidates;
+    for (int mode = 0; mode < kNumModes; mode++)
+        AddCandidates(candidates, mode);
+
+    const size_t numCandidates = candidates.size();
+
+    // Encode the samples with each candidate on its own
+    std::vector<float> candidateErrors(numCandidates * numBlocks);
+    std::vector<uint8_t> encoded(numBlocks * 16);
+    std::vector<PixelBlockU8> decoded(numBlocks);
+
+    for (size_t candidateIndex = 0; candidateIndex < numCandidates; candidateIndex++)
+    {
+        const Candidate &candidate = candidates[candidateIndex];
+
+        BC7FineTuningParams params = MakeEmptyParams();
+        GetSeedPoints(params, candidate.m_mode, candidate.m_config) = candidate.m_seedPoints;
+
+        BC7EncodingPlan plan;
+        ConfigureBC7EncodingPlanFromFineTuningParams(plan, params);
+
+        EncodeBC7Batch(&encoded[0], pBlocks, numBlocks, trainingOptions, plan);
+
+        DecodeBC7Batch(&decoded[0], &encoded[0], numBlocks);
+
+        float *errors = &candidateErrors[candidateIndex * numBlocks];
+        for (size_t block = 0; block < numBlocks; block++)
+            errors[block] = ComputeBlockError(pBlocks[block], decoded[block], channelWeights);
+    }
+
+    // Start from the worst result for each block, then greedily add whichever candidate removes the most error for the
+    // work it adds until nothing else fits in the budget.  The first candidate is always added even if it doesn't fit.
+    std::vector<float> bestErrors(numBlocks, 0.0f);
+    for (size_t candidateIndex = 0; candidateIndex < numCandidates; candidateIndex++)
+    {
+        const float *errors = &candidateErrors[candidateIndex * numBlocks];
+        for (size_t block = 0; block < numBlocks; block++)
+            bestErrors[block] = std::max(bestErrors[block], errors[block]);
+    }
+
+    BC7FineTuningParams selected = MakeEmptyParams();
+
+    uint32_t work = 0;
+    bool anySelected = false;
+
+    for (;;)
+    {
+        size_t bestCandidateIndex = numCandidates;
+        double bestScore = 0.0;
+        uint32_t bestWork = 0;
+
+        for (size_t candidateIndex = 0; candidateIndex < numCandidates; candidateIndex++)
+        {
+            const Candidate &candidate = candidates[candidateIndex];
+            if (candidate.m_seedPoints <= GetSeedPoints(selected, candidate.m_mode, candidate.m_config))
+                continue;
+
+            BC7FineTuningParams trialParams = selected;
+            GetSeedPoints(trialParams, candidate.m_mode, candidate.m_config) = candidate.m_seedPoints;
+
+            BC7EncodingPlan trialPlan;
+            ConfigureBC7EncodingPlanFromFineTuningParams(trialPlan, trialParams);
+
+            const uint32_t trialWork = EstimateBC7EncodingPlanWork(trialPlan);
+            if (trialWork > workBudget && anySelected)
+                continue;
+
+            const float *errors = &candidateErrors[candidateIndex * numBlocks];
+            double errorRemoved = 0.0;
+            for (size_t block = 0; block < numBlocks; block++)
+            {
+                if (errors[block] < bestErrors[block])
+                    errorRemoved += bestErrors[block] - errors[block];
+            }
+
+            if (errorRemoved <= 0.0)
+                continue;
+
+            // Candidates whose shapes are already evaluated at enough seed points are nearly free
+            const double score = errorRemoved / static_cast<double>(std::max<uint32_t>(trialWork - work, 1));
+            if (score > bestScore)
+            {
+                bestScore = score;
+                bestCandidateIndex = candidateIndex;
+                bestWork = trialWork;
+            }
+        }
+
+        if (bestCandidateIndex == numCandidates)
+            break;
+
+        const Candidate &candidate = candidates[bestCandidateIndex];
+        GetSeedPoints(selected, candidate.m_mode, candidate.m_config) = candidate.m_seedPoints;
+        work = bestWork;
+        anySelected = true;
+
+        const float *errors = &candidateErrors[bestCandidateIndex * numBlocks];
+        for (size_t block = 0; block < numBlocks; block++)
+            bestErrors[block] = std::min(bestErrors[block], errors[block]);
+    }
+
+    outParams = selected;
+    return anySelected;
+}
+
+#endif
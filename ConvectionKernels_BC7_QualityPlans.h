@@ -0,0 +1,1311 @@
+#pragma once
+#include <stdint.h>
+
+// This file is generated by MakeBC7QualityPlans.  Do not edit this file manually.
+
+namespace cvtt { namespace Tables { namespace BC7QualityPlans {
+    const int g_numQualityLevels = 100;
+    const uint8_t g_serializedPlans[100][250] =
+    {
+        // Quality 1
+        {
+            67,86,80,55,1,0,250,0,10,2,67,32,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,1,0,0,0,0,0,1,0,0,0,0,1,16,0,0,1,1,0,0,0,0,1,0,0,
+            0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,1,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,16,16,
+            0,0,0,0,1,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,1,0,0,0,0,0,
+            0,0,0,0,0,0,16,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        },
+        // Quality 2
+        {
+            67,86,80,55,1,0,250,0,10,234,199,224,1,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,32,0,0,0,0,0,0,
+            1,1,0,1,0,0,0,1,0,0,0,0,1,16,1,1,1,1,0,0,16,0,17,1,16,
+            0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,16,0,16,0,1,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,16,1,0,1,0,0,16,16,
+            0,0,1,0,1,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            16,16,1,0,0,0,0,0,0,0,16,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,0,0,16,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        },
+        // Quality 3
+        {
+            67,86,80,55,1,0,250,0,10,239,199,229,201,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,32,0,0,0,0,0,0,1,32,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+            1,2,0,1,0,0,0,1,1,0,0,0,1,16,1,1,1,17,0,0,17,0,17,1,16,
+            0,0,16,0,16,0,0,1,0,0,0,0,0,0,0,0,0,16,1,16,0,1,16,0,0,
+            0,0,0,0,0,0,0,0,16,0,0,1,0,1,0,0,1,16,1,0,17,0,0,17,16,
+            0,0,1,0,1,0,0,0,0,16,0,1,0,0,0,0,0,0,0,0,0,0,0,16,0,
+            16,16,1,0,0,0,0,0,0,0,16,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,0,0,16,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        },
+        // Quality 4
+        {
+            67,86,80,55,1,0,250,0,10,239,207,231,249,36,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,32,0,0,0,0,0,0,1,32,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+            2,3,0,1,0,0,0,1,1,0,0,0,1,16,1,1,2,17,0,0,17,0,17,1,17,
+            0,0,16,0,32,0,0,1,0,0,0,0,0,16,0,0,0,16,1,16,0,1,16,1,0,
+            0,0,1,0,0,0,0,0,16,0,0,2,0,1,0,0,17,16,17,0,17,0,0,17,32,
+            16,16,1,0,1,0,0,0,0,16,0,1,0,0,0,0,0,0,0,0,0,0,0,16,0,
+            16,16,1,0,0,0,0,0,0,0,16,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,0,0,16,0,0,0,2,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        },
+        // Quality 5
+        {
+            67,86,80,55,1,0,250,0,27,239,207,239,249,36,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,32,0,0,0,0,0,0,65,160,0,0,0,0,0,0,65,128,0,0,0,0,0,0,
+            2,3,1,1,0,0,0,1,1,0,0,1,1,32,1,1,2,17,0,0,17,0,17,1,17,
+            0,1,16,0,32,0,0,1,0,0,0,0,0,16,0,0,0,16,1,16,0,1,16,1,0,
+            0,0,1,0,0,0,0,0,16,0,0,2,0,1,16,0,17,16,18,0,17,0,0,17,32,
+            16,16,1,0,1,0,0,0,0,16,0,2,1,0,0,0,0,0,1,0,0,0,0,32,0,
+            16,16,1,0,0,0,1,0,0,0,16,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,1,0,16,0,1,0,2,0,0,1,1,0,0,0,0,16,0,0,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,16,16,0,0,0,
+        },
+        // Quality 6
+        {
+            67,86,80,55,1,0,250,0,59,239,223,255,255,36,0,0,0,0,0,0,0,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,193,224,0,0,0,0,0,0,192,192,0,0,0,0,0,0,
+            2,3,1,1,0,0,1,1,1,0,0,1,1,32,17,17,3,17,0,0,17,0,17,2,17,
+            0,1,16,0,32,0,16,1,0,0,0,0,0,16,0,0,16,16,1,16,0,2,16,1,1,
+            0,0,1,0,0,0,0,0,16,1,0,2,0,1,16,0,17,16,18,0,17,0,0,17,48,
+            17,17,1,0,1,0,0,0,0,17,0,2,1,0,0,0,0,0,1,0,0,0,0,32,0,
+            16,16,2,0,0,0,1,0,0,0,32,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,1,0,16,0,1,0,18,0,0,1,1,0,0,0,0,16,0,16,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,0,0,0,16,16,0,0,1,
+        },
+        // Quality 7
+        {
+            67,86,80,55,1,0,250,0,187,239,255,255,255,39,0,0,0,0,0,0,0,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,193,224,8,0,0,0,0,0,192,192,8,0,0,0,0,0,
+            3,3,1,1,0,0,1,1,1,0,0,1,1,48,17,17,19,33,0,16,17,0,17,2,17,
+            0,1,16,1,48,0,16,1,0,0,0,0,0,16,0,0,16,16,1,16,0,2,16,1,1,
+            0,0,1,0,0,0,0,0,16,1,0,3,16,1,16,0,17,16,19,0,17,1,0,18,49,
+            17,17,1,16,1,0,0,0,0,17,0,3,1,0,0,0,0,0,1,0,0,0,0,48,0,
+            16,16,2,0,0,0,1,0,0,0,32,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,1,0,16,0,1,0,19,0,0,1,1,0,0,1,0,16,0,16,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,1,0,16,0,0,16,16,0,0,1,
+        },
+        // Quality 8
+        {
+            67,86,80,55,1,0,250,0,187,239,255,255,255,39,0,0,0,0,0,0,0,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,197,224,8,0,0,0,0,0,196,192,8,0,0,0,0,0,
+            3,3,1,1,0,0,1,1,1,0,0,1,1,64,18,17,19,33,0,16,33,0,33,3,18,
+            0,1,16,1,48,0,16,1,0,0,0,0,0,16,0,0,16,16,1,32,0,3,16,1,1,
+            0,0,1,0,0,0,0,0,16,1,0,3,16,1,16,0,34,16,19,0,18,1,0,18,65,
+            17,17,2,16,1,0,0,0,0,17,0,4,1,0,0,0,0,0,1,0,0,0,0,48,0,
+            16,32,3,0,0,0,1,0,0,0,48,0,0,0,0,16,0,0,16,1,0,0,0,0,0,
+            0,0,0,0,1,0,16,0,1,0,19,0,0,2,1,0,0,1,0,16,1,16,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,1,16,1,0,16,0,0,16,32,0,0,1,
+        },
+        // Quality 9
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,39,8,0,0,0,0,0,0,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,199,224,40,0,0,0,0,0,198,192,40,0,0,0,0,0,
+            3,4,1,1,0,0,1,1,1,1,0,1,1,64,18,18,20,33,0,16,33,0,33,3,18,
+            0,1,16,1,48,1,16,1,0,0,0,0,0,16,0,0,16,32,1,32,0,3,16,1,1,
+            0,0,1,0,0,0,0,0,16,1,16,3,16,1,16,0,34,32,20,0,18,1,0,18,65,
+            17,17,2,16,1,0,1,0,0,17,0,4,1,0,0,0,0,0,1,0,0,0,0,64,0,
+            16,32,3,0,0,0,17,0,0,0,48,0,0,0,0,16,0,0,32,1,0,0,0,0,0,
+            0,0,0,0,17,0,16,0,1,0,19,0,0,2,1,0,0,1,0,16,1,16,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,16,0,16,0,1,0,1,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,1,16,1,0,16,0,0,16,32,0,0,1,
+        },
+        // Quality 10
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,39,8,0,0,0,0,0,3,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,199,228,40,0,0,0,0,0,198,196,40,0,0,0,0,0,
+            3,4,1,1,0,1,1,2,1,1,0,1,1,64,18,18,20,34,0,16,34,0,33,4,34,
+            0,1,16,1,64,1,16,1,0,0,0,0,0,16,0,0,16,32,2,32,0,4,32,1,1,
+            0,0,1,0,0,0,0,0,16,1,16,4,16,1,16,0,34,32,20,0,34,1,0,34,65,
+            17,17,2,16,1,0,1,0,0,17,0,4,1,0,0,0,0,0,1,0,0,0,0,64,0,
+            16,32,4,0,0,0,17,0,16,0,64,0,0,0,0,16,0,0,32,1,0,0,0,0,0,
+            0,0,0,1,17,0,16,0,1,0,19,0,0,2,17,0,0,1,0,16,1,16,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,16,0,16,0,1,0,1,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,1,16,1,0,16,0,0,17,32,0,0,1,
+        },
+        // Quality 11
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,119,8,0,0,0,0,0,3,0,0,0,0,
+            0,1,32,0,0,0,0,0,0,207,228,40,0,0,0,0,0,206,196,40,0,0,0,0,0,
+            3,4,1,1,0,1,1,2,1,1,0,1,1,64,19,19,20,34,0,16,34,0,34,4,34,
+            16,1,16,1,64,1,16,1,0,0,0,0,0,16,0,0,16,49,2,32,0,4,32,18,1,
+            0,0,1,0,0,0,0,0,16,1,16,4,16,1,16,1,35,32,36,0,34,1,0,34,65,
+            17,17,2,16,1,0,1,0,0,33,0,4,1,0,0,0,0,0,1,0,0,0,0,64,0,
+            32,48,4,0,0,0,17,0,16,0,64,0,0,0,0,16,0,0,48,1,0,0,0,0,0,
+            0,0,0,1,17,0,32,0,1,0,20,0,0,3,17,0,0,1,0,16,1,17,0,0,0,
+            0,16,0,0,0,0,0,0,0,0,0,0,0,0,16,0,16,0,1,0,1,0,0,0,0,
+            0,0,0,0,0,0,0,0,1,0,0,0,0,17,16,1,0,16,0,0,17,48,0,0,1,
+        },
+        // Quality 12
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,119,8,0,0,32,0,0,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,229,41,0,0,0,0,0,206,197,41,0,0,0,0,0,
+            3,4,1,1,0,1,1,2,2,1,0,1,1,64,20,19,20,34,0,16,34,16,34,4,34,
+            16,1,16,1,64,1,16,1,0,0,0,0,0,32,0,0,16,49,2,32,0,4,32,18,1,
+            0,0,2,0,0,0,0,0,16,1,16,4,16,1,16,1,36,32,36,1,34,1,0,34,65,
+            17,17,2,32,2,0,1,0,0,49,0,4,1,0,0,0,0,0,1,0,0,0,0,64,0,
+            48,64,4,0,0,0,18,0,16,0,64,0,0,0,0,32,0,1,48,2,0,0,0,0,0,
+            0,0,0,1,18,0,48,0,1,0,20,0,0,3,17,0,0,17,0,16,1,17,0,0,0,
+            0,16,0,0,1,0,0,0,0,0,0,0,0,0,16,0,16,0,1,0,1,0,0,0,0,
+            0,0,0,0,0,16,0,0,1,0,0,0,0,17,16,1,0,17,0,0,17,48,0,0,1,
+        },
+        // Quality 13
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,119,8,0,0,32,0,0,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,231,169,0,0,0,0,0,206,199,169,0,0,0,0,0,
+            3,4,1,2,0,1,1,2,2,1,0,1,1,64,20,20,20,50,0,16,34,16,34,4,34,
+            16,2,16,1,64,1,16,1,0,0,0,0,0,32,0,0,16,65,2,32,0,4,32,18,1,
+            0,0,2,0,0,0,0,0,16,1,16,4,16,1,32,1,36,32,36,1,34,1,0,35,65,
+            17,17,3,32,2,0,1,0,0,50,0,4,2,0,0,0,0,0,2,0,0,0,0,64,0,
+            48,64,4,0,0,0,18,0,16,0,64,0,0,0,0,32,0,1,64,2,0,0,0,0,0,
+            0,0,0,1,18,0,48,0,2,0,20,1,0,3,17,0,0,17,0,16,1,17,0,0,0,
+            0,32,0,0,1,0,0,0,0,0,0,0,0,0,16,1,16,0,1,16,1,0,0,0,0,
+            0,0,0,0,0,16,0,0,2,0,0,0,0,17,16,1,0,17,0,0,17,48,0,16,1,
+        },
+        // Quality 14
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,127,8,0,0,48,0,0,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,231,249,0,0,0,0,0,206,199,249,0,0,0,0,0,
+            3,4,1,2,0,1,1,3,2,1,0,1,1,64,36,20,20,50,0,16,34,16,50,4,34,
+            16,2,16,1,65,17,16,1,0,0,0,0,0,32,0,0,32,65,2,48,0,4,32,18,2,
+            0,0,2,0,0,0,0,0,16,1,17,20,16,1,32,1,36,32,36,1,34,1,0,35,65,
+            17,18,3,32,3,0,1,0,0,51,0,4,2,0,0,0,0,0,2,0,0,0,0,64,0,
+            48,64,4,0,0,0,18,0,16,0,64,0,0,0,0,48,0,1,64,3,0,0,0,0,0,
+            0,0,0,1,19,0,48,0,2,0,20,1,1,3,17,0,0,17,0,16,1,17,0,0,16,
+            0,32,0,0,1,0,0,0,0,0,0,0,0,0,16,1,16,0,1,16,1,0,0,0,0,
+            0,0,0,0,0,16,0,0,2,0,1,0,0,17,16,1,0,17,0,0,17,48,16,16,1,
+        },
+        // Quality 15
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,8,0,0,48,0,0,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,231,249,0,0,0,0,0,206,199,249,0,0,0,0,0,
+            4,4,1,2,0,1,1,3,2,1,1,1,1,64,36,36,20,50,0,16,50,16,51,4,35,
+            16,2,16,1,65,17,16,17,0,0,0,0,0,32,0,0,32,65,2,48,0,4,32,18,2,
+            0,0,2,0,0,0,0,0,17,1,17,20,16,1,32,1,52,48,36,1,35,1,0,35,65,
+            18,18,3,48,3,0,2,0,0,51,0,4,2,0,0,0,0,0,2,0,0,0,0,64,0,
+            48,64,4,0,0,0,35,0,16,0,64,0,0,0,0,48,0,1,64,3,0,0,0,0,0,
+            0,0,0,1,35,0,48,0,2,0,20,1,1,4,17,0,0,17,0,16,1,17,0,0,16,
+            0,32,0,0,1,0,0,0,0,0,0,0,0,0,16,1,16,0,1,16,1,0,0,0,0,
+            0,0,0,0,0,16,0,0,2,0,1,0,0,17,16,1,0,17,0,0,17,64,16,16,1,
+        },
+        // Quality 16
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,10,0,0,112,0,0,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,247,249,32,0,0,0,0,206,215,249,32,0,0,0,0,
+            4,4,1,2,0,1,1,3,2,1,1,1,1,64,36,36,36,50,0,16,50,17,51,4,35,
+            16,2,16,1,65,17,32,17,0,0,0,0,0,32,0,0,32,65,3,49,0,20,48,18,2,
+            0,0,2,0,0,0,0,0,17,2,17,20,16,1,32,1,52,48,36,17,35,1,0,35,66,
+            18,18,3,48,3,0,2,0,0,51,0,4,2,0,0,0,0,0,2,0,0,0,0,64,0,
+            48,64,4,0,0,0,36,0,16,0,64,0,0,0,0,48,0,1,64,3,0,0,0,0,0,
+            0,0,0,1,36,0,48,0,2,0,20,17,1,4,17,0,0,17,0,17,1,17,0,0,16,
+            0,48,0,0,1,0,0,0,0,0,0,0,0,0,16,1,16,0,1,16,1,0,0,0,0,
+            0,0,0,0,0,16,0,0,3,0,1,0,0,17,16,17,0,17,0,0,17,64,16,17,1,
+        },
+        // Quality 17
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,10,0,16,248,0,4,3,0,0,0,0,
+            128,1,32,0,0,0,0,0,0,207,255,253,32,0,0,0,0,206,223,253,32,0,0,0,0,
+            4,4,1,3,0,1,1,3,2,1,1,1,1,64,36,36,36,50,0,32,50,17,51,20,35,
+            16,18,32,1,65,17,33,17,0,0,0,0,0,32,0,0,32,65,3,49,0,20,48,18,2,
+            0,0,2,0,0,0,0,0,17,18,17,20,16,2,33,1,52,49,36,17,35,2,0,35,66,
+            18,18,3,64,3,0,2,0,0,67,0,4,3,0,0,0,0,0,3,0,0,0,0,64,0,
+            64,64,4,0,0,0,36,0,16,0,64,0,0,0,0,48,0,1,64,3,0,0,0,0,0,
+            0,0,0,1,36,0,64,0,3,0,20,17,1,4,17,0,0,17,0,17,1,17,0,1,16,
+            0,48,0,0,1,0,0,0,0,0,0,0,0,16,16,1,16,0,1,16,1,1,0,0,0,
+            0,0,0,0,0,16,0,0,3,0,1,16,0,17,16,17,0,17,0,0,17,64,16,17,1,
+        },
+        // Quality 18
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,10,0,16,248,0,4,3,0,0,0,0,
+            128,1,160,0,0,0,0,0,0,223,255,253,32,0,0,0,0,222,95,253,32,0,0,0,0,
+            4,4,1,3,0,1,1,3,2,1,1,1,1,64,36,36,36,51,0,32,50,17,52,20,51,
+            16,18,32,1,65,17,33,18,0,0,0,0,0,48,0,0,32,65,3,49,0,20,48,18,2,
+            0,0,2,0,0,0,0,0,33,18,17,20,16,2,33,1,52,49,36,17,35,2,0,51,66,
+            18,18,4,64,4,0,2,0,0,68,0,4,3,0,0,0,0,0,3,0,0,0,0,64,0,
+            64,64,4,0,0,0,36,0,16,0,64,0,0,0,0,64,0,1,64,4,0,0,0,0,0,
+            0,0,0,1,36,0,64,0,3,0,36,17,1,4,17,0,0,17,0,33,1,17,0,1,16,
+            0,48,0,16,1,0,0,0,0,0,0,0,0,16,16,1,16,0,1,16,1,1,0,0,0,
+            0,0,0,0,0,16,1,0,3,0,1,16,0,17,16,18,0,17,0,0,17,64,16,17,2,
+        },
+        // Quality 19
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,0,16,249,0,5,7,0,0,0,0,
+            128,1,160,0,0,0,0,0,0,255,255,255,34,0,0,0,0,254,95,255,34,0,0,0,0,
+            4,4,1,3,0,1,1,3,2,1,1,1,1,64,36,36,36,67,0,32,50,17,52,20,51,
+            16,18,32,1,65,17,33,18,0,0,16,0,0,48,0,0,33,65,3,49,0,20,48,18,18,
+            0,0,2,0,0,1,0,0,33,18,17,20,16,2,33,1,52,49,36,17,35,2,0,52,66,
+            18,34,4,64,4,0,3,0,0,68,0,4,3,0,0,0,0,0,3,0,0,0,0,64,0,
+            64,64,4,0,0,0,52,1,16,0,64,0,0,0,0,64,0,1,64,4,0,0,0,0,0,
+            0,0,0,1,52,1,64,0,3,0,36,17,17,20,17,0,0,17,0,33,1,17,0,1,16,
+            1,48,0,16,1,0,0,0,0,0,0,0,0,16,16,1,16,0,1,16,1,1,0,0,0,
+            0,0,0,0,0,16,1,0,3,16,1,16,0,17,16,18,0,17,0,0,17,65,17,17,2,
+        },
+        // Quality 20
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,0,16,249,0,5,7,0,0,0,0,
+            128,1,160,0,0,0,0,0,0,255,255,255,39,0,0,0,0,254,95,255,39,0,0,0,0,
+            4,4,1,3,0,1,1,3,3,1,1,1,1,64,36,36,36,67,0,32,51,17,68,20,51,
+            16,18,32,2,65,17,33,18,0,0,16,0,0,64,0,0,33,65,3,49,0,20,48,18,18,
+            0,0,2,0,0,1,0,0,33,18,17,20,32,2,33,1,52,49,52,17,51,2,0,52,66,
+            18,34,4,64,4,0,3,0,0,68,0,4,4,0,0,0,0,0,4,0,0,0,0,64,0,
+            64,64,4,0,0,0,52,1,16,0,64,0,0,0,0,64,0,1,64,4,0,0,0,0,0,
+            0,0,0,1,52,1,64,0,4,0,36,17,17,20,17,0,16,17,0,33,1,17,0,1,16,
+            1,48,0,16,1,0,0,0,0,0,16,0,0,16,16,1,16,0,1,16,1,1,0,0,1,
+            0,0,0,0,0,16,1,0,3,16,1,16,0,17,16,18,0,17,1,0,17,65,17,17,2,
+        },
+        // Quality 21
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,0,16,253,0,37,7,0,0,0,0,
+            128,5,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,250,31,255,39,0,0,0,0,
+            4,4,1,3,0,1,1,3,3,1,1,1,1,64,36,36,36,67,0,32,51,17,68,20,52,
+            16,18,32,2,65,17,33,18,0,0,16,0,0,64,0,0,33,65,3,65,17,20,48,19,18,
+            0,0,2,0,0,1,0,0,33,18,17,20,32,2,33,1,68,49,52,17,51,2,0,52,66,
+            18,34,4,64,4,0,4,0,0,68,0,4,4,0,0,0,0,0,4,0,0,0,0,64,0,
+            64,64,4,0,0,0,68,1,16,0,64,0,0,0,0,64,0,1,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,0,4,0,36,17,17,20,17,0,16,17,0,33,2,17,0,1,16,
+            1,48,0,16,1,0,0,0,0,0,16,0,0,16,16,1,32,0,2,16,1,1,0,0,1,
+            0,0,0,0,0,16,1,0,3,16,1,16,0,17,32,18,0,17,1,0,17,65,17,17,2,
+        },
+        // Quality 22
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,80,253,0,45,15,0,0,0,0,
+            128,5,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,250,31,255,39,0,0,0,0,
+            4,4,2,3,0,1,1,3,3,1,1,1,1,64,36,36,36,67,0,33,67,17,68,20,52,
+            16,18,32,2,65,17,33,18,1,0,16,0,0,64,0,0,33,65,3,65,17,20,48,19,18,
+            0,0,2,0,0,1,0,16,33,18,17,20,32,2,33,1,68,65,52,17,52,18,0,52,66,
+            34,34,4,64,4,0,4,0,0,68,0,4,4,16,0,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,0,1,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,0,4,0,36,17,17,20,17,0,16,17,0,34,2,17,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,16,1,32,0,2,16,1,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,17,32,34,0,17,1,0,17,65,17,17,2,
+        },
+        // Quality 23
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,112,253,0,45,47,0,0,0,0,
+            192,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,0,1,1,3,3,1,1,1,1,64,36,36,36,67,0,33,67,17,68,20,52,
+            16,18,32,2,65,18,33,18,1,0,16,0,0,64,0,16,33,65,4,65,17,20,64,19,18,
+            1,0,3,0,0,1,0,16,33,18,33,20,32,2,33,1,68,65,52,17,52,18,0,52,66,
+            34,34,20,65,4,0,20,0,0,68,0,4,4,16,0,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,1,1,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,0,4,0,52,17,17,20,18,0,16,17,0,34,2,33,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,16,1,32,0,2,16,1,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,18,32,34,0,17,1,0,33,65,17,17,3,
+        },
+        // Quality 24
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,112,255,0,45,63,2,0,0,0,
+            192,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,0,1,1,4,3,1,1,1,1,64,36,36,36,68,0,33,68,17,68,20,68,
+            16,18,32,2,66,18,33,19,1,0,16,0,16,64,0,16,33,65,4,65,17,20,64,19,18,
+            1,0,3,1,0,1,0,16,49,18,33,36,32,2,33,1,68,65,68,17,68,18,0,68,66,
+            34,34,20,65,4,0,20,0,0,68,1,4,4,16,1,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,1,1,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,1,4,1,52,17,17,20,18,0,16,17,0,50,2,33,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,1,32,0,2,16,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,18,32,35,0,17,1,0,33,65,17,17,3,
+        },
+        // Quality 25
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,112,255,0,45,63,2,0,0,0,
+            192,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,0,2,2,4,3,1,1,1,1,64,52,36,36,68,0,33,68,33,68,36,68,
+            16,19,32,2,66,18,33,19,1,0,16,0,16,64,0,16,33,66,4,65,17,20,64,36,18,
+            1,0,3,1,0,1,0,16,49,18,33,36,32,2,49,1,68,66,68,18,68,18,0,68,66,
+            34,35,20,65,4,0,20,0,0,68,1,4,4,16,1,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,1,1,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,1,4,1,52,17,17,20,18,0,16,18,0,51,2,33,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,1,32,0,2,16,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,18,32,51,0,33,1,0,33,65,17,17,3,
+        },
+        // Quality 26
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,112,255,0,45,63,2,0,0,0,
+            192,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,0,2,2,4,3,1,1,1,1,64,52,36,36,68,0,33,68,34,68,36,68,
+            32,19,32,2,66,18,33,19,1,0,16,0,16,64,0,16,49,66,4,66,17,36,64,36,19,
+            1,0,3,1,0,1,0,16,49,18,33,36,32,2,49,2,68,66,68,34,68,18,0,68,66,
+            34,35,20,65,4,0,20,0,0,68,1,4,4,16,1,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,1,2,64,4,0,0,0,0,0,
+            0,0,0,1,68,1,64,1,4,1,52,17,17,20,34,0,16,18,0,52,2,33,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,1,48,0,3,16,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,18,32,67,0,33,1,0,34,65,17,17,3,
+        },
+        // Quality 27
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,240,255,0,45,63,2,0,0,0,
+            192,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,1,2,2,4,3,1,1,1,1,64,52,52,52,68,0,33,68,34,68,36,68,
+            32,20,32,2,66,18,33,19,1,0,16,0,16,65,0,16,49,66,4,66,17,36,64,36,19,
+            1,0,19,1,0,1,0,16,49,18,33,36,32,2,65,2,68,66,68,34,68,18,0,68,67,
+            35,35,20,65,4,0,20,0,0,68,1,4,4,16,1,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,0,0,64,1,2,64,4,0,0,0,0,0,
+            0,0,0,2,68,1,64,1,4,1,52,17,17,20,34,0,16,18,0,52,3,49,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,1,48,0,3,16,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,19,48,67,0,33,1,0,34,65,17,17,3,
+        },
+        // Quality 28
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,128,240,255,0,45,63,2,0,0,0,
+            200,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,1,2,2,4,3,1,1,2,1,64,52,52,52,68,0,49,68,34,68,36,68,
+            32,20,32,3,66,34,49,19,1,0,16,0,16,65,0,16,49,66,4,66,17,36,64,36,19,
+            1,0,20,1,0,1,0,16,49,19,34,36,48,2,65,2,68,66,68,34,68,19,0,68,67,
+            35,51,20,65,4,0,20,0,0,68,1,4,4,16,1,0,0,0,4,0,0,0,1,64,0,
+            64,64,4,0,0,0,68,1,32,0,64,0,0,1,0,64,1,2,64,20,0,0,0,0,0,
+            0,0,0,2,68,1,64,1,4,1,52,17,17,20,34,0,16,34,0,52,3,50,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,1,48,0,3,16,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,35,48,67,0,34,1,0,34,65,17,17,3,
+        },
+        // Quality 29
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,129,240,255,0,45,63,2,1,0,0,
+            216,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,0,248,31,255,39,0,0,0,0,
+            4,4,2,3,1,2,2,4,3,1,1,2,1,64,68,52,52,68,0,49,68,34,68,36,68,
+            32,20,32,3,66,34,49,19,1,0,32,0,16,65,0,16,65,66,20,66,17,36,65,36,20,
+            1,0,20,1,0,2,0,16,49,19,34,36,48,2,65,2,68,66,68,34,68,19,0,68,67,
+            35,52,20,65,4,0,20,1,0,68,1,4,4,16,1,0,0,16,4,0,0,0,1,64,0,
+            65,64,4,0,0,0,68,1,32,0,64,0,0,1,0,64,17,2,64,20,0,0,0,0,0,
+            0,0,0,2,68,1,64,1,4,1,52,33,17,20,35,0,16,34,0,52,3,50,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,2,48,0,3,32,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,35,48,67,0,34,1,0,50,65,17,18,3,
+        },
+        // Quality 30
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,129,240,255,0,45,63,3,1,0,0,
+            216,7,224,0,0,0,0,0,0,255,255,255,39,0,0,0,32,248,31,255,39,0,0,0,32,
+            4,4,3,4,1,2,2,4,3,1,1,2,1,64,68,68,68,68,0,49,68,34,68,36,68,
+            32,36,48,3,66,34,65,35,1,0,32,0,16,65,0,16,65,66,20,66,17,36,65,36,20,
+            1,0,20,1,0,2,0,16,50,20,34,36,48,3,66,2,68,66,68,34,68,19,0,68,68,
+            52,52,20,65,4,0,20,1,0,68,1,4,4,16,1,0,0,16,4,0,16,0,1,64,0,
+            65,64,4,0,0,0,68,1,48,0,64,0,0,1,0,64,17,2,64,20,0,0,0,0,0,
+            0,0,0,2,68,1,64,17,4,1,52,33,17,20,35,0,16,34,16,52,3,50,0,1,16,
+            1,64,0,16,1,0,0,0,0,0,16,0,0,16,32,2,48,0,3,32,2,1,0,0,1,
+            0,0,0,0,0,16,1,0,4,16,1,16,0,35,48,67,1,34,1,0,50,65,17,18,3,
+        },
+        // Quality 31
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,131,240,255,0,45,255,3,1,0,0,
+            216,7,228,0,0,0,0,0,0,255,255,255,39,0,0,0,32,248,27,255,39,0,0,0,32,
+            4,4,3,4,1,2,2,4,3,1,1,2,1,64,68,68,68,68,0,65,68,34,68,36,68,
+            33,36,48,4,66,34,65,35,1,0,32,0,16,65,0,16,65,66,20,66,34,36,65,36,20,
+            1,0,20,1,0,2,0,16,50,20,34,36,64,3,66,18,68,66,68,34,68,20,0,68,68,
+            52,52,20,65,4,0,20,1,0,68,1,4,4,16,1,0,0,16,4,0,16,0,1,64,16,
+            65,64,20,0,0,0,68,2,48,0,65,0,0,1,0,64,17,18,64,20,0,0,0,0,0,
+            0,0,0,2,68,2,64,17,4,1,52,33,17,20,51,0,16,34,16,52,3,50,0,1,32,
+            1,64,0,16,2,0,0,0,0,0,16,0,0,16,32,2,48,0,3,32,2,1,0,0,1,
+            0,0,0,0,0,32,1,0,4,16,2,16,0,35,48,67,1,34,1,0,51,65,17,18,3,
+        },
+        // Quality 32
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,131,240,255,0,45,255,3,1,0,160,
+            218,7,228,0,32,0,0,0,0,255,255,255,39,0,0,0,32,248,27,255,7,0,0,0,32,
+            4,4,3,4,1,2,3,4,3,1,1,2,1,64,68,68,68,68,0,65,68,50,68,36,68,
+            33,36,48,4,67,34,65,35,1,0,32,0,16,65,0,16,65,66,20,66,34,36,65,36,20,
+            1,0,20,1,0,2,0,16,50,20,34,52,64,3,66,18,68,66,68,35,68,20,0,68,68,
+            52,52,20,65,4,0,20,1,0,68,1,4,4,32,1,0,0,17,4,0,16,16,2,64,16,
+            65,64,20,0,0,0,68,2,48,0,65,0,0,17,16,64,17,19,64,20,0,0,1,0,0,
+            1,0,0,2,68,2,64,17,4,1,52,34,17,20,51,0,16,34,16,52,3,50,0,1,32,
+            1,64,0,16,2,0,0,0,0,0,32,0,0,16,32,2,48,0,3,32,2,1,0,0,2,
+            0,0,0,0,0,32,1,0,4,16,2,16,0,35,48,67,1,34,1,0,51,65,17,34,3,
+        },
+        // Quality 33
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,11,227,240,255,0,45,255,3,1,0,160,
+            222,7,228,0,32,0,0,0,0,255,255,255,39,0,0,0,32,248,27,255,7,0,0,0,32,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,0,65,68,50,68,36,68,
+            33,36,48,4,67,35,65,36,1,16,32,0,16,65,1,16,66,66,20,66,34,36,65,36,36,
+            1,16,20,1,0,2,1,16,66,20,50,52,64,3,66,18,68,66,68,35,68,20,0,68,68,
+            52,68,20,65,4,0,20,1,0,68,1,4,4,33,1,0,0,17,4,0,16,16,2,64,16,
+            65,64,20,0,1,0,68,2,48,0,65,0,0,17,16,64,17,19,64,20,0,0,1,0,0,
+            1,0,0,2,68,2,64,17,4,1,52,34,17,20,51,0,16,35,16,52,3,50,0,1,32,
+            2,64,0,16,2,0,0,0,0,0,32,0,0,16,32,2,48,0,3,32,2,1,0,0,2,
+            0,0,0,0,0,32,1,0,4,32,2,16,0,35,48,67,1,50,1,0,51,65,17,34,3,
+        },
+        // Quality 34
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,240,255,0,45,255,3,1,0,160,
+            222,15,228,0,32,0,0,0,0,255,255,255,39,0,0,0,48,240,27,255,7,0,0,0,48,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,0,65,68,50,68,52,68,
+            33,36,48,20,67,35,65,36,17,17,32,0,16,65,1,16,66,67,20,67,34,52,65,52,36,
+            1,16,20,1,0,2,17,17,66,20,50,52,65,3,66,18,68,67,68,35,68,20,0,68,68,
+            52,68,20,65,4,0,20,1,0,68,1,4,4,33,1,0,0,17,4,0,16,16,2,64,16,
+            65,64,20,0,1,0,68,2,48,0,65,0,0,17,16,64,17,19,64,20,0,0,1,0,0,
+            1,0,0,2,68,2,64,17,4,1,52,34,17,20,51,0,32,35,16,52,3,50,0,2,32,
+            2,65,0,16,2,0,0,0,0,0,32,0,0,16,32,2,48,0,3,32,2,1,0,0,2,
+            0,0,0,0,0,32,1,0,20,32,2,32,0,35,48,67,1,50,2,0,51,65,17,34,3,
+        },
+        // Quality 35
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,249,255,0,109,255,3,1,0,160,
+            254,15,228,32,32,0,0,0,0,255,255,255,39,0,0,0,48,240,27,223,7,0,0,0,48,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,1,65,68,51,68,52,68,
+            33,36,49,20,67,35,66,36,17,17,32,0,32,65,1,16,66,67,20,67,34,52,65,52,36,
+            1,16,20,2,0,2,17,17,66,36,50,52,65,19,66,18,68,67,68,51,68,20,16,68,68,
+            52,68,20,65,4,0,20,1,0,68,1,20,4,33,1,0,0,17,4,0,16,16,2,64,17,
+            65,64,20,0,1,0,68,2,48,0,65,0,0,17,16,64,17,19,64,20,0,0,1,0,0,
+            1,0,0,3,68,2,64,17,4,1,52,34,33,20,51,0,32,35,16,52,3,50,0,2,32,
+            2,65,0,32,2,0,0,0,0,0,32,0,0,32,32,2,48,0,3,32,2,2,0,0,2,
+            0,0,0,0,0,32,2,0,20,32,2,32,0,35,48,67,1,50,2,0,51,65,18,34,3,
+        },
+        // Quality 36
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,251,255,0,109,255,3,17,0,160,
+            254,15,229,40,32,0,0,0,0,255,255,255,39,0,0,0,48,240,26,215,7,0,0,0,48,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,17,65,68,51,68,52,68,
+            49,36,65,20,67,35,66,36,17,17,32,0,32,65,1,16,66,67,20,67,34,52,65,52,36,
+            1,16,20,2,0,2,17,17,66,36,50,52,65,20,66,19,68,67,68,51,68,20,17,68,68,
+            68,68,20,65,4,0,20,1,0,68,1,20,4,33,1,0,0,17,4,0,16,16,2,64,17,
+            65,64,20,0,1,0,68,2,48,0,65,0,0,17,16,64,17,19,64,20,0,0,1,0,0,
+            1,0,0,3,68,2,64,17,4,1,52,34,33,36,51,0,32,51,16,52,3,51,0,2,32,
+            2,65,0,32,2,0,0,0,0,0,32,0,0,32,32,2,48,0,3,32,2,2,0,0,2,
+            0,0,0,0,0,32,2,0,20,32,2,32,0,51,48,67,1,51,2,0,51,66,18,34,3,
+        },
+        // Quality 37
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,251,255,0,109,255,3,19,0,160,
+            254,15,231,40,36,0,0,0,0,255,255,255,39,0,0,0,112,240,24,215,3,0,0,0,112,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,17,65,68,51,68,52,68,
+            49,36,65,20,68,35,66,36,17,17,32,0,32,65,1,32,66,67,20,67,34,52,65,52,36,
+            2,16,20,2,0,2,17,17,66,36,50,68,65,20,66,19,68,67,68,51,68,20,17,68,68,
+            68,68,20,65,4,0,36,1,0,68,2,20,4,33,1,0,0,17,4,0,16,16,2,64,17,
+            65,64,20,0,1,0,68,18,48,0,65,0,0,17,16,64,18,19,64,20,0,0,1,0,0,
+            1,0,16,3,68,2,64,18,4,1,52,34,33,36,51,0,32,51,16,52,3,51,0,2,32,
+            2,65,0,32,2,0,0,0,0,0,48,0,0,32,48,2,49,0,19,32,3,2,0,0,3,
+            0,0,0,0,0,32,2,0,20,32,2,32,0,51,48,67,1,51,2,0,51,66,18,34,3,
+        },
+        // Quality 38
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,251,255,0,109,255,163,19,1,176,
+            254,15,231,40,36,0,0,0,0,255,255,255,39,2,0,0,112,240,24,215,3,2,0,0,112,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,17,66,68,51,68,52,68,
+            49,36,65,20,68,51,66,36,18,17,48,0,32,65,1,32,66,67,20,67,34,52,65,52,36,
+            2,16,20,2,0,3,17,33,66,36,51,68,65,20,66,19,68,67,68,51,68,36,17,68,68,
+            68,68,20,65,4,16,36,1,0,68,18,20,4,33,17,0,1,17,4,0,16,16,2,65,17,
+            65,64,20,0,1,0,68,18,48,1,65,0,0,17,16,64,18,19,65,20,0,0,1,0,0,
+            17,0,16,3,68,18,64,18,20,1,52,34,34,36,51,0,32,51,18,52,3,51,0,2,32,
+            2,65,0,32,2,0,0,0,0,0,48,0,0,32,48,3,49,0,19,48,3,2,0,0,3,
+            0,0,0,0,0,32,2,0,20,32,2,32,0,51,48,67,33,51,2,0,51,66,34,34,3,
+        },
+        // Quality 39
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,251,255,0,109,255,163,23,1,176,
+            254,15,231,40,36,0,0,0,0,255,255,255,39,2,0,0,112,240,24,215,3,2,0,0,112,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,17,66,68,67,68,52,68,
+            49,36,65,20,68,51,66,52,18,17,48,0,32,66,1,32,66,67,20,67,34,52,65,52,36,
+            2,16,36,2,0,3,17,33,67,36,51,68,65,20,66,19,68,67,68,52,68,36,17,68,68,
+            68,68,20,65,20,16,36,1,0,68,18,20,4,49,17,0,1,17,4,0,16,16,3,65,17,
+            65,65,20,0,1,0,68,19,48,1,65,0,0,17,16,64,18,19,65,20,0,0,1,0,0,
+            17,0,16,3,68,19,64,18,20,1,52,34,34,36,51,0,32,51,20,52,3,51,0,3,32,
+            2,65,0,32,2,0,0,0,0,0,48,0,0,32,48,3,49,0,19,48,3,2,0,0,3,
+            0,0,0,0,0,32,2,0,20,32,2,48,0,51,48,67,65,51,2,0,51,66,34,34,3,
+        },
+        // Quality 40
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,27,239,251,255,0,237,255,179,23,1,176,
+            254,15,231,40,36,0,0,0,0,255,255,255,39,2,0,0,112,240,24,215,3,2,0,0,112,
+            4,4,3,4,1,3,3,4,3,1,1,2,1,64,68,68,68,68,17,66,68,68,68,52,68,
+            49,36,65,20,68,51,66,52,18,17,48,0,32,66,1,32,66,67,36,67,34,52,66,52,36,
+            2,16,36,2,0,3,17,33,67,36,51,68,65,20,66,19,68,67,68,68,68,36,17,68,68,
+            68,68,20,65,20,16,36,1,0,68,18,20,4,49,17,0,1,17,4,0,16,16,3,65,33,
+            65,65,36,0,1,0,68,19,65,1,65,0,0,17,16,64,18,19,65,20,0,0,1,0,0,
+            17,0,16,19,68,19,64,18,20,1,52,50,34,36,51,0,32,51,20,52,3,51,0,3,32,
+            3,65,0,32,2,0,0,0,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,0,0,0,32,2,0,20,48,2,48,0,51,48,67,65,51,2,0,51,66,34,35,3,
+        },
+        // Quality 41
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,239,255,179,151,1,176,
+            254,207,231,40,36,0,0,0,0,255,255,255,39,2,0,0,240,48,24,215,3,2,0,0,240,
+            4,4,3,4,1,3,3,4,3,2,1,2,1,64,68,68,68,68,17,66,68,68,68,52,68,
+            50,36,65,20,68,51,66,52,18,17,49,1,32,66,1,32,66,67,36,67,34,52,66,52,36,
+            2,16,36,2,16,19,17,33,67,36,51,68,65,20,66,35,68,67,68,68,68,36,17,68,68,
+            68,68,20,65,20,16,52,1,0,68,18,20,4,49,18,0,1,17,4,0,16,17,3,65,33,
+            65,65,36,0,1,1,68,19,65,1,65,0,0,17,16,64,19,19,65,20,0,0,1,0,0,
+            17,0,17,19,68,19,64,18,20,2,52,50,34,36,51,0,32,51,20,52,19,51,0,3,32,
+            3,65,0,32,3,0,0,0,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,0,0,0,48,2,0,20,48,2,48,0,51,49,67,65,51,2,0,51,66,34,35,3,
+        },
+        // Quality 42
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,239,255,179,159,1,176,
+            254,207,231,168,36,0,0,0,0,255,255,255,39,2,0,0,240,48,24,87,3,2,0,0,240,
+            4,4,3,4,1,3,3,4,4,2,1,2,1,64,68,68,68,68,17,66,68,68,68,52,68,
+            66,52,65,20,68,51,66,52,18,33,49,1,32,66,1,32,66,68,36,68,34,68,66,68,36,
+            2,16,36,2,16,19,18,33,67,36,51,68,65,20,67,36,68,67,68,68,68,36,17,68,68,
+            68,68,20,65,20,16,52,1,0,68,18,20,4,50,18,0,1,17,4,0,16,17,3,65,33,
+            65,65,36,0,2,1,68,19,65,1,65,0,0,17,16,64,19,19,65,20,0,0,1,0,0,
+            17,0,17,19,68,19,64,18,20,2,52,50,34,36,51,0,48,51,20,52,19,51,0,3,48,
+            3,65,0,32,3,0,0,0,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,0,0,0,48,2,0,20,48,3,48,0,51,49,67,65,51,3,0,51,66,34,35,3,
+        },
+        // Quality 43
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,239,255,243,223,1,176,
+            254,207,231,249,36,0,0,0,0,255,255,255,39,3,0,0,240,48,24,6,3,3,0,0,240,
+            4,4,3,4,1,3,3,4,4,2,1,2,1,64,68,68,68,68,17,66,68,68,68,68,68,
+            66,52,65,20,68,52,66,52,18,33,49,1,32,66,2,32,66,68,36,68,34,68,66,68,36,
+            2,32,36,2,16,19,18,33,67,36,67,68,65,20,67,36,68,68,68,68,68,36,17,68,68,
+            68,68,20,65,20,16,52,1,0,68,34,20,4,50,18,0,1,17,4,0,16,17,3,65,33,
+            65,65,36,16,2,17,68,19,65,17,65,0,0,17,16,64,19,19,66,20,0,16,1,0,0,
+            17,16,17,19,68,19,64,18,20,2,52,51,34,36,51,0,48,51,36,52,19,51,0,3,48,
+            3,65,0,32,3,0,0,16,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,1,0,0,48,2,0,20,48,3,48,0,51,49,67,66,51,3,0,51,66,34,51,3,
+        },
+        // Quality 44
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,239,255,243,223,1,176,
+            254,207,231,249,36,0,0,0,0,255,255,255,39,3,0,0,240,48,24,6,3,3,0,0,240,
+            4,4,3,4,1,3,3,4,4,2,1,3,1,64,68,68,68,68,17,66,68,68,68,68,68,
+            66,52,65,36,68,52,66,52,34,33,65,1,32,66,2,32,66,68,36,68,34,68,66,68,36,
+            2,32,36,2,16,20,18,34,67,36,67,68,66,20,67,36,68,68,68,68,68,36,17,68,68,
+            68,68,36,66,20,16,52,1,0,68,35,20,4,50,18,0,1,17,4,0,16,17,3,65,49,
+            65,65,52,16,2,17,68,19,65,17,65,0,0,17,16,64,19,19,66,20,0,16,1,0,0,
+            17,16,17,19,68,19,64,19,20,2,52,51,35,36,51,0,48,51,36,52,19,51,0,3,48,
+            3,65,0,48,3,0,0,16,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,1,0,0,48,3,0,20,48,3,48,0,51,49,67,66,51,3,0,51,66,50,51,3,
+        },
+        // Quality 45
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,255,255,243,223,1,176,
+            254,207,231,249,36,0,0,0,0,255,255,255,39,11,0,0,240,48,24,6,3,11,0,0,240,
+            4,4,3,4,1,3,3,4,4,2,1,3,1,64,68,68,68,68,17,66,68,68,68,68,68,
+            66,52,65,36,68,68,66,52,34,33,65,1,32,66,2,32,66,68,36,68,68,68,66,68,36,
+            2,32,36,2,16,20,18,34,67,36,68,68,66,20,67,36,68,68,68,68,68,36,17,68,68,
+            68,68,36,66,36,16,52,2,0,68,35,20,4,50,18,0,1,17,4,0,16,33,3,65,49,
+            66,66,52,16,2,17,68,19,65,17,65,0,0,17,16,64,19,19,66,20,0,16,1,0,0,
+            18,16,17,19,68,19,64,19,20,2,68,51,35,52,51,0,48,51,36,52,19,51,0,3,48,
+            3,65,1,48,3,0,0,16,0,0,64,0,0,32,48,3,49,0,19,48,3,2,0,0,4,
+            0,0,1,0,0,48,3,16,20,48,3,48,0,51,49,67,66,51,3,0,51,67,50,51,4,
+        },
+        // Quality 46
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,255,255,243,223,1,176,
+            255,207,231,249,36,0,0,0,0,255,255,255,103,11,8,0,240,48,24,6,67,11,8,0,240,
+            4,4,3,4,1,3,3,4,4,2,1,3,1,64,68,68,68,68,18,66,68,68,68,68,68,
+            66,52,65,36,68,68,66,52,34,34,65,1,32,66,2,32,67,68,52,68,68,68,67,68,52,
+            2,32,36,2,16,20,34,34,67,36,68,68,66,20,67,36,68,68,68,68,68,36,33,68,68,
+            68,68,36,66,36,16,52,18,0,68,35,20,4,50,18,0,1,17,4,0,32,33,3,65,49,
+            66,66,52,16,2,17,68,19,65,17,65,0,0,17,16,64,19,19,66,20,0,16,1,0,0,
+            18,16,17,19,68,19,64,35,20,2,68,51,35,52,51,0,48,51,36,52,19,51,0,3,48,
+            3,65,1,48,3,16,0,16,0,0,64,0,0,48,49,3,49,0,19,48,19,3,0,0,4,
+            0,0,1,0,1,48,3,16,20,48,3,48,0,51,49,67,66,51,3,0,51,67,50,51,4,
+        },
+        // Quality 47
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,239,255,255,0,255,255,243,255,1,176,
+            255,207,231,249,36,0,0,0,0,255,255,255,103,11,8,0,240,48,24,6,67,11,8,0,240,
+            4,4,3,4,1,4,3,4,4,2,1,3,1,64,68,68,68,68,18,66,68,68,68,68,68,
+            66,52,65,36,68,68,67,68,34,34,65,1,48,66,2,32,67,68,52,68,68,68,67,68,52,
+            2,32,36,3,16,20,34,34,68,52,68,68,66,20,67,36,68,68,68,68,68,36,33,68,68,
+            68,68,36,66,36,16,52,18,0,68,35,20,4,50,18,0,1,17,4,0,32,33,3,65,49,
+            66,66,52,17,2,17,68,19,65,17,65,1,0,17,16,64,19,19,66,20,0,17,1,0,0,
+            18,16,17,19,68,19,64,35,20,2,68,51,51,52,51,0,48,51,36,68,19,51,0,3,48,
+            3,65,1,48,3,16,0,16,0,0,64,0,0,48,49,3,49,0,19,48,19,3,0,0,4,
+            0,0,1,0,1,48,3,16,20,48,3,48,0,51,49,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 48
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,255,255,255,0,255,255,251,255,1,240,
+            255,207,231,249,36,0,0,0,0,255,255,255,103,11,8,0,240,48,24,6,67,11,8,0,240,
+            4,4,3,4,1,4,3,4,4,2,2,3,1,64,68,68,68,68,18,66,68,68,68,68,68,
+            66,52,66,36,68,68,67,68,34,34,66,1,48,66,2,33,67,68,52,68,68,68,67,68,52,
+            18,32,36,3,16,36,34,34,68,52,68,68,66,36,67,36,68,68,68,68,68,36,33,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,20,4,50,18,16,1,17,4,1,32,33,3,65,49,
+            66,66,52,17,2,17,68,19,65,17,65,1,0,17,16,64,19,19,66,20,0,17,17,0,0,
+            18,16,17,19,68,19,64,35,20,2,68,51,51,52,51,0,48,51,36,68,19,51,0,3,48,
+            3,65,1,48,3,16,0,48,0,0,64,0,0,48,49,3,49,0,19,48,19,3,0,0,4,
+            0,0,3,0,1,48,3,16,20,48,3,48,0,51,49,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 49
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,255,255,255,64,255,255,251,255,1,240,
+            255,207,231,249,36,0,0,0,0,255,255,255,119,11,8,0,240,48,24,6,83,11,8,0,240,
+            4,4,3,4,1,4,3,4,4,2,2,3,1,64,68,68,68,68,34,66,68,68,68,68,68,
+            66,52,66,36,68,68,67,68,34,34,66,1,48,66,2,33,67,68,52,68,68,68,67,68,52,
+            18,32,36,3,16,36,34,34,68,52,68,68,66,36,67,36,68,68,68,68,68,36,34,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,20,4,50,19,16,1,33,4,1,32,33,3,65,49,
+            66,66,52,17,2,17,68,19,65,17,66,1,0,17,16,64,35,35,66,20,0,17,17,0,0,
+            18,16,17,19,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,20,51,16,3,48,
+            3,65,1,48,3,16,0,48,0,0,64,0,0,48,49,3,65,0,20,48,19,3,0,0,4,
+            0,0,3,0,1,48,3,16,20,48,3,48,1,51,65,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 50
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,255,255,255,80,255,255,251,255,1,248,
+            255,207,255,249,36,0,0,0,0,255,255,255,127,11,8,64,240,48,0,6,91,11,8,64,240,
+            4,4,4,4,1,4,3,4,4,2,2,3,1,64,68,68,68,68,34,66,68,68,68,68,68,
+            66,52,66,36,68,68,67,68,50,34,66,1,48,66,2,33,68,68,52,68,68,68,67,68,68,
+            18,32,36,3,16,36,34,35,68,52,68,68,66,36,67,36,68,68,68,68,68,36,34,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,20,4,50,19,16,1,33,4,1,32,33,3,65,49,
+            66,66,52,17,2,17,68,19,65,17,66,1,0,17,17,64,35,35,66,20,0,17,17,1,0,
+            18,16,17,20,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,20,51,16,3,48,
+            3,65,17,48,3,17,0,64,0,0,64,0,0,48,49,3,65,0,20,48,19,3,0,0,4,
+            0,0,4,0,17,48,3,17,20,48,3,48,1,51,65,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 51
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,59,255,255,255,80,255,255,251,255,1,248,
+            255,207,255,249,36,0,0,0,0,255,255,255,127,11,8,64,240,48,0,6,91,11,8,64,240,
+            4,4,4,4,2,4,3,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            66,52,66,52,68,68,67,68,50,34,66,1,48,67,2,49,68,68,52,68,68,68,67,68,68,
+            19,32,52,3,16,36,34,35,68,52,68,68,67,36,67,36,68,68,68,68,68,52,34,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,36,4,50,19,16,1,33,4,1,32,33,3,65,50,
+            66,66,52,17,2,17,68,19,65,17,66,1,0,33,17,64,35,35,66,20,0,17,18,1,0,
+            18,16,17,20,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,20,51,16,3,48,
+            3,66,17,48,3,17,0,64,0,0,64,0,0,48,49,3,65,0,20,48,19,3,0,0,4,
+            0,0,4,0,17,48,3,17,36,48,3,48,1,51,65,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 52
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,123,255,255,255,112,255,255,251,255,1,248,
+            255,207,255,249,36,0,0,0,0,255,255,255,127,11,8,64,240,48,0,6,91,11,8,64,240,
+            4,4,4,4,2,4,4,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            66,68,66,52,68,68,67,68,51,34,66,1,48,67,18,49,68,68,52,68,68,68,67,68,68,
+            19,33,52,3,16,36,34,51,68,52,68,68,67,36,68,36,68,68,68,68,68,52,34,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,36,4,50,19,16,1,49,4,1,32,49,3,65,50,
+            66,66,52,17,2,17,68,19,65,17,66,1,0,33,17,64,51,35,66,20,0,17,18,1,0,
+            19,16,17,20,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,36,51,16,3,48,
+            3,66,17,48,3,17,0,64,0,0,64,0,0,48,49,3,66,0,36,48,19,3,0,0,4,
+            0,0,4,0,17,48,3,17,36,48,3,48,1,51,66,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 53
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,123,255,255,255,112,255,255,251,255,1,248,
+            255,207,255,249,36,0,0,0,0,255,255,255,127,11,10,64,244,48,0,6,91,11,10,64,244,
+            4,4,4,4,2,4,4,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            66,68,66,68,68,68,67,68,51,34,66,2,48,67,18,49,68,68,52,68,68,68,67,68,68,
+            19,33,52,3,32,36,34,51,68,52,68,68,68,36,68,36,68,68,68,68,68,52,34,68,68,
+            68,68,36,66,36,16,52,18,1,68,35,36,4,50,19,16,1,49,4,1,32,49,3,65,50,
+            66,66,52,17,2,17,68,19,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,17,20,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,36,51,17,3,48,
+            3,67,17,48,3,17,0,64,0,0,64,0,0,48,49,3,66,17,36,48,19,3,0,0,4,
+            0,0,4,0,17,48,3,17,52,48,3,48,17,51,66,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 54
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,123,255,255,255,112,255,255,251,255,1,248,
+            255,207,255,249,36,2,0,0,0,255,255,255,127,11,11,192,244,48,0,6,91,9,11,192,244,
+            4,4,4,4,2,4,4,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            66,68,66,68,68,68,67,68,51,34,66,2,48,67,18,49,68,68,68,68,68,68,68,68,68,
+            19,33,52,3,32,36,34,51,68,52,68,68,68,36,68,36,68,68,68,68,68,52,34,68,68,
+            68,68,36,66,52,48,52,50,1,68,35,36,4,50,19,16,1,49,4,1,32,49,3,65,50,
+            66,67,52,17,2,17,68,19,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,17,20,68,19,64,35,20,3,68,51,51,52,51,0,48,51,36,68,36,51,17,3,48,
+            3,67,18,48,3,17,0,64,0,0,65,0,0,48,49,19,66,17,36,49,19,3,0,0,20,
+            0,0,4,0,17,48,3,33,52,48,3,48,17,51,66,68,66,51,3,0,51,67,51,51,4,
+        },
+        // Quality 55
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,123,255,255,255,240,255,255,251,255,1,248,
+            255,223,255,249,36,2,0,0,0,255,255,255,127,11,11,224,244,32,0,6,91,9,11,224,244,
+            4,4,4,4,2,4,4,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            66,68,66,68,68,68,68,68,51,50,66,2,48,67,18,49,68,68,68,68,68,68,68,68,68,
+            19,33,52,3,32,36,35,51,68,68,68,68,68,36,68,36,68,68,68,68,68,52,34,68,68,
+            68,68,36,66,52,48,52,50,1,68,35,36,4,50,19,16,1,49,4,1,32,49,3,65,50,
+            66,67,52,17,2,17,68,35,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,33,20,68,19,64,35,20,3,68,51,51,52,52,0,48,51,36,68,36,51,17,3,48,
+            3,67,18,48,4,17,0,64,0,0,65,0,16,48,49,19,66,17,36,49,19,3,1,0,20,
+            0,0,4,0,17,64,3,33,52,48,3,48,17,51,66,68,66,51,3,0,67,67,51,51,4,
+        },
+        // Quality 56
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,123,255,255,255,240,255,255,251,255,1,248,
+            255,223,255,249,36,10,0,0,0,255,255,255,127,11,11,224,244,32,0,6,91,1,11,224,244,
+            4,4,4,4,3,4,4,4,4,3,2,3,1,64,68,68,68,68,34,67,68,68,68,68,68,
+            68,68,66,68,68,68,68,68,51,50,66,2,48,67,18,49,68,68,68,68,68,68,68,68,68,
+            19,33,52,3,32,36,35,51,68,68,68,68,68,36,68,68,68,68,68,68,68,52,34,68,68,
+            68,68,52,67,52,48,52,50,1,68,35,36,4,50,19,32,1,49,4,2,32,49,3,65,50,
+            66,67,52,17,2,17,68,35,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,33,20,68,19,64,35,20,3,68,52,51,52,52,0,48,51,52,68,36,51,17,3,48,
+            3,67,18,48,4,17,0,64,0,0,65,0,16,48,49,19,66,17,36,49,19,3,1,0,20,
+            0,0,4,0,17,64,3,33,52,48,3,48,17,51,66,68,67,51,3,0,67,67,51,67,4,
+        },
+        // Quality 57
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,240,255,255,251,255,1,248,
+            255,255,255,249,36,10,0,0,0,255,255,255,127,11,11,224,244,0,0,6,91,1,11,224,244,
+            4,4,4,4,3,4,4,4,4,3,2,3,1,64,68,68,68,68,35,67,68,68,68,68,68,
+            68,68,66,68,68,68,68,68,51,50,66,2,49,67,19,49,68,68,68,68,68,68,68,68,68,
+            19,49,52,19,32,36,35,51,68,68,68,68,68,36,68,68,68,68,68,68,68,52,50,68,68,
+            68,68,52,67,52,48,52,51,1,68,35,36,4,50,19,32,1,49,4,2,48,49,3,66,50,
+            67,67,52,17,2,17,68,51,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,49,20,68,35,64,51,20,3,68,52,52,52,52,0,48,51,52,68,36,51,17,3,64,
+            3,67,18,48,4,17,0,64,0,0,65,0,16,48,49,19,67,17,52,49,19,3,1,0,20,
+            0,0,4,0,17,64,3,33,52,48,4,48,17,51,66,68,67,51,3,0,67,67,67,67,4,
+        },
+        // Quality 58
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,240,255,255,251,255,1,248,
+            255,255,255,251,38,10,0,0,48,255,255,255,127,11,15,240,244,0,0,4,89,1,15,240,196,
+            4,4,4,4,3,4,4,4,4,3,2,3,1,64,68,68,68,68,35,67,68,68,68,68,68,
+            68,68,66,68,68,68,68,68,67,50,66,2,65,67,19,49,68,68,68,68,68,68,68,68,68,
+            19,49,52,20,32,36,35,52,68,68,68,68,68,36,68,68,68,68,68,68,68,52,50,68,68,
+            68,68,52,67,52,48,52,51,1,68,35,36,4,50,19,32,1,49,4,2,48,49,3,66,50,
+            67,67,52,17,2,17,68,51,65,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,49,20,68,35,64,51,20,3,68,52,52,52,52,0,48,51,52,68,36,67,17,3,64,
+            19,67,18,49,4,17,0,64,0,0,65,0,16,48,49,19,67,17,52,49,19,3,1,0,20,
+            0,0,4,0,17,64,19,33,52,49,4,48,17,52,66,68,67,51,3,0,67,67,67,67,4,
+        },
+        // Quality 59
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,240,255,255,251,255,1,248,
+            255,255,255,251,39,11,0,0,48,255,255,255,255,11,15,240,245,0,0,4,216,0,15,240,197,
+            4,4,4,4,3,4,4,4,4,3,2,4,1,64,68,68,68,68,35,67,68,68,68,68,68,
+            68,68,67,68,68,68,68,68,68,50,66,2,65,68,19,65,68,68,68,68,68,68,68,68,68,
+            20,49,68,20,32,36,35,68,68,68,68,68,68,52,68,68,68,68,68,68,68,52,50,68,68,
+            68,68,52,67,52,48,52,51,1,68,35,36,4,51,19,32,1,49,4,2,48,49,3,66,50,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,35,17,64,51,51,66,52,0,17,18,1,0,
+            19,16,49,52,68,35,64,51,20,3,68,52,52,52,52,0,48,51,52,68,36,67,17,3,64,
+            19,67,18,49,20,17,0,64,0,0,65,0,16,49,49,19,67,17,52,49,19,19,1,0,20,
+            0,0,4,0,17,65,19,33,52,49,4,48,17,52,66,68,67,51,3,0,67,67,67,67,4,
+        },
+        // Quality 60
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,240,255,255,251,255,1,248,
+            255,255,255,255,39,11,0,0,48,255,255,255,255,11,15,241,245,0,0,0,216,0,15,241,197,
+            4,4,4,4,3,4,4,4,4,3,3,4,1,64,68,68,68,68,51,68,68,68,68,68,68,
+            68,68,67,68,68,68,68,68,68,51,66,2,65,68,19,65,68,68,68,68,68,68,68,68,68,
+            20,49,68,20,32,36,51,68,68,68,68,68,68,52,68,68,68,68,68,68,68,68,51,68,68,
+            68,68,52,67,52,48,52,51,1,68,35,36,4,51,19,32,1,49,4,2,48,49,3,66,50,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,35,18,64,51,51,66,52,0,17,18,2,0,
+            19,16,49,52,68,35,64,51,20,3,68,52,52,52,52,1,48,51,52,68,36,67,33,3,64,
+            19,67,18,49,20,17,0,64,0,0,65,0,16,49,49,19,67,17,52,49,19,19,1,0,20,
+            0,0,4,0,17,65,19,33,52,49,4,48,18,52,66,68,67,51,3,16,67,67,67,67,4,
+        },
+        // Quality 61
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,240,255,255,251,255,1,248,
+            255,255,255,255,39,11,0,0,176,255,255,255,255,11,15,241,245,0,0,0,216,0,15,241,69,
+            4,4,4,4,3,4,4,4,4,3,3,4,1,64,68,68,68,68,51,68,68,68,68,68,68,
+            68,68,67,68,68,68,68,68,68,51,67,2,65,68,19,65,68,68,68,68,68,68,68,68,68,
+            20,49,68,20,32,52,51,68,68,68,68,68,68,52,68,68,68,68,68,68,68,68,51,68,68,
+            68,68,52,67,52,48,52,51,3,68,35,52,4,51,19,32,1,49,4,2,48,49,3,66,51,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,51,18,64,51,52,66,52,0,17,50,2,0,
+            19,16,49,52,68,35,64,51,20,3,68,52,52,52,52,1,48,52,52,68,36,67,49,3,64,
+            19,67,19,49,20,17,0,64,0,0,65,0,16,49,49,19,67,17,52,49,19,19,1,0,20,
+            0,0,4,0,17,65,19,49,52,49,4,48,19,52,66,68,67,67,3,16,67,67,67,67,4,
+        },
+        // Quality 62
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,242,255,255,255,255,1,248,
+            255,255,255,255,39,11,0,0,240,255,255,255,255,11,15,241,253,0,0,0,216,0,15,241,13,
+            4,4,4,4,3,4,4,4,4,3,3,4,1,64,68,68,68,68,51,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,67,67,2,65,68,20,65,68,68,68,68,68,68,68,68,68,
+            20,65,68,20,32,52,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,51,68,68,
+            68,68,52,67,52,48,52,51,3,68,35,52,4,51,19,32,1,49,4,2,48,49,3,66,51,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,51,18,64,51,52,66,52,1,17,50,2,0,
+            19,16,49,52,68,35,64,51,20,3,68,52,52,52,52,1,48,52,52,68,52,67,49,19,64,
+            19,67,19,49,20,17,0,64,0,0,65,0,16,49,50,19,67,17,52,49,35,19,1,0,20,
+            0,0,4,0,17,65,19,49,52,49,4,49,19,52,67,68,67,67,3,16,67,67,67,67,4,
+        },
+        // Quality 63
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,242,255,255,255,255,1,250,
+            255,255,255,255,39,11,0,0,240,255,255,255,255,11,143,241,253,0,0,0,216,0,143,241,13,
+            4,4,4,4,3,4,4,4,4,3,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,67,67,2,65,68,20,66,68,68,68,68,68,68,68,68,68,
+            36,65,68,20,32,52,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,52,67,52,48,52,51,3,68,35,52,4,51,19,32,1,49,4,2,48,49,19,66,51,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,51,18,64,51,52,66,52,1,17,50,2,0,
+            19,16,49,52,68,35,65,51,20,3,68,52,52,52,68,1,49,52,52,68,52,68,49,19,64,
+            19,67,19,49,20,17,0,64,0,0,65,0,16,49,66,19,67,17,52,49,36,19,1,0,20,
+            0,0,4,0,17,65,19,49,52,49,4,49,19,68,67,68,67,67,19,16,68,67,67,67,4,
+        },
+        // Quality 64
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,243,255,255,255,255,1,250,
+            255,255,255,255,39,11,0,0,240,255,255,255,255,43,143,241,253,0,0,0,216,32,143,241,13,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,67,67,3,65,68,20,66,68,68,68,68,68,68,68,68,68,
+            36,65,68,20,48,52,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,52,67,52,48,52,51,3,68,35,52,4,51,19,32,1,51,4,2,48,49,19,66,51,
+            67,67,52,17,2,17,68,51,67,17,67,1,0,52,50,64,51,52,66,68,1,17,50,2,0,
+            19,16,49,52,68,35,65,51,20,3,68,52,52,52,68,1,49,52,52,68,52,68,49,19,64,
+            19,67,19,49,20,17,0,64,1,0,65,0,16,49,66,20,67,17,52,65,36,19,1,0,20,
+            0,16,4,0,17,65,19,49,52,49,4,49,19,68,67,68,67,67,19,16,68,67,67,67,4,
+        },
+        // Quality 65
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,251,255,255,255,255,65,250,
+            255,255,255,255,39,11,128,0,240,255,255,255,255,43,175,241,255,0,0,0,216,32,47,241,15,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,67,67,3,65,68,20,66,68,68,68,68,68,68,68,68,68,
+            36,65,68,20,48,52,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,48,52,51,3,68,35,52,4,51,19,32,1,67,4,2,48,49,19,66,51,
+            67,67,52,17,2,33,68,51,67,17,67,17,0,52,50,64,67,52,66,68,1,17,50,18,0,
+            19,32,49,52,68,35,65,51,20,3,68,52,68,52,68,1,49,52,52,68,52,68,49,19,64,
+            19,67,19,49,20,17,16,64,1,16,65,0,16,49,66,20,67,17,52,65,36,19,1,0,20,
+            1,16,4,1,17,65,19,49,52,49,4,49,19,68,67,68,67,67,19,16,68,67,68,67,4,
+        },
+        // Quality 66
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,251,255,255,255,255,65,250,
+            255,255,255,255,39,11,128,0,240,255,255,255,255,43,175,245,255,0,0,0,216,32,47,245,15,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,3,65,68,20,66,68,68,68,68,68,68,68,68,68,
+            36,65,68,20,48,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,48,52,51,3,68,35,52,4,51,19,32,1,67,4,2,48,50,19,66,51,
+            67,67,52,17,3,34,68,51,67,17,67,17,0,52,50,64,67,52,66,68,1,17,50,18,0,
+            19,32,50,52,68,35,65,51,20,3,68,52,68,52,68,1,65,52,52,68,52,68,49,19,64,
+            19,68,19,49,20,17,16,65,1,16,65,0,16,49,66,20,67,17,52,65,36,19,1,0,20,
+            1,16,20,1,17,65,19,49,68,49,4,49,19,68,67,68,67,67,20,16,68,67,68,67,4,
+        },
+        // Quality 67
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,251,255,255,255,251,255,255,255,255,75,250,
+            255,255,255,255,55,11,128,0,240,255,255,255,255,43,175,245,255,0,0,0,200,32,47,245,15,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,3,65,68,36,66,68,68,68,68,68,68,68,68,68,
+            36,66,68,20,48,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,35,52,20,51,19,32,1,67,4,2,48,50,19,66,51,
+            67,67,52,17,19,34,68,51,67,17,67,17,0,52,50,64,68,52,66,68,1,17,50,18,0,
+            19,32,50,52,68,35,65,51,20,3,68,52,68,52,68,1,65,52,52,68,52,68,50,19,64,
+            20,68,19,49,20,17,16,65,1,16,65,0,16,49,67,20,67,17,52,65,52,19,1,0,20,
+            1,16,20,1,17,65,19,49,68,65,4,49,35,68,67,68,67,67,20,16,68,67,68,67,4,
+        },
+        // Quality 68
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,251,255,255,255,255,75,250,
+            255,255,255,255,55,11,128,0,252,255,255,255,255,43,175,245,255,0,0,0,200,32,47,245,3,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,19,65,68,36,66,68,68,68,68,68,68,68,68,68,
+            36,66,68,20,49,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,35,52,20,51,19,32,3,67,4,2,48,50,19,67,51,
+            67,67,52,17,19,34,68,51,67,17,67,17,0,52,50,64,68,52,66,68,1,17,50,18,0,
+            19,32,50,52,68,51,65,51,52,3,68,52,68,52,68,1,65,52,52,68,52,68,50,35,64,
+            20,68,19,49,20,17,16,65,1,16,66,0,16,65,67,20,67,17,52,65,52,20,1,0,36,
+            1,16,20,1,17,65,19,49,68,65,4,50,35,68,67,68,67,67,20,16,68,67,68,67,4,
+        },
+        // Quality 69
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,55,11,128,0,252,255,255,255,255,43,175,245,255,0,0,0,200,32,47,245,3,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,19,65,68,36,66,68,68,68,68,68,68,68,68,68,
+            36,66,68,20,49,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,35,52,20,51,19,32,3,67,4,2,49,50,19,67,51,
+            67,67,52,17,19,50,68,51,67,17,67,17,32,52,50,64,68,52,66,68,1,17,50,18,32,
+            19,49,50,52,68,51,65,51,52,3,68,68,68,68,68,1,65,52,52,68,52,68,50,51,64,
+            20,68,19,49,20,17,16,65,1,16,66,0,16,65,67,20,67,17,52,65,52,20,1,0,36,
+            1,16,20,1,17,65,19,49,68,65,4,51,35,68,67,68,67,67,20,16,68,68,68,68,4,
+        },
+        // Quality 70
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,183,11,128,0,252,255,255,255,255,43,175,253,255,0,0,0,72,32,47,253,3,
+            4,4,4,4,3,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,19,66,68,36,66,68,68,68,68,68,68,68,68,68,
+            36,66,68,36,49,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,51,52,20,51,19,32,3,67,4,2,49,50,19,67,51,
+            67,67,52,17,19,50,68,51,67,17,67,17,32,52,51,64,68,52,67,68,1,17,51,19,32,
+            19,49,50,52,68,51,65,51,52,3,68,68,68,68,68,1,65,68,52,68,52,68,50,52,65,
+            20,68,19,49,20,17,16,65,1,16,66,0,16,65,67,20,67,17,52,65,52,20,1,0,36,
+            1,16,20,1,17,65,19,49,68,65,20,67,35,68,67,68,67,68,20,16,68,68,68,68,4,
+        },
+        // Quality 71
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,191,11,128,1,252,255,255,255,255,43,175,253,255,0,0,0,64,32,47,252,3,
+            4,4,4,4,4,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,35,66,68,36,67,68,68,68,68,68,68,68,68,68,
+            52,66,68,36,50,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,51,52,20,51,20,32,3,67,4,2,50,50,19,67,67,
+            67,67,68,17,19,50,68,52,67,17,67,17,32,52,51,64,68,52,67,68,1,17,51,19,32,
+            19,50,50,52,68,52,65,51,52,4,68,68,68,68,68,1,65,68,52,68,52,68,51,52,65,
+            20,68,19,49,20,17,16,65,1,16,66,0,16,65,67,20,67,34,52,65,52,20,1,0,36,
+            1,16,20,1,17,65,19,49,68,65,20,67,51,68,67,68,67,68,20,16,68,68,68,68,4,
+        },
+        // Quality 72
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,191,11,128,1,252,255,255,255,255,43,175,255,255,0,0,0,64,32,47,254,3,
+            4,4,4,4,4,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,35,66,68,36,67,68,68,68,68,68,68,68,68,68,
+            52,66,68,36,50,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,52,36,51,20,48,3,67,4,3,50,50,19,67,67,
+            67,67,68,18,35,50,68,52,67,17,67,18,32,52,51,64,68,52,67,68,1,18,51,19,32,
+            19,50,50,52,68,52,65,52,52,4,68,68,68,68,68,17,65,68,52,68,52,68,51,52,65,
+            20,68,35,65,20,17,16,65,1,16,66,0,16,65,67,20,67,34,52,65,52,20,1,0,36,
+            1,16,20,1,17,65,20,50,68,65,20,67,51,68,67,68,67,68,20,17,68,68,68,68,4,
+        },
+        // Quality 73
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,128,1,254,255,255,255,255,43,175,255,255,0,0,0,0,32,47,254,1,
+            4,4,4,4,4,4,4,4,4,4,3,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,35,66,68,36,67,68,68,68,68,68,68,68,68,68,
+            52,66,68,36,50,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,20,48,3,67,4,3,50,51,20,67,68,
+            67,67,68,18,35,51,68,52,67,17,68,18,32,52,51,64,68,68,67,68,1,18,51,19,32,
+            19,50,51,52,68,52,65,52,52,4,68,68,68,68,68,17,65,68,52,68,52,68,51,52,65,
+            20,68,51,65,20,17,16,65,1,16,66,0,16,65,67,20,68,51,68,65,52,20,1,0,36,
+            1,16,20,1,17,65,20,51,68,65,20,67,51,68,67,68,67,68,20,17,68,68,68,68,4,
+        },
+        // Quality 74
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,128,1,254,255,255,255,255,43,175,255,255,0,0,0,0,32,47,254,1,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,36,67,68,52,67,68,68,68,68,68,68,68,68,68,
+            52,67,68,52,66,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,20,48,3,67,4,3,50,51,20,67,68,
+            67,67,68,34,35,51,68,52,67,33,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            19,50,51,52,68,52,65,52,52,4,68,68,68,68,68,17,65,68,52,68,52,68,51,52,65,
+            20,68,51,65,20,17,16,65,1,16,66,0,48,65,67,20,68,51,68,65,52,20,3,0,36,
+            1,16,20,1,17,65,20,51,68,65,20,67,51,68,67,68,67,68,20,17,68,68,68,68,4,
+        },
+        // Quality 75
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,130,5,255,255,255,255,255,43,175,255,255,0,0,0,0,32,45,250,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,36,67,68,68,67,68,68,68,68,68,68,68,68,68,
+            52,68,68,52,66,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,50,51,20,67,68,
+            67,67,68,34,35,51,68,52,67,35,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            51,50,51,52,68,52,65,52,52,4,68,68,68,68,68,17,65,68,52,68,52,68,51,52,65,
+            20,68,51,65,52,17,16,65,1,16,66,0,48,65,67,52,68,51,68,67,52,20,3,0,36,
+            1,16,20,1,17,67,20,51,68,65,20,67,51,68,67,68,67,68,20,17,68,68,68,68,4,
+        },
+        // Quality 76
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,139,5,255,255,255,255,255,59,175,255,255,0,0,0,0,48,36,250,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,67,68,68,68,68,68,68,68,68,68,
+            52,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,66,51,20,67,68,
+            67,67,68,34,35,51,68,52,67,35,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            51,50,51,52,68,52,65,68,52,4,68,68,68,68,68,17,65,68,68,68,68,68,51,52,65,
+            20,68,51,65,52,17,17,65,1,16,66,0,48,65,67,52,68,51,68,67,52,20,3,0,36,
+            1,16,20,17,17,67,20,51,68,65,20,67,51,68,68,68,68,68,20,17,68,68,68,68,4,
+        },
+        // Quality 77
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,171,13,255,255,255,255,255,59,239,255,255,0,0,0,0,48,68,242,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,67,68,68,68,68,68,68,68,68,68,
+            52,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,67,51,20,67,68,
+            67,67,68,34,35,51,68,52,67,35,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            51,51,51,52,68,52,65,68,52,4,68,68,68,68,68,17,65,68,68,68,68,68,51,52,65,
+            20,68,51,66,52,17,17,65,1,16,67,1,48,65,67,52,68,51,68,67,52,20,3,16,52,
+            1,16,20,17,17,67,36,51,68,65,20,67,51,68,68,68,68,68,20,17,68,68,68,68,4,
+        },
+        // Quality 78
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,235,15,255,255,255,255,255,59,239,255,255,0,0,0,0,48,4,240,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,67,68,68,68,68,68,68,68,68,68,
+            52,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,67,67,20,67,68,
+            67,67,68,34,35,51,68,52,67,35,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            52,51,51,52,68,52,65,68,52,4,68,68,68,68,68,17,65,68,68,68,68,68,51,52,65,
+            36,68,51,66,52,17,17,65,2,16,67,1,48,66,67,52,68,51,68,67,52,36,3,16,52,
+            1,32,20,17,17,67,36,51,68,66,20,67,51,68,68,68,68,68,20,17,68,68,68,68,4,
+        },
+        // Quality 79
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,235,47,255,255,255,255,255,59,239,255,255,0,0,0,0,48,4,208,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,52,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,67,67,20,67,68,
+            67,67,68,34,35,51,68,52,67,35,68,18,32,52,51,64,68,68,67,68,1,34,51,19,32,
+            52,51,51,52,68,52,65,68,52,4,68,68,68,68,68,17,65,68,68,68,68,68,51,52,65,
+            36,68,51,66,52,17,33,65,2,48,67,1,48,66,67,52,68,51,68,67,52,36,3,16,52,
+            3,32,20,18,17,67,36,51,68,66,20,67,51,68,68,68,68,68,20,17,68,68,68,68,4,
+        },
+        // Quality 80
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,235,127,255,255,255,255,255,59,239,255,255,0,0,0,0,48,4,128,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,50,68,51,35,68,52,68,36,67,52,48,3,67,4,3,67,67,20,67,68,
+            67,68,68,35,35,51,68,52,67,35,68,19,32,52,51,64,68,68,67,68,1,35,51,19,32,
+            52,51,51,52,68,52,65,68,52,4,68,68,68,68,68,33,65,68,68,68,68,68,51,52,65,
+            52,68,51,66,52,17,33,65,2,64,67,1,48,66,67,52,68,51,68,67,52,36,3,16,52,
+            4,32,20,18,17,67,36,51,68,67,20,67,51,68,68,68,68,68,20,18,68,68,68,68,4,
+        },
+        // Quality 81
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,239,127,255,255,255,255,255,59,239,255,255,0,0,0,0,48,0,128,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,51,51,68,52,68,36,68,52,48,3,67,4,3,67,67,20,67,68,
+            67,68,68,35,36,51,68,52,67,35,68,19,32,68,51,64,68,68,67,68,1,35,52,19,32,
+            52,51,51,52,68,52,65,68,52,4,68,68,68,68,68,33,65,68,68,68,68,68,67,52,65,
+            52,68,51,66,52,49,33,65,2,64,67,1,48,66,67,52,68,51,68,67,52,36,3,16,52,
+            4,32,20,18,19,67,36,51,68,67,20,67,52,68,68,68,68,68,20,18,68,68,68,68,4,
+        },
+        // Quality 82
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,11,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,48,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,52,51,68,52,68,36,68,52,48,3,68,4,3,67,67,20,67,68,
+            68,68,68,35,36,51,68,68,67,35,68,19,48,68,67,64,68,68,67,68,1,35,52,19,48,
+            52,51,67,52,68,52,65,68,52,4,68,68,68,68,68,50,65,68,68,68,68,68,67,52,65,
+            52,68,51,67,52,49,33,65,2,64,67,1,48,66,67,52,68,51,68,67,52,36,3,16,52,
+            4,32,20,18,19,67,52,51,68,67,20,67,52,68,68,68,68,68,20,35,68,68,68,68,4,
+        },
+        // Quality 83
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,250,
+            255,255,255,255,255,27,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,32,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,52,51,68,52,68,52,68,52,64,3,68,4,4,67,67,52,67,68,
+            68,68,68,35,52,51,68,68,67,35,68,19,48,68,67,64,68,68,67,68,1,35,52,19,48,
+            52,51,67,52,68,52,67,68,52,4,68,68,68,68,68,50,65,68,68,68,68,68,67,68,65,
+            52,68,67,67,52,49,33,65,2,64,67,1,48,66,67,68,68,51,68,68,52,36,3,16,52,
+            4,32,20,18,19,67,52,52,68,67,20,68,52,68,68,68,68,68,20,35,68,68,68,68,4,
+        },
+        // Quality 84
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,254,
+            255,255,255,255,255,27,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,32,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,52,51,68,52,68,52,68,52,64,35,68,4,4,67,67,68,68,68,
+            68,68,68,35,52,51,68,68,67,35,68,19,48,68,67,66,68,68,67,68,1,35,52,19,48,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,50,65,68,68,68,68,68,67,68,65,
+            52,68,67,67,52,49,49,65,2,64,68,1,48,67,67,68,68,51,68,68,52,52,3,16,68,
+            4,32,20,19,19,67,52,52,68,67,20,68,52,68,68,68,68,68,20,35,68,68,68,68,4,
+        },
+        // Quality 85
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,255,
+            255,255,255,255,255,91,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,32,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,52,51,68,68,68,52,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,35,52,51,68,68,67,35,68,19,48,68,67,67,68,68,68,68,1,35,52,19,48,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,50,65,68,68,68,68,68,67,68,65,
+            68,68,67,67,52,51,49,65,2,64,68,1,48,67,67,68,68,51,68,68,52,52,3,16,68,
+            4,32,20,19,51,67,52,52,68,68,20,68,52,68,68,68,68,68,20,35,68,68,68,68,4,
+        },
+        // Quality 86
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,255,
+            255,255,255,255,255,123,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,51,68,52,51,68,68,68,52,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,35,52,51,68,68,67,35,68,19,48,68,68,67,68,68,68,68,1,35,52,20,48,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,50,67,68,68,68,68,68,67,68,65,
+            68,68,67,67,52,52,49,65,2,64,68,1,48,67,67,68,68,51,68,68,52,52,3,16,68,
+            4,32,20,19,67,67,52,52,68,68,20,68,52,68,68,68,68,68,52,35,68,68,68,68,4,
+        },
+        // Quality 87
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,255,
+            255,255,255,255,255,251,239,255,255,255,255,255,255,59,239,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,67,68,68,51,68,68,68,52,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,36,52,51,68,68,67,35,68,20,48,68,68,67,68,68,68,68,1,36,52,20,48,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,50,67,68,68,68,68,68,67,68,65,
+            68,68,67,67,68,68,49,65,3,64,68,1,48,67,67,68,68,51,68,68,52,52,3,16,68,
+            4,48,20,19,68,68,52,52,68,68,20,68,52,68,68,68,68,68,52,35,68,68,68,68,4,
+        },
+        // Quality 88
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219,255,
+            255,255,255,255,255,251,255,255,255,255,255,255,255,59,239,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,67,68,68,51,68,68,68,68,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,36,68,51,68,68,67,35,68,20,48,68,68,67,68,68,68,68,1,36,52,20,48,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,67,67,68,68,65,65,3,64,68,1,48,67,67,68,68,51,68,68,52,52,3,16,68,
+            4,48,20,20,68,68,52,52,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 89
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,251,255,255,255,255,255,255,255,59,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,67,68,68,51,68,68,68,68,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,36,68,51,68,68,67,35,68,36,51,68,68,67,68,68,68,68,1,36,52,36,51,
+            52,51,67,52,68,68,68,68,52,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,68,67,68,68,66,65,3,64,68,1,49,67,67,68,68,51,68,68,52,52,19,16,68,
+            4,48,20,36,68,68,52,68,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 90
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,251,255,255,255,255,255,255,255,59,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,67,68,68,51,68,68,68,68,68,52,67,51,68,4,52,67,67,68,68,68,
+            68,68,68,36,68,67,68,68,68,35,68,36,51,68,68,67,68,68,68,68,3,36,52,36,51,
+            52,67,67,68,68,68,68,68,52,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,68,67,68,68,67,66,3,64,68,1,49,67,67,68,68,68,68,68,52,52,19,16,68,
+            4,48,36,52,68,68,52,68,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 91
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,59,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,67,68,68,68,68,68,52,67,52,68,4,52,68,67,68,68,68,
+            68,68,68,36,68,67,68,68,68,35,68,36,67,68,68,67,68,68,68,68,3,36,52,36,67,
+            52,68,67,68,68,68,68,68,68,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,68,68,68,68,67,68,3,64,68,1,49,67,67,68,68,68,68,68,52,52,19,16,68,
+            4,48,68,52,68,68,68,68,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 92
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,67,68,68,68,68,68,52,67,52,68,4,52,68,67,68,68,68,
+            68,68,68,52,68,67,68,68,68,51,68,36,67,68,68,67,68,68,68,68,3,52,52,36,67,
+            52,68,67,68,68,68,68,68,68,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,68,68,68,68,67,68,19,65,68,17,49,67,67,68,68,68,68,68,52,52,19,17,68,
+            20,49,68,52,68,68,68,68,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 93
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,52,68,4,68,68,67,68,68,68,
+            68,68,68,52,68,67,68,68,68,52,68,36,67,68,68,67,68,68,68,68,3,52,52,36,67,
+            68,68,67,68,68,68,68,68,68,4,68,68,68,68,68,52,68,68,68,68,68,68,67,68,65,
+            68,68,68,68,68,68,67,68,19,65,68,49,49,67,68,68,68,68,68,68,68,52,19,19,68,
+            20,49,68,52,68,68,68,68,68,68,20,68,52,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 94
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,52,68,36,67,68,68,68,68,68,68,68,3,52,52,36,67,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,52,68,68,68,68,68,68,68,68,66,
+            68,68,68,68,68,68,67,68,19,65,68,49,65,67,68,68,68,68,68,68,68,52,20,19,68,
+            20,49,68,52,68,68,68,68,68,68,36,68,68,68,68,68,68,68,68,67,68,68,68,68,4,
+        },
+        // Quality 95
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,
+            68,68,68,52,68,68,68,68,68,52,68,36,67,68,68,68,68,68,68,68,4,52,68,36,67,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,66,
+            68,68,68,68,68,68,67,68,19,65,68,51,65,67,68,68,68,68,68,68,68,52,20,51,68,
+            20,49,68,52,68,68,68,68,68,68,36,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+        // Quality 96
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,223,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,36,67,68,68,68,68,68,68,68,4,68,68,36,67,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,66,
+            68,68,68,68,68,68,67,68,20,65,68,51,66,68,68,68,68,68,68,68,68,68,36,51,68,
+            20,65,68,52,68,68,68,68,68,68,36,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+        // Quality 97
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,20,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,36,68,68,68,68,68,68,68,68,20,68,68,36,68,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,66,
+            68,68,68,68,68,68,68,68,20,66,68,51,67,68,68,68,68,68,68,68,68,68,52,51,68,
+            36,65,68,68,68,68,68,68,68,68,36,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+        // Quality 98
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,36,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,36,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,
+            68,68,68,68,68,68,68,68,36,66,68,67,67,68,68,68,68,68,68,68,68,68,52,52,68,
+            36,66,68,68,68,68,68,68,68,68,52,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+        // Quality 99
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,36,66,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            36,66,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+        // Quality 100
+        {
+            67,86,80,55,1,0,250,0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+            255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,0,0,0,0,0,0,0,0,
+            4,4,4,4,4,4,4,4,4,4,4,4,1,64,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,4,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+            68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,4,
+        },
+    };
+}}}
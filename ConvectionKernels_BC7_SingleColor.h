@@ -19,7 +19,7 @@ struct Table
     TableEntry m_entries[256];
 };
 
-Table g_mode0_p00_i1=
+const Table g_mode0_p00_i1=
 {
     1,
     0,
@@ -59,7 +59,7 @@ Table g_mode0_p00_i1=
     }
 };
 
-Table g_mode0_p00_i2=
+const Table g_mode0_p00_i2=
 {
     2,
     0,
@@ -99,7 +99,7 @@ Table g_mode0_p00_i2=
     }
 };
 
-Table g_mode0_p00_i3=
+const Table g_mode0_p00_i3=
 {
     3,
     0,
@@ -139,7 +139,7 @@ Table g_mode0_p00_i3=
     }
 };
 
-Table g_mode0_p01_i1=
+const Table g_mode0_p01_i1=
 {
     1,
     2,
@@ -179,7 +179,7 @@ Table g_mode0_p01_i1=
     }
 };
 
-Table g_mode0_p01_i2=
+const Table g_mode0_p01_i2=
 {
     2,
     2,
@@ -219,7 +219,7 @@ Table g_mode0_p01_i2=
     }
 };
 
-Table g_mode0_p01_i3=
+const Table g_mode0_p01_i3=
 {
     3,
     2,
@@ -259,7 +259,7 @@ Table g_mode0_p01_i3=
     }
 };
 
-Table g_mode0_p10_i1=
+const Table g_mode0_p10_i1=
 {
     1,
     1,
@@ -299,7 +299,7 @@ Table g_mode0_p10_i1=
     }
 };
 
-Table g_mode0_p10_i2=
+const Table g_mode0_p10_i2=
 {
     2,
     1,
@@ -339,7 +339,7 @@ Table g_mode0_p10_i2=
     }
 };
 
-Table g_mode0_p10_i3=
+const Table g_mode0_p10_i3=
 {
     3,
     3,
@@ -379,7 +379,7 @@ Table g_mode0_p10_i3=
     }
 };
 
-Table g_mode0_p11_i1=
+const Table g_mode0_p11_i1=
 {
     1,
     3,
@@ -419,7 +419,7 @@ Table g_mode0_p11_i1=
     }
 };
 
-Table g_mode0_p11_i2=
+const Table g_mode0_p11_i2=
 {
     2,
     3,
@@ -459,7 +459,7 @@ Table g_mode0_p11_i2=
     }
 };
 
-Table g_mode0_p11_i3=
+const Table g_mode0_p11_i3=
 {
     3,
     3,
@@ -499,7 +499,7 @@ Table g_mode0_p11_i3=
     }
 };
 
-Table g_mode1_p0_i1=
+const Table g_mode1_p0_i1=
 {
     1,
     0,
@@ -539,7 +539,7 @@ Table g_mode1_p0_i1=
     }
 };
 
-Table g_mode1_p0_i2=
+const Table g_mode1_p0_i2=
 {
     2,
     0,
@@ -579,7 +579,7 @@ Table g_mode1_p0_i2=
     }
 };
 
-Table g_mode1_p0_i3=
+const Table g_mode1_p0_i3=
 {
     3,
     0,
@@ -619,7 +619,7 @@ Table g_mode1_p0_i3=
     }
 };
 
-Table g_mode1_p1_i1=
+const Table g_mode1_p1_i1=
 {
     1,
     1,
@@ -659,7 +659,7 @@ Table g_mode1_p1_i1=
     }
 };
 
-Table g_mode1_p1_i2=
+const Table g_mode1_p1_i2=
 {
     2,
     1,
@@ -699,7 +699,7 @@ Table g_mode1_p1_i2=
     }
 };
 
-Table g_mode1_p1_i3=
+const Table g_mode1_p1_i3=
 {
     3,
     1,
@@ -739,7 +739,7 @@ Table g_mode1_p1_i3=
     }
 };
 
-Table g_mode2=
+const Table g_mode2=
 {
     1,
     0,
@@ -779,7 +779,7 @@ Table g_mode2=
     }
 };
 
-Table g_mode3_p0=
+const Table g_mode3_p0=
 {
     1,
     0,
@@ -819,7 +819,7 @@ Table g_mode3_p0=
     }
 };
 
-Table g_mode3_p1=
+const Table g_mode3_p1=
 {
     1,
     1,
@@ -859,7 +859,7 @@ Table g_mode3_p1=
     }
 };
 
-Table g_mode4_rgb_low=
+const Table g_mode4_rgb_low=
 {
     1,
     0,
@@ -899,7 +899,7 @@ Table g_mode4_rgb_low=
     }
 };
 
-Table g_mode4_rgb_high_i1=
+const Table g_mode4_rgb_high_i1=
 {
     1,
     0,
@@ -939,7 +939,7 @@ Table g_mode4_rgb_high_i1=
     }
 };
 
-Table g_mode4_rgb_high_i2=
+const Table g_mode4_rgb_high_i2=
 {
     2,
     0,
@@ -979,7 +979,7 @@ Table g_mode4_rgb_high_i2=
     }
 };
 
-Table g_mode4_rgb_high_i3=
+const Table g_mode4_rgb_high_i3=
 {
     3,
     0,
@@ -1019,7 +1019,7 @@ Table g_mode4_rgb_high_i3=
     }
 };
 
-Table g_mode4_a_low=
+const Table g_mode4_a_low=
 {
     1,
     0,
@@ -1059,7 +1059,7 @@ Table g_mode4_a_low=
     }
 };
 
-Table g_mode4_a_high_i1=
+const Table g_mode4_a_high_i1=
 {
     1,
     0,
@@ -1099,7 +1099,7 @@ Table g_mode4_a_high_i1=
     }
 };
 
-Table g_mode4_a_high_i2=
+const Table g_mode4_a_high_i2=
 {
     2,
     0,
@@ -1139,7 +1139,7 @@ Table g_mode4_a_high_i2=
     }
 };
 
-Table g_mode4_a_high_i3=
+const Table g_mode4_a_high_i3=
 {
     3,
     0,
@@ -1179,7 +1179,7 @@ Table g_mode4_a_high_i3=
     }
 };
 
-Table g_mode5_rgb_low=
+const Table g_mode5_rgb_low=
 {
     1,
     0,
@@ -1219,7 +1219,7 @@ Table g_mode5_rgb_low=
     }
 };
 
-Table g_mode6_p0_i1=
+const Table g_mode6_p0_i1=
 {
     1,
     0,
@@ -1259,7 +1259,7 @@ Table g_mode6_p0_i1=
     }
 };
 
-Table g_mode6_p0_i2=
+const Table g_mode6_p0_i2=
 {
     2,
     0,
@@ -1299,7 +1299,7 @@ Table g_mode6_p0_i2=
     }
 };
 
-Table g_mode6_p0_i3=
+const Table g_mode6_p0_i3=
 {
     3,
     0,
@@ -1339,7 +1339,7 @@ Table g_mode6_p0_i3=
     }
 };
 
-Table g_mode6_p0_i4=
+const Table g_mode6_p0_i4=
 {
     4,
     0,
@@ -1379,7 +1379,7 @@ Table g_mode6_p0_i4=
     }
 };
 
-Table g_mode6_p0_i5=
+const Table g_mode6_p0_i5=
 {
     5,
     0,
@@ -1419,7 +1419,7 @@ Table g_mode6_p0_i5=
     }
 };
 
-Table g_mode6_p0_i6=
+const Table g_mode6_p0_i6=
 {
     6,
     0,
@@ -1459,7 +1459,7 @@ Table g_mode6_p0_i6=
     }
 };
 
-Table g_mode6_p0_i7=
+const Table g_mode6_p0_i7=
 {
     7,
     0,
@@ -1499,7 +1499,7 @@ Table g_mode6_p0_i7=
     }
 };
 
-Table g_mode6_p1_i1=
+const Table g_mode6_p1_i1=
 {
     1,
     1,
@@ -1539,7 +1539,7 @@ Table g_mode6_p1_i1=
     }
 };
 
-Table g_mode6_p1_i2=
+const Table g_mode6_p1_i2=
 {
     2,
     1,
@@ -1579,7 +1579,7 @@ Table g_mode6_p1_i2=
     }
 };
 
-Table g_mode6_p1_i3=
+const Table g_mode6_p1_i3=
 {
     3,
     1,
@@ -1619,7 +1619,7 @@ Table g_mode6_p1_i3=
     }
 };
 
-Table g_mode6_p1_i4=
+const Table g_mode6_p1_i4=
 {
     4,
     1,
@@ -1659,7 +1659,7 @@ Table g_mode6_p1_i4=
     }
 };
 
-Table g_mode6_p1_i5=
+const Table g_mode6_p1_i5=
 {
     5,
     1,
@@ -1699,7 +1699,7 @@ Table g_mode6_p1_i5=
     }
 };
 
-Table g_mode6_p1_i6=
+const Table g_mode6_p1_i6=
 {
     6,
     1,
@@ -1739,7 +1739,7 @@ Table g_mode6_p1_i6=
     }
 };
 
-Table g_mode6_p1_i7=
+const Table g_mode6_p1_i7=
 {
     7,
     1,
@@ -1779,7 +1779,7 @@ Table g_mode6_p1_i7=
     }
 };
 
-Table g_mode7_p00=
+const Table g_mode7_p00=
 {
     1,
     0,
@@ -1819,7 +1819,7 @@ Table g_mode7_p00=
     }
 };
 
-Table g_mode7_p01=
+const Table g_mode7_p01=
 {
     1,
     2,
@@ -1859,7 +1859,7 @@ Table g_mode7_p01=
     }
 };
 
-Table g_mode7_p10=
+const Table g_mode7_p10=
 {
     1,
     1,
@@ -1899,7 +1899,7 @@ Table g_mode7_p10=
     }
 };
 
-Table g_mode7_p11=
+const Table g_mode7_p11=
 {
     1,
     3,
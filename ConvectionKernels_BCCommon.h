@@ -7,6 +7,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         class BCCommon
@@ -99,6 +100,7 @@ namespace cvtt
             }
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
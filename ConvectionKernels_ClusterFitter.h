@@ -0,0 +1,91 @@
+#pragma once
+#ifndef __CVTT_CLUSTERFITTER_H__
+#define __CVTT_CLUSTERFITTER_H__
+
+#include "ConvectionKernels_EndpointRefiner.h"
+#include "ConvectionKernels_ParallelMath.h"
+
+namespace cvtt
+{
+    CVTT_ISA_NAMESPACE_BEGIN
+    namespace Internal
+    {
+        // Fits endpoints to an ordered set of pixels split into consecutive clusters, where every pixel in cluster i uses index i.
+        // Prefix sums over the ordering are computed once, so the least squares totals for any set of cluster sizes cost O(1)
+        // instead of one EndpointRefiner contribution per pixel.
+        //
+        // With cluster boundaries s[j] = counts[0] + ... + counts[j - 1], the sum of i * (P[s[i + 1]] - P[s[i]]) telescopes to
+        // (range - 1) * P[16] - P[s[1]] - ... - P[s[range - 1]], and the sum of i * i * (W[s[i + 1]] - W[s[i]]) to
+        // (range - 1)^2 * W[16] - the sum of (2j - 1) * W[s[j]].
+        template<int TVectorSize>
+        class ClusterFitter
+        {
+        public:
+            typedef ParallelMath::Float MFloat;
+            typedef ParallelMath::UInt15 MUInt15;
+
+            // Only the first numElements pixels of the ordering contribute to the fit
+            void Init(const MFloat preWeightedSortedPixels[16][TVectorSize], const MUInt15 &numElements)
+            {
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    m_prefixV[0][ch] = ParallelMath::MakeFloatZero();
+                m_prefixW[0] = ParallelMath::MakeFloatZero();
+
+                for (int e = 0; e < 16; e++)
+                {
+                    ParallelMath::FloatCompFlag valid = ParallelMath::Int16FlagToFloat(ParallelMath::Less(ParallelMath::MakeUInt15(static_cast<uint16_t>(e)), numElements));
+                    MFloat weight = ParallelMath::Select(valid, ParallelMath::MakeFloat(1.0f), ParallelMath::MakeFloatZero());
+
+                    for (int ch = 0; ch < TVectorSize; ch++)
+                        m_prefixV[e + 1][ch] = m_prefixV[e][ch] + preWeightedSortedPixels[e][ch] * weight;
+                    m_prefixW[e + 1] = m_prefixW[e] + weight;
+                }
+            }
+
+            void GetRefinedEndpointsLDR(const int *counts, int range, const float channelWeights[TVectorSize], MUInt15 endPoint[2][TVectorSize], const ParallelMath::RoundTowardNearestForScope *roundingMode) const
+            {
+                EndpointRefiner<TVectorSize> refiner;
+                refiner.Init(range, channelWeights);
+
+                const float maxIndex = static_cast<float>(range - 1);
+
+                MFloat tvScaled[TVectorSize];
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    tvScaled[ch] = m_prefixV[16][ch] * maxIndex;
+
+                MFloat tScaled = m_prefixW[16] * maxIndex;
+                MFloat ttScaled = m_prefixW[16] * (maxIndex * maxIndex);
+
+                int boundary = 0;
+                for (int j = 1; j < range; j++)
+                {
+                    boundary += counts[j - 1];
+
+                    for (int ch = 0; ch < TVectorSize; ch++)
+                        tvScaled[ch] = tvScaled[ch] - m_prefixV[boundary][ch];
+
+                    tScaled = tScaled - m_prefixW[boundary];
+                    ttScaled = ttScaled - m_prefixW[boundary] * static_cast<float>(j * 2 - 1);
+                }
+
+                for (int ch = 0; ch < TVectorSize; ch++)
+                {
+                    refiner.m_tv[ch] = tvScaled[ch] * refiner.m_rcpMaxIndex;
+                    refiner.m_v[ch] = m_prefixV[16][ch];
+                }
+                refiner.m_t = tScaled * refiner.m_rcpMaxIndex;
+                refiner.m_tt = ttScaled * (refiner.m_rcpMaxIndex * refiner.m_rcpMaxIndex);
+                refiner.m_w = m_prefixW[16];
+
+                refiner.GetRefinedEndpointsLDR(endPoint, roundingMode);
+            }
+
+        private:
+            MFloat m_prefixV[17][TVectorSize];
+            MFloat m_prefixW[17];
+        };
+    }
+    CVTT_ISA_NAMESPACE_END
+}
+
+#endif
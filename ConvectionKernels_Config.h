@@ -6,7 +6,76 @@
 #define CVTT_USE_SSE2
 #endif
 
+// Define this to use SSE4.1 instructions in the SSE2 code path (requires SSE4.1 code generation on GCC and Clang, e.g. -msse4.1)
+//#define CVTT_USE_SSE41
+
+// Define this to use AVX2, which doubles NumParallelBlocks to 16 (requires AVX2 code generation, e.g. /arch:AVX2 or -mavx2)
+//#define CVTT_USE_AVX2
+
+// Define this to use AVX-512BW, which raises NumParallelBlocks to 32 (requires AVX-512BW code generation, e.g. /arch:AVX512 or -mavx512bw)
+//#define CVTT_USE_AVX512
+
+// Define this to compile the encoders once each for SSE2, SSE4.1, AVX2, and AVX-512BW, and pick the widest one supported by the CPU
+// at runtime.  NumParallelBlocks is 32 regardless of which one is used.  The instruction set options above must be left undefined,
+// and ConvectionKernels_ISA_*.cpp must each be compiled with the matching code generation options.
+//#define CVTT_USE_RUNTIME_DISPATCH
+
+#if defined(CVTT_USE_RUNTIME_DISPATCH)
+#if defined(CVTT_USE_SSE41) || defined(CVTT_USE_AVX2) || defined(CVTT_USE_AVX512)
+#error "Instruction set options can't be combined with CVTT_USE_RUNTIME_DISPATCH"
+#endif
+
+#if !defined(CVTT_USE_SSE2)
+#error "CVTT_USE_RUNTIME_DISPATCH requires SSE2"
+#endif
+
+#if defined(CVTT_DISPATCH_ISA_AVX512)
+#define CVTT_USE_AVX512
+#elif defined(CVTT_DISPATCH_ISA_AVX2)
+#define CVTT_USE_AVX2
+#elif defined(CVTT_DISPATCH_ISA_SSE41)
+#define CVTT_USE_SSE41
+#endif
+#endif
+
+#if defined(CVTT_USE_SSE41) && (!defined(CVTT_USE_SSE2) || (defined(__GNUC__) && !defined(__SSE4_1__)))
+#error "CVTT_USE_SSE41 requires SSE4.1 code generation to be enabled"
+#endif
+
+#if defined(CVTT_USE_AVX2) && !defined(__AVX2__)
+#error "CVTT_USE_AVX2 requires AVX2 code generation to be enabled"
+#endif
+
+#if defined(CVTT_USE_AVX512) && !defined(__AVX512BW__)
+#error "CVTT_USE_AVX512 requires AVX-512BW code generation to be enabled"
+#endif
+
+// Everything that depends on the instruction set is placed in an inline namespace named after it, so that runtime dispatch
+// builds can link several versions of the encoders together
+#if defined(CVTT_USE_AVX512)
+#define CVTT_ISA_NAMESPACE ISA_AVX512
+#elif defined(CVTT_USE_AVX2)
+#define CVTT_ISA_NAMESPACE ISA_AVX2
+#elif defined(CVTT_USE_SSE41)
+#define CVTT_ISA_NAMESPACE ISA_SSE41
+#elif defined(CVTT_USE_SSE2)
+#define CVTT_ISA_NAMESPACE ISA_SSE2
+#else
+#define CVTT_ISA_NAMESPACE ISA_Scalar
+#endif
+
+#define CVTT_ISA_NAMESPACE_BEGIN inline namespace CVTT_ISA_NAMESPACE {
+#define CVTT_ISA_NAMESPACE_END }
+
+// Define this to collect per-stage BC7 encoder timings, which can be retrieved with Kernels::GetBC7InstrumentationStats.
+// This has no cost when it isn't defined.
+//#define CVTT_ENABLE_INSTRUMENTATION
+
 // Define this to compile everything as a single source file
 //#define CVTT_SINGLE_FILE
 
+#if defined(CVTT_SINGLE_FILE) && defined(CVTT_USE_RUNTIME_DISPATCH)
+#error "CVTT_SINGLE_FILE can't be combined with CVTT_USE_RUNTIME_DISPATCH"
+#endif
+
 #endif
@@ -0,0 +1,136 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels_Dispatch.h"
+
+#if defined(CVTT_USE_RUNTIME_DISPATCH)
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace cvtt
+{
+    namespace Dispatch
+    {
+        namespace CPUID
+        {
+            static void Query(uint32_t leaf, uint32_t subLeaf, uint32_t outRegs[4])
+            {
+#if defined(_MSC_VER)
+                int regs[4];
+                __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subLeaf));
+                for (int i = 0; i < 4; i++)
+                    outRegs[i] = static_cast<uint32_t>(regs[i]);
+#else
+                unsigned int eax, ebx, ecx, edx;
+                __cpuid_count(leaf, subLeaf, eax, ebx, ecx, edx);
+                outRegs[0] = eax;
+                outRegs[1] = ebx;
+                outRegs[2] = ecx;
+                outRegs[3] = edx;
+#endif
+            }
+
+            static uint64_t ReadXCR0()
+            {
+#if defined(_MSC_VER)
+                return _xgetbv(0);
+#else
+                uint32_t eax, edx;
+                __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+                return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+            }
+        }
+
+        static const KernelSet &SelectKernelSet()
+        {
+            uint32_t regs[4];
+
+            CPUID::Query(0, 0, regs);
+            const uint32_t maxLeaf = regs[0];
+
+            if (maxLeaf < 1)
+                return GetKernelSetSSE2();
+
+            CPUID::Query(1, 0, regs);
+            const uint32_t features1ECX = regs[2];
+
+            const bool haveSSE41 = ((features1ECX >> 19) & 1) != 0;
+            const bool haveOSXSAVE = ((features1ECX >> 27) & 1) != 0;
+            const bool haveAVX = ((features1ECX >> 28) & 1) != 0;
+
+            uint32_t features7EBX = 0;
+            if (maxLeaf >= 7)
+            {
+                CPUID::Query(7, 0, regs);
+                features7EBX = regs[1];
+            }
+
+            // The OS must save the YMM (and for AVX-512, opmask and ZMM) state, otherwise the instructions are unusable
+            uint64_t xcr0 = 0;
+            if (haveOSXSAVE)
+                xcr0 = CPUID::ReadXCR0();
+
+            const bool osSavesYMM = ((xcr0 & 0x6) == 0x6);
+            const bool osSavesZMM = ((xcr0 & 0xe6) == 0xe6);
+
+            const bool haveAVX2 = haveAVX && osSavesYMM && ((features7EBX >> 5) & 1) != 0;
+            const bool haveAVX512BW = haveAVX2 && osSavesZMM && ((features7EBX >> 16) & 1) != 0 && ((features7EBX >> 30) & 1) != 0;
+
+            if (haveAVX512BW)
+                return GetKernelSetAVX512();
+            if (haveAVX2)
+                return GetKernelSetAVX2();
+            if (haveSSE41)
+                return GetKernelSetSSE41();
+
+            return GetKernelSetSSE2();
+        }
+    }
+}
+
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSet()
+{
+    static const KernelSet &kernelSet = SelectKernelSet();
+    return kernelSet;
+}
+
+#else
+
+const cvtt::Dispatch::KernelSet &cvtt::Dispatch::GetKernelSet()
+{
+    return GetCompiledKernelSet();
+}
+
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+#ifndef __CVTT_DISPATCH_H__
+#define __CVTT_DISPATCH_H__
+
+#include "ConvectionKernels.h"
+
+namespace cvtt
+{
+    namespace Dispatch
+    {
+        // Encoder and decoder entry points compiled for one instruction set
+        struct KernelSet
+        {
+            void (*m_encodeBC1)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC2)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC3)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC4U)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC4S)(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC5U)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC5S)(uint8_t *pBC, const PixelBlockS8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC6HU)(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC6HS)(uint8_t *pBC, const PixelBlockF16 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeBC7)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, const BC7EncodingPlan &encodingPlan);
+            void (*m_encodeETC1)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC1CompressionData *compressionData);
+            void (*m_encodeETC2)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC2CompressionData *compressionData);
+            void (*m_encodeETC2RGBA)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC2CompressionData *compressionData);
+            void (*m_encodeETC2PunchthroughAlpha)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options, ETC2CompressionData *compressionData);
+            void (*m_encodeETC2Alpha)(uint8_t *pBC, const PixelBlockU8 *pBlocks, size_t numBlocks, const Options &options);
+            void (*m_encodeETC2Alpha11)(uint8_t *pBC, const PixelBlockScalarS16 *pBlocks, size_t numBlocks, bool isSigned, const Options &options);
+
+            void (*m_decodeBC1)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC2)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC3)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC4U)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC4S)(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC5U)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC5S)(PixelBlockS8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeETC2)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeETC2RGBA)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeETC2PunchthroughAlpha)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeETC2Alpha)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeETC2Alpha11)(PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned);
+            void (*m_decodeETC2RG11)(PixelBlockScalarS16 *pRedBlocks, PixelBlockScalarS16 *pGreenBlocks, const uint8_t *pBC, size_t numBlocks, bool isSigned);
+            void (*m_decodeBC6HU)(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC6HS)(PixelBlockF16 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+            void (*m_decodeBC7)(PixelBlockU8 *pBlocks, const uint8_t *pBC, size_t numBlocks);
+
+            // ETC compression data layout depends on the instruction set, so it must come from the same kernel set
+            ETC1CompressionData *(*m_allocETC1Data)(Kernels::allocFunc_t allocFunc, void *context);
+            void (*m_releaseETC1Data)(ETC1CompressionData *compressionData, Kernels::freeFunc_t freeFunc);
+            ETC2CompressionData *(*m_allocETC2Data)(Kernels::allocFunc_t allocFunc, void *context, const Options &options);
+            void (*m_releaseETC2Data)(ETC2CompressionData *compressionData, Kernels::freeFunc_t freeFunc);
+        };
+
+        // Returns the kernel set used by the API, which is selected once on first use
+        const KernelSet &GetKernelSet();
+
+#if defined(CVTT_USE_RUNTIME_DISPATCH)
+        const KernelSet &GetKernelSetSSE2();
+        const KernelSet &GetKernelSetSSE41();
+        const KernelSet &GetKernelSetAVX2();
+        const KernelSet &GetKernelSetAVX512();
+#else
+        const KernelSet &GetCompiledKernelSet();
+#endif
+    }
+}
+
+#endif
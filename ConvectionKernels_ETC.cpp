@@ -41,8 +41,9 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 #include "ConvectionKernels_ETC2_Rounding.h"
 #include "ConvectionKernels_ParallelMath.h"
 #include "ConvectionKernels_FakeBT709_Rounding.h"
+#include "ConvectionKernels_Util.h"
 
-#include <cmath>
+#include <math.h>
 
 const int cvtt::Internal::ETCComputer::g_flipTables[2][2][8] =
 {
@@ -306,7 +307,7 @@ void cvtt::Internal::ETCComputer::FindBestDifferentialCombination(int flip, int
                     sp.diffErrors = drs.diffErrors[sector];
                     sp.block = block;
 
-                    std::sort<uint16_t*, const SortPredicate&>(drs.attemptSortIndexes[sector], drs.attemptSortIndexes[sector] + numSortIndexes[sector], sp);
+                    Util::Sort(drs.attemptSortIndexes[sector], drs.attemptSortIndexes[sector] + numSortIndexes[sector], sp);
                 }
 
                 int scannedElements = 0;
@@ -572,7 +573,7 @@ void cvtt::Internal::ETCComputer::EncodeTMode(uint8_t *outputBuffer, MFloat &bes
             uint16_t fillColor = ParallelMath::Extract(uniqueQuantizedColors[0], block);
 
             int numUnique = numUniqueColors[block];
-            for (int fill = numUnique + 1; fill < maxUniqueColors; fill++)
+            for (int fill = numUnique; fill < maxUniqueColors; fill++)
                 ParallelMath::PutUInt15(uniqueQuantizedColors[fill], block, fillColor);
         }
 
@@ -714,7 +715,7 @@ void cvtt::Internal::ETCComputer::EncodeHMode(uint8_t *outputBuffer, MFloat &bes
                         if (blockSectorCounts == 0)
                             quantized[ch] = 0;
                         else
-                            quantized[ch] = std::min<int16_t>(15, std::max<int16_t>(0, (blockSectorTotals[ch] * 2 + blockSectorCounts * 17 + modifierOffset * offsetPremultiplier)) / (blockSectorCounts * 34));
+                            quantized[ch] = Util::Min<int16_t>(15, Util::Max<int16_t>(0, (blockSectorTotals[ch] * 2 + blockSectorCounts * 17 + modifierOffset * offsetPremultiplier)) / (blockSectorCounts * 34));
                     }
 
                     uint16_t packedColor = (quantized[0] << 10) | (quantized[1] << 5) | quantized[2];
@@ -739,7 +740,7 @@ void cvtt::Internal::ETCComputer::EncodeHMode(uint8_t *outputBuffer, MFloat &bes
         MUInt15 totalColors = he.numUniqueColors[0] + he.numUniqueColors[1];
         int maxErrorColors = 0;
         for (int block = 0; block < ParallelMath::ParallelSize; block++)
-            maxErrorColors = std::max<int>(maxErrorColors, ParallelMath::Extract(totalColors, block));
+            maxErrorColors = Util::Max<int>(maxErrorColors, ParallelMath::Extract(totalColors, block));
 
         for (int block = 0; block < ParallelMath::ParallelSize; block++)
         {
@@ -1043,7 +1044,8 @@ void cvtt::Internal::ETCComputer::EncodeVirtualTModePunchthrough(uint8_t *output
 
         for (int16_t offsetPremultiplier = clusterMinLine; offsetPremultiplier <= clusterMaxLine; offsetPremultiplier += 2)
         {
-            MSInt16 clampedOffsetPremultiplier = ParallelMath::Max(minLine, ParallelMath::Min(maxLine, ParallelMath::MakeSInt16(offsetPremultiplier)));
+            // Step from each block's own minimum, otherwise blocks with a different line pixel count parity than the cluster maximum try different offsets
+            MSInt16 clampedOffsetPremultiplier = ParallelMath::Min(maxLine, minLine + ParallelMath::MakeSInt16(static_cast<int16_t>(offsetPremultiplier - clusterMinLine)));
             MSInt16 modifierAddend = ParallelMath::CompactMultiply(clampedOffsetPremultiplier, modifierOffset);
 
             MUInt15 quantized[3];
@@ -1111,7 +1113,7 @@ void cvtt::Internal::ETCComputer::EncodeVirtualTModePunchthrough(uint8_t *output
             uint16_t fillColor = ParallelMath::Extract(uniqueQuantizedColors[0], block);
 
             int numUnique = numUniqueColors[block];
-            for (int fill = numUnique + 1; fill < maxUniqueColors; fill++)
+            for (int fill = numUnique; fill < maxUniqueColors; fill++)
                 ParallelMath::PutUInt15(uniqueQuantizedColors[fill], block, fillColor);
         }
 
@@ -1669,10 +1671,10 @@ void cvtt::Internal::ETCComputer::CompressETC2Block(uint8_t *outputBuffer, const
 
     if (punchthroughAlpha)
     {
-        const float fThreshold = std::max<float>(std::min<float>(1.0f, options.threshold), 0.0f) * 255.0f;
+        const float fThreshold = Util::Max<float>(Util::Min<float>(1.0f, options.threshold), 0.0f) * 255.0f;
 
         // +1.0f is intentional, we want to take the next valid integer (even if it's 256) since everything else lower is transparent
-        MUInt15 threshold = ParallelMath::MakeUInt15(static_cast<uint16_t>(std::floor(fThreshold + 1.0f)));
+        MUInt15 threshold = ParallelMath::MakeUInt15(static_cast<uint16_t>(floorf(fThreshold + 1.0f)));
 
         for (int px = 0; px < 16; px++)
         {
@@ -2041,6 +2043,7 @@ void cvtt::Internal::ETCComputer::CompressETC2AlphaBlockInternal(uint8_t *output
     if (is11Bit)
     {
         bestMultiplier = ParallelMath::RightShift(bestMultiplier, 3);
+        bestBaseCodeword = ParallelMath::RightShift(bestBaseCodeword, 3);
 
         if (isSigned)
             bestBaseCodeword = bestBaseCodeword ^ ParallelMath::MakeUInt15(0x80);
@@ -2498,7 +2501,7 @@ void cvtt::Internal::ETCComputer::EmitHModeBlock(uint8_t *outputBuffer, const Pa
     if (((table & 1) == 1) != (blockColors[0] > blockColors[1]))
     {
         for (int ch = 0; ch < 3; ch++)
-            std::swap(colors[0][ch], colors[1][ch]);
+            Util::Swap(colors[0][ch], colors[1][ch]);
         sectorBits ^= 0xffff;
     }
 
@@ -2781,7 +2784,7 @@ void cvtt::Internal::ETCComputer::CompressETC1BlockInternal(MFloat &bestTotalErr
 
                     int maxUniqueColors = ParallelMath::Extract(numUniqueColors, 0);
                     for (int block = 1; block < ParallelMath::ParallelSize; block++)
-                        maxUniqueColors = std::max<int>(maxUniqueColors, ParallelMath::Extract(numUniqueColors, block));
+                        maxUniqueColors = Util::Max<int>(maxUniqueColors, ParallelMath::Extract(numUniqueColors, block));
 
                     for (int block = 0; block < ParallelMath::ParallelSize; block++)
                     {
@@ -2957,7 +2960,7 @@ void cvtt::Internal::ETCComputer::CompressETC1PunchthroughBlockInternal(MFloat &
 
             int sectorMaxOpaque = 0;
             for (int block = 0; block < ParallelMath::ParallelSize; block++)
-                sectorMaxOpaque = std::max<int>(sectorMaxOpaque, ParallelMath::Extract(sectorNumOpaque, block));
+                sectorMaxOpaque = Util::Max<int>(sectorMaxOpaque, ParallelMath::Extract(sectorNumOpaque, block));
 
             int sectorNumOpaqueMultipliers = sectorMaxOpaque * 2 + 1;
 
@@ -3019,7 +3022,7 @@ void cvtt::Internal::ETCComputer::CompressETC1PunchthroughBlockInternal(MFloat &
 
                 int maxUniqueColors = ParallelMath::Extract(numUniqueColors, 0);
                 for (int block = 1; block < ParallelMath::ParallelSize; block++)
-                    maxUniqueColors = std::max<int>(maxUniqueColors, ParallelMath::Extract(numUniqueColors, block));
+                    maxUniqueColors = Util::Max<int>(maxUniqueColors, ParallelMath::Extract(numUniqueColors, block));
 
                 for (int block = 0; block < ParallelMath::ParallelSize; block++)
                 {
@@ -3079,43 +3082,438 @@ void cvtt::Internal::ETCComputer::CompressETC1PunchthroughBlockInternal(MFloat &
     }
 }
 
+cvtt::ParallelMath::Int16CompFlag cvtt::Internal::ETCComputer::IsMaskBitSet(const MUInt16 &mask, int bit)
+{
+    MUInt15 maskBit = ParallelMath::ToUInt15(ParallelMath::RightShift(mask, bit) & ParallelMath::MakeUInt16(1));
+    return ParallelMath::Equal(maskBit, ParallelMath::MakeUInt15(1));
+}
+
+cvtt::ParallelMath::UInt15 cvtt::Internal::ETCComputer::SelectFromPalette(const MUInt15 palette[8], const ParallelMath::Int16CompFlag indexBits[3])
+{
+    MUInt15 pair[4];
+    for (int i = 0; i < 4; i++)
+        pair[i] = ParallelMath::Select(indexBits[0], palette[i * 2 + 1], palette[i * 2]);
+
+    MUInt15 quad[2];
+    for (int i = 0; i < 2; i++)
+        quad[i] = ParallelMath::Select(indexBits[1], pair[i * 2 + 1], pair[i * 2]);
+
+    return ParallelMath::Select(indexBits[2], quad[1], quad[0]);
+}
+
+void cvtt::Internal::ETCComputer::UnpackPlanarPixels(const MUInt15 origin[3], const MUInt15 horizontal[3], const MUInt15 vertical[3], const ParallelMath::Int16CompFlag &isPlanar, MUInt15 outPixels[16][4])
+{
+    for (int ch = 0; ch < 3; ch++)
+    {
+        MSInt16 o = ParallelMath::ToSInt16(origin[ch]);
+        MSInt16 dh = ParallelMath::ToSInt16(horizontal[ch]) - o;
+        MSInt16 dv = ParallelMath::ToSInt16(vertical[ch]) - o;
+
+        MSInt16 rowStart = (o << 2) + ParallelMath::MakeSInt16(2);
+        for (int y = 0; y < 4; y++)
+        {
+            MSInt16 value = rowStart;
+            for (int x = 0; x < 4; x++)
+            {
+                MSInt16 clamped = ParallelMath::Max(ParallelMath::MakeSInt16(0), ParallelMath::Min(ParallelMath::RightShift(value, 2), ParallelMath::MakeSInt16(255)));
+                ParallelMath::ConditionalSet(outPixels[y * 4 + x][ch], isPlanar, ParallelMath::LosslessCast<MUInt15>::Cast(clamped));
+                value = value + dh;
+            }
+            rowStart = rowStart + dv;
+        }
+    }
+
+    for (int px = 0; px < 16; px++)
+        ParallelMath::ConditionalSet(outPixels[px][3], isPlanar, ParallelMath::MakeUInt15(255));
+}
+
+void cvtt::Internal::ETCComputer::UnpackColor(const uint8_t *packedBlocks, size_t packedBlockStride, bool punchthroughAlpha, MUInt15 outPixels[16][4])
+{
+    // Blocks are parsed into scalar arrays first, since inserting lanes into a vector one at a time is slow.
+    // Selector and sector masks are in the block's column-major pixel order.
+    enum
+    {
+        LSBMask,
+        MSBMask,
+        SectorMask,
+        TransparentMask,
+
+        NumMasks,
+    };
+
+    uint16_t paletteValues[8][3][ParallelMath::ParallelSize];
+    uint16_t maskValues[NumMasks][ParallelMath::ParallelSize];
+    uint16_t planarValues[3][3][ParallelMath::ParallelSize];
+    bool planarFlags[ParallelMath::ParallelSize];
+    bool anyPlanar = false;
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        const uint8_t *packedBlock = packedBlocks + block * packedBlockStride;
+
+        const uint32_t highBits = (packedBlock[0] << 24) | (packedBlock[1] << 16) | (packedBlock[2] << 8) | packedBlock[3];
+        const uint32_t lowBits = (packedBlock[4] << 24) | (packedBlock[5] << 16) | (packedBlock[6] << 8) | packedBlock[7];
+
+        const bool diffBit = ((highBits >> 1) & 1) != 0;
+        const bool isDifferential = (punchthroughAlpha || diffBit);
+        const bool opaque = (!punchthroughAlpha || diffBit);
+
+        int blockPalette[8][3];
+        uint16_t blockSectorMask = 0;
+        bool blockIsPlanar = false;
+
+        int baseColors[2][3];
+        int dr = 0;
+        int dg = 0;
+        int db = 0;
+        int r = 0;
+        int g = 0;
+        int b = 0;
+
+        if (isDifferential)
+        {
+            r = (highBits >> 27) & 31;
+            g = (highBits >> 19) & 31;
+            b = (highBits >> 11) & 31;
+            dr = static_cast<int>((highBits >> 24) & 7) - static_cast<int>((highBits >> 24) & 4) * 2;
+            dg = static_cast<int>((highBits >> 16) & 7) - static_cast<int>((highBits >> 16) & 4) * 2;
+            db = static_cast<int>((highBits >> 8) & 7) - static_cast<int>((highBits >> 8) & 4) * 2;
+        }
+
+        if (isDifferential && (r + dr < 0 || r + dr > 31))
+        {
+            // T mode
+            int colors[2][3];
+            colors[0][0] = (((highBits >> 27) & 3) << 2) | ((highBits >> 24) & 3);
+            colors[0][1] = (highBits >> 20) & 15;
+            colors[0][2] = (highBits >> 16) & 15;
+            colors[1][0] = (highBits >> 12) & 15;
+            colors[1][1] = (highBits >> 8) & 15;
+            colors[1][2] = (highBits >> 4) & 15;
+
+            const int distance = Tables::ETC2::g_thModifierTable[(((highBits >> 2) & 3) << 1) | (highBits & 1)];
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                const int isolated = colors[0][ch] * 17;
+                const int line = colors[1][ch] * 17;
+
+                blockPalette[0][ch] = isolated;
+                blockPalette[1][ch] = Util::Min(line + distance, 255);
+                blockPalette[2][ch] = line;
+                blockPalette[3][ch] = Util::Max(line - distance, 0);
+            }
+        }
+        else if (isDifferential && (g + dg < 0 || g + dg > 31))
+        {
+            // H mode
+            int colors[2][3];
+            colors[0][0] = (highBits >> 27) & 15;
+            colors[0][1] = (((highBits >> 24) & 7) << 1) | ((highBits >> 20) & 1);
+            colors[0][2] = (((highBits >> 19) & 1) << 3) | ((highBits >> 15) & 7);
+            colors[1][0] = (highBits >> 11) & 15;
+            colors[1][1] = (highBits >> 7) & 15;
+            colors[1][2] = (highBits >> 3) & 15;
+
+            int packedColors[2];
+            for (int i = 0; i < 2; i++)
+                packedColors[i] = (colors[i][0] << 8) | (colors[i][1] << 4) | colors[i][2];
+
+            const int tableIndex = (((highBits >> 2) & 1) << 2) | ((highBits & 1) << 1) | ((packedColors[0] >= packedColors[1]) ? 1 : 0);
+            const int distance = Tables::ETC2::g_thModifierTable[tableIndex];
+
+            for (int i = 0; i < 2; i++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    const int color = colors[i][ch] * 17;
+
+                    blockPalette[i * 2 + 0][ch] = Util::Min(color + distance, 255);
+                    blockPalette[i * 2 + 1][ch] = Util::Max(color - distance, 0);
+                }
+            }
+        }
+        else if (isDifferential && (b + db < 0 || b + db > 31))
+        {
+            // Planar mode
+            blockIsPlanar = true;
+
+            int colors[3][3];
+            colors[0][0] = (highBits >> 25) & 63;
+            colors[0][1] = (((highBits >> 24) & 1) << 6) | ((highBits >> 17) & 63);
+            colors[0][2] = (((highBits >> 16) & 1) << 5) | (((highBits >> 11) & 3) << 3) | ((highBits >> 7) & 7);
+            colors[1][0] = (((highBits >> 2) & 31) << 1) | (highBits & 1);
+            colors[1][1] = (lowBits >> 25) & 127;
+            colors[1][2] = (lowBits >> 19) & 63;
+            colors[2][0] = (lowBits >> 13) & 63;
+            colors[2][1] = (lowBits >> 6) & 127;
+            colors[2][2] = lowBits & 63;
+
+            for (int i = 0; i < 3; i++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                    planarValues[i][ch][block] = static_cast<uint16_t>(colors[i][ch]);
+            }
+
+            for (int i = 0; i < 8; i++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                    blockPalette[i][ch] = 0;
+            }
+        }
+        else
+        {
+            if (isDifferential)
+            {
+                baseColors[0][0] = r;
+                baseColors[0][1] = g;
+                baseColors[0][2] = b;
+                baseColors[1][0] = r + dr;
+                baseColors[1][1] = g + dg;
+                baseColors[1][2] = b + db;
+
+                for (int sector = 0; sector < 2; sector++)
+                {
+                    for (int ch = 0; ch < 3; ch++)
+                        baseColors[sector][ch] = (baseColors[sector][ch] << 3) | (baseColors[sector][ch] >> 2);
+                }
+            }
+            else
+            {
+                for (int sector = 0; sector < 2; sector++)
+                {
+                    for (int ch = 0; ch < 3; ch++)
+                        baseColors[sector][ch] = ((highBits >> (28 - ch * 8 - sector * 4)) & 15) * 17;
+                }
+            }
+
+            for (int sector = 0; sector < 2; sector++)
+            {
+                const int16_t *modifiers = Tables::ETC1::g_intensityModifierTable[(highBits >> (5 - sector * 3)) & 7];
+
+                // Punchthrough blocks with transparency have no modifier for selector 0 and selector 2 is transparent
+                const int smallModifier = opaque ? modifiers[0] : 0;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    const int base = baseColors[sector][ch];
+
+                    blockPalette[sector * 4 + 0][ch] = Util::Min(base + smallModifier, 255);
+                    blockPalette[sector * 4 + 1][ch] = Util::Min(base + modifiers[1], 255);
+                    blockPalette[sector * 4 + 2][ch] = Util::Max(base - smallModifier, 0);
+                    blockPalette[sector * 4 + 3][ch] = Util::Max(base - modifiers[1], 0);
+                }
+            }
+
+            blockSectorMask = ((highBits & 1) != 0) ? 0xcccc : 0xff00;
+        }
+
+        planarFlags[block] = blockIsPlanar;
+        anyPlanar |= blockIsPlanar;
+
+        if (blockIsPlanar)
+        {
+            maskValues[LSBMask][block] = 0;
+            maskValues[MSBMask][block] = 0;
+            maskValues[TransparentMask][block] = 0;
+        }
+        else
+        {
+            const uint16_t blockLSBMask = static_cast<uint16_t>(lowBits & 0xffff);
+            const uint16_t blockMSBMask = static_cast<uint16_t>(lowBits >> 16);
+
+            maskValues[LSBMask][block] = blockLSBMask;
+            maskValues[MSBMask][block] = blockMSBMask;
+            maskValues[TransparentMask][block] = opaque ? 0 : static_cast<uint16_t>(blockMSBMask & ~blockLSBMask);
+
+            for (int i = 0; i < 3; i++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                    planarValues[i][ch][block] = 0;
+            }
+        }
+
+        maskValues[SectorMask][block] = blockSectorMask;
+
+        // T and H modes only use the first 4 palette entries
+        const int numPaletteEntries = (blockSectorMask != 0) ? 8 : 4;
+        for (int i = 0; i < 8; i++)
+        {
+            for (int ch = 0; ch < 3; ch++)
+                paletteValues[i][ch][block] = static_cast<uint16_t>(blockPalette[i % numPaletteEntries][ch]);
+        }
+    }
+
+    MUInt15 palette[8][3];
+    for (int i = 0; i < 8; i++)
+    {
+        for (int ch = 0; ch < 3; ch++)
+            palette[i][ch] = ParallelMath::LoadUInt15(paletteValues[i][ch]);
+    }
+
+    MUInt16 masks[NumMasks];
+    for (int mask = 0; mask < NumMasks; mask++)
+        masks[mask] = ParallelMath::LoadUInt16(maskValues[mask]);
+
+    for (int px = 0; px < 16; px++)
+    {
+        const int bit = (px % 4) * 4 + px / 4;
+
+        ParallelMath::Int16CompFlag indexBits[3];
+        indexBits[0] = IsMaskBitSet(masks[LSBMask], bit);
+        indexBits[1] = IsMaskBitSet(masks[MSBMask], bit);
+        indexBits[2] = IsMaskBitSet(masks[SectorMask], bit);
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            MUInt15 channelPalette[8];
+            for (int i = 0; i < 8; i++)
+                channelPalette[i] = palette[i][ch];
+
+            outPixels[px][ch] = SelectFromPalette(channelPalette, indexBits);
+        }
+
+        outPixels[px][3] = ParallelMath::MakeUInt15(255);
+
+        if (punchthroughAlpha)
+        {
+            ParallelMath::Int16CompFlag isTransparent = IsMaskBitSet(masks[TransparentMask], bit);
+            for (int ch = 0; ch < 4; ch++)
+                ParallelMath::ConditionalSet(outPixels[px][ch], isTransparent, ParallelMath::MakeUInt15(0));
+        }
+    }
+
+    if (anyPlanar)
+    {
+        ParallelMath::Int16CompFlag isPlanar = ParallelMath::LoadBoolInt16(planarFlags);
+
+        MUInt15 expanded[3][3];
+        for (int i = 0; i < 3; i++)
+        {
+            for (int ch = 0; ch < 3; ch++)
+                expanded[i][ch] = DecodePlanarCoeff(ParallelMath::LoadUInt15(planarValues[i][ch]), ch);
+        }
+
+        UnpackPlanarPixels(expanded[0], expanded[1], expanded[2], isPlanar, outPixels);
+    }
+}
+
+void cvtt::Internal::ETCComputer::UnpackAlpha(const uint8_t *packedBlocks, size_t packedBlockStride, bool is11Bit, bool isSigned, MUInt15 outValues[16])
+{
+    uint16_t paletteValues[8][ParallelMath::ParallelSize];
+    uint16_t indexWordValues[3][ParallelMath::ParallelSize];
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        const uint8_t *packedBlock = packedBlocks + block * packedBlockStride;
+
+        const int multiplier = packedBlock[1] >> 4;
+        const int16_t *positiveModifiers = Tables::ETC2::g_alphaModifierTablePositive[packedBlock[1] & 15];
+
+        for (int i = 0; i < 8; i++)
+        {
+            const int modifier = (i < 4) ? (-positiveModifiers[i] - 1) : positiveModifiers[i - 4];
+
+            int value = 0;
+            if (!is11Bit)
+                value = Util::Max(0, Util::Min(packedBlock[0] + modifier * multiplier, 255));
+            else
+            {
+                const int scaledModifier = (multiplier == 0) ? modifier : (modifier * multiplier * 8);
+
+                if (isSigned)
+                {
+                    const int base = Util::Max(static_cast<int>(static_cast<int8_t>(packedBlock[0])), -127);
+                    value = Util::Max(-1023, Util::Min(base * 8 + scaledModifier, 1023)) + 1023;
+                }
+                else
+                    value = Util::Max(0, Util::Min(packedBlock[0] * 8 + 4 + scaledModifier, 2047));
+            }
+
+            paletteValues[i][block] = static_cast<uint16_t>(value);
+        }
+
+        // Indexes are stored big-endian, so word 0 holds the last pixels
+        for (int word = 0; word < 3; word++)
+            indexWordValues[word][block] = static_cast<uint16_t>((packedBlock[6 - word * 2] << 8) | packedBlock[7 - word * 2]);
+    }
+
+    MUInt15 palette[8];
+    for (int i = 0; i < 8; i++)
+        palette[i] = ParallelMath::LoadUInt15(paletteValues[i]);
+
+    MUInt16 indexWords[3];
+    for (int word = 0; word < 3; word++)
+        indexWords[word] = ParallelMath::LoadUInt16(indexWordValues[word]);
+
+    for (int px = 0; px < 16; px++)
+    {
+        const int slot = (px % 4) * 4 + px / 4;
+        const int bitPos = 45 - slot * 3;
+        const int word = bitPos / 16;
+        const int shift = bitPos % 16;
+
+        MUInt16 indexBits = ParallelMath::RightShift(indexWords[word], shift);
+        if (shift > 13)
+            indexBits = indexBits | (indexWords[word + 1] << (16 - shift));
+
+        ParallelMath::Int16CompFlag indexBitFlags[3];
+        for (int bit = 0; bit < 3; bit++)
+            indexBitFlags[bit] = IsMaskBitSet(indexBits, bit);
+
+        outValues[px] = SelectFromPalette(palette, indexBitFlags);
+    }
+}
+
+void *cvtt::Internal::ETCComputer::AlignCompressionData(void *buffer)
+{
+    const size_t misalignment = reinterpret_cast<size_t>(buffer) % CompressionDataAlignment;
+    if (misalignment == 0)
+        return buffer;
+    return static_cast<char*>(buffer) + (CompressionDataAlignment - misalignment);
+}
 
 cvtt::ETC1CompressionData *cvtt::Internal::ETCComputer::AllocETC1Data(cvtt::Kernels::allocFunc_t allocFunc, void *context)
 {
-    void *buffer = allocFunc(context, sizeof(cvtt::Internal::ETCComputer::ETC1CompressionDataInternal));
+    void *buffer = allocFunc(context, sizeof(cvtt::Internal::ETCComputer::ETC1CompressionDataInternal) + CompressionDataAlignment - 1);
     if (!buffer)
         return NULL;
-    new (buffer) cvtt::Internal::ETCComputer::ETC1CompressionDataInternal(context);
-    return static_cast<ETC1CompressionData*>(buffer);
+    void *alignedBuffer = AlignCompressionData(buffer);
+    new (alignedBuffer) cvtt::Internal::ETCComputer::ETC1CompressionDataInternal(context, buffer);
+    return static_cast<ETC1CompressionData*>(alignedBuffer);
 }
 
 void cvtt::Internal::ETCComputer::ReleaseETC1Data(ETC1CompressionData *compressionData, cvtt::Kernels::freeFunc_t freeFunc)
 {
     cvtt::Internal::ETCComputer::ETC1CompressionDataInternal* internalData = static_cast<cvtt::Internal::ETCComputer::ETC1CompressionDataInternal*>(compressionData);
     void *context = internalData->m_context;
+    void *allocation = internalData->m_allocation;
     internalData->~ETC1CompressionDataInternal();
-    freeFunc(context, compressionData, sizeof(cvtt::Internal::ETCComputer::ETC1CompressionDataInternal));
+    freeFunc(context, allocation, sizeof(cvtt::Internal::ETCComputer::ETC1CompressionDataInternal) + CompressionDataAlignment - 1);
 }
 
 cvtt::ETC2CompressionData *cvtt::Internal::ETCComputer::AllocETC2Data(cvtt::Kernels::allocFunc_t allocFunc, void *context, const cvtt::Options &options)
 {
-    void *buffer = allocFunc(context, sizeof(cvtt::Internal::ETCComputer::ETC2CompressionDataInternal));
+    void *buffer = allocFunc(context, sizeof(cvtt::Internal::ETCComputer::ETC2CompressionDataInternal) + CompressionDataAlignment - 1);
     if (!buffer)
         return NULL;
-    new (buffer) cvtt::Internal::ETCComputer::ETC2CompressionDataInternal(context, options);
-    return static_cast<ETC2CompressionData*>(buffer);
+    void *alignedBuffer = AlignCompressionData(buffer);
+    new (alignedBuffer) cvtt::Internal::ETCComputer::ETC2CompressionDataInternal(context, buffer, options);
+    return static_cast<ETC2CompressionData*>(alignedBuffer);
 }
 
 void cvtt::Internal::ETCComputer::ReleaseETC2Data(ETC2CompressionData *compressionData, cvtt::Kernels::freeFunc_t freeFunc)
 {
     cvtt::Internal::ETCComputer::ETC2CompressionDataInternal* internalData = static_cast<cvtt::Internal::ETCComputer::ETC2CompressionDataInternal*>(compressionData);
     void *context = internalData->m_context;
+    void *allocation = internalData->m_allocation;
     internalData->~ETC2CompressionDataInternal();
-    freeFunc(context, compressionData, sizeof(cvtt::Internal::ETCComputer::ETC2CompressionDataInternal));
+    freeFunc(context, allocation, sizeof(cvtt::Internal::ETCComputer::ETC2CompressionDataInternal) + CompressionDataAlignment - 1);
 }
 
-cvtt::Internal::ETCComputer::ETC2CompressionDataInternal::ETC2CompressionDataInternal(void *context, const cvtt::Options &options)
+cvtt::Internal::ETCComputer::ETC2CompressionDataInternal::ETC2CompressionDataInternal(void *context, void *allocation, const cvtt::Options &options)
     : m_context(context)
+    , m_allocation(allocation)
 {
     const float cd[3] = { options.redWeight, options.greenWeight, options.blueWeight };
     const float rotCD[3] = { cd[1], cd[2], cd[0] };
@@ -3133,7 +3531,7 @@ cvtt::Internal::ETCComputer::ETC2CompressionDataInternal::ETC2CompressionDataInt
 
     const float ca0LengthSq = (chromaAxis0[0] * chromaAxis0[0] + chromaAxis0[1] * chromaAxis0[1] + chromaAxis0[2] * chromaAxis0[2]);
     const float ca1UNLengthSq = (chromaAxis1Unnormalized[0] * chromaAxis1Unnormalized[0] + chromaAxis1Unnormalized[1] * chromaAxis1Unnormalized[1] + chromaAxis1Unnormalized[2] * chromaAxis1Unnormalized[2]);
-    const float lengthRatio = static_cast<float>(std::sqrt(ca0LengthSq / ca1UNLengthSq));
+    const float lengthRatio = sqrtf(ca0LengthSq / ca1UNLengthSq);
 
     const float chromaAxis1[3] = { chromaAxis1Unnormalized[0] * lengthRatio, chromaAxis1Unnormalized[1] * lengthRatio, chromaAxis1Unnormalized[2] * lengthRatio };
 
@@ -9,6 +9,7 @@ namespace cvtt
 {
     struct Options;
 
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         class ETCComputer
@@ -25,7 +26,16 @@ namespace cvtt
             static ETC1CompressionData *AllocETC1Data(cvtt::Kernels::allocFunc_t allocFunc, void *context);
             static void ReleaseETC1Data(ETC1CompressionData *compressionData, cvtt::Kernels::freeFunc_t freeFunc);
 
+            // ETC1 blocks are decoded as ETC2.  Alpha values are 0-255, or 0-2047 for 11-bit EAC, with signed values biased by 1023.
+            static void UnpackColor(const uint8_t *packedBlocks, size_t packedBlockStride, bool punchthroughAlpha, ParallelMath::UInt15 outPixels[16][4]);
+            static void UnpackAlpha(const uint8_t *packedBlocks, size_t packedBlockStride, bool is11Bit, bool isSigned, ParallelMath::UInt15 outValues[16]);
+
         private:
+            // Vector types may need stricter alignment than allocFunc guarantees, so compression data is over-allocated and aligned
+            static const size_t CompressionDataAlignment = sizeof(ParallelMath::UInt16);
+
+            static void *AlignCompressionData(void *buffer);
+
             typedef ParallelMath::Float MFloat;
             typedef ParallelMath::SInt16 MSInt16;
             typedef ParallelMath::UInt15 MUInt15;
@@ -56,23 +66,26 @@ namespace cvtt
 
             struct ETC1CompressionDataInternal : public cvtt::ETC1CompressionData
             {
-                explicit ETC1CompressionDataInternal(void *context)
+                explicit ETC1CompressionDataInternal(void *context, void *allocation)
                     : m_context(context)
+                    , m_allocation(allocation)
                 {
                 }
 
                 DifferentialResolveStorage m_drs;
                 void *m_context;
+                void *m_allocation;
             };
 
             struct ETC2CompressionDataInternal : public cvtt::ETC2CompressionData
             {
-                explicit ETC2CompressionDataInternal(void *context, const cvtt::Options &options);
+                explicit ETC2CompressionDataInternal(void *context, void *allocation, const cvtt::Options &options);
 
                 HModeEval m_h;
                 DifferentialResolveStorage m_drs;
 
                 void *m_context;
+                void *m_allocation;
                 float m_chromaSideAxis0[3];
                 float m_chromaSideAxis1[3];
             };
@@ -118,9 +131,14 @@ namespace cvtt
             static void EmitHModeBlock(uint8_t *outputBuffer, const ParallelMath::ScalarUInt16 blockColors[2], ParallelMath::ScalarUInt16 sectorBits, ParallelMath::ScalarUInt16 signBits, ParallelMath::ScalarUInt16 table, bool opaque);
             static void EmitETC1Block(uint8_t *outputBuffer, int blockBestFlip, int blockBestD, const int blockBestColors[2][3], const int blockBestTables[2], const ParallelMath::ScalarUInt16 blockBestSelectors[2], bool transparent);
 
+            static ParallelMath::Int16CompFlag IsMaskBitSet(const MUInt16 &mask, int bit);
+            static MUInt15 SelectFromPalette(const MUInt15 palette[8], const ParallelMath::Int16CompFlag indexBits[3]);
+            static void UnpackPlanarPixels(const MUInt15 origin[3], const MUInt15 horizontal[3], const MUInt15 vertical[3], const ParallelMath::Int16CompFlag &isPlanar, MUInt15 outPixels[16][4]);
+
             static const int g_flipTables[2][2][8];
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
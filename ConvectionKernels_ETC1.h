@@ -24,6 +24,18 @@ namespace cvtt
             {
                 3, 6, 11, 16, 23, 32, 41, 64
             };
+
+            const int16_t g_intensityModifierTable[8][2] =
+            {
+                { 2, 8 },
+                { 5, 17 },
+                { 9, 29 },
+                { 13, 42 },
+                { 18, 60 },
+                { 24, 80 },
+                { 33, 106 },
+                { 47, 183 },
+            };
         }
     }
 }
@@ -0,0 +1,133 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels.h"
+
+#include <assert.h>
+
+namespace cvtt
+{
+    namespace EncodingStatsInternal
+    {
+        template<size_t TSize>
+        static void AddCounts(uint64_t (&dest)[TSize], const uint64_t (&src)[TSize])
+        {
+            for (size_t i = 0; i < TSize; i++)
+                dest[i] += src[i];
+        }
+
+        // Returns the BC6H mode number minus 1, or -1 for reserved modes
+        static int GetBC6HModeIndex(uint8_t firstByte)
+        {
+            if ((firstByte & 2) == 0)
+                return firstByte & 1;
+
+            const int modeID = (firstByte & 0x1f);
+            if ((modeID & 3) == 2)
+                return 2 + (modeID >> 2);
+            if (modeID < 0x10)
+                return 10 + (modeID >> 2);
+            return -1;
+        }
+    }
+}
+
+void cvtt::Kernels::AddBC7EncodingStats(EncodingStats &stats, const uint8_t *pBC, size_t numBlocks)
+{
+    assert(pBC || numBlocks == 0);
+
+    for (size_t block = 0; block < numBlocks; block++)
+    {
+        const uint8_t *blockData = pBC + block * 16;
+
+        stats.numBC7Blocks++;
+
+        // Mode is the position of the lowest set bit, and the partition or rotation bits follow it
+        if (blockData[0] == 0)
+            continue;
+
+        int mode = 0;
+        while ((blockData[0] & (1 << mode)) == 0)
+            mode++;
+
+        const uint32_t headerBits = (static_cast<uint32_t>(blockData[0]) | (static_cast<uint32_t>(blockData[1]) << 8)) >> (mode + 1);
+
+        stats.bc7ModeCounts[mode]++;
+
+        if (mode == 0)
+            stats.bc7PartitionCounts[mode][headerBits & 0xf]++;
+        else if (mode <= 3 || mode == 7)
+            stats.bc7PartitionCounts[mode][headerBits & 0x3f]++;
+        else if (mode == 4)
+        {
+            stats.bc7RotationCounts[0][headerBits & 3]++;
+            stats.bc7IndexSelectorCounts[(headerBits >> 2) & 1]++;
+        }
+        else if (mode == 5)
+            stats.bc7RotationCounts[1][headerBits & 3]++;
+    }
+}
+
+void cvtt::Kernels::AddBC6HEncodingStats(EncodingStats &stats, const uint8_t *pBC, size_t numBlocks)
+{
+    assert(pBC || numBlocks == 0);
+
+    for (size_t block = 0; block < numBlocks; block++)
+    {
+        const uint8_t *blockData = pBC + block * 16;
+
+        stats.numBC6HBlocks++;
+
+        const int modeIndex = EncodingStatsInternal::GetBC6HModeIndex(blockData[0]);
+        if (modeIndex < 0)
+            continue;
+
+        stats.bc6hModeCounts[modeIndex]++;
+
+        // Modes 1-10 have two regions, with the partition in bits 77-81
+        if (modeIndex < 10)
+            stats.bc6hPartitionCounts[modeIndex][((blockData[9] >> 5) | (blockData[10] << 3)) & 0x1f]++;
+    }
+}
+
+void cvtt::Kernels::MergeEncodingStats(EncodingStats &stats, const EncodingStats &otherStats)
+{
+    EncodingStatsInternal::AddCounts(stats.bc7ModeCounts, otherStats.bc7ModeCounts);
+    for (int mode = 0; mode < 8; mode++)
+        EncodingStatsInternal::AddCounts(stats.bc7PartitionCounts[mode], otherStats.bc7PartitionCounts[mode]);
+    for (int mode = 0; mode < 2; mode++)
+        EncodingStatsInternal::AddCounts(stats.bc7RotationCounts[mode], otherStats.bc7RotationCounts[mode]);
+    EncodingStatsInternal::AddCounts(stats.bc7IndexSelectorCounts, otherStats.bc7IndexSelectorCounts);
+    stats.numBC7Blocks += otherStats.numBC7Blocks;
+
+    EncodingStatsInternal::AddCounts(stats.bc6hModeCounts, otherStats.bc6hModeCounts);
+    for (int mode = 0; mode < 10; mode++)
+        EncodingStatsInternal::AddCounts(stats.bc6hPartitionCounts[mode], otherStats.bc6hPartitionCounts[mode]);
+    stats.numBC6HBlocks += otherStats.numBC6HBlocks;
+}
+
+#endif
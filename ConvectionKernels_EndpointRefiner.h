@@ -6,6 +6,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         // Solve for a, b where v = a*t + b
@@ -175,6 +176,7 @@ namespace cvtt
             }
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
@@ -8,6 +8,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         static const int NumEndpointSelectorPasses = 3;
@@ -69,6 +70,20 @@ namespace cvtt
                 return UnfinishedEndpoints<TVectorSize>(unweightedBase, unweightedOffset);
             }
 
+            // Returns the total squared distance of the values from the line through the centroid along the direction found in
+            // the direction pass.  No pair of endpoints can do much better than this, other than by rounding.
+            MFloat GetLineResidual() const
+            {
+                MFloat product[TVectorSize];
+                m_covarianceMatrix.Product(product, m_direction);
+
+                MFloat alongLine = ParallelMath::MakeFloatZero();
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    alongLine = alongLine + product[ch] * m_direction[ch];
+
+                return ParallelMath::Max(m_covarianceMatrix.Trace() - alongLine, ParallelMath::MakeFloatZero());
+            }
+
         private:
             void ContributeCentroid(const MFloat *value, const MFloat &weight)
             {
@@ -148,6 +163,7 @@ namespace cvtt
             ParallelMath::Float m_maxDist;
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
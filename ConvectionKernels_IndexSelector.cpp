@@ -38,29 +38,31 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
-        const ParallelMath::UInt16 g_weightReciprocals[17] =
+        const uint16_t g_weightReciprocals[17] =
         {
-            ParallelMath::MakeUInt16(0),        // -1 
-            ParallelMath::MakeUInt16(0),        // 0
-            ParallelMath::MakeUInt16(32768),    // 1
-            ParallelMath::MakeUInt16(16384),    // 2
-            ParallelMath::MakeUInt16(10923),    // 3
-            ParallelMath::MakeUInt16(8192),     // 4
-            ParallelMath::MakeUInt16(6554),     // 5
-            ParallelMath::MakeUInt16(5461),     // 6
-            ParallelMath::MakeUInt16(4681),     // 7
-            ParallelMath::MakeUInt16(4096),     // 8
-            ParallelMath::MakeUInt16(3641),     // 9
-            ParallelMath::MakeUInt16(3277),     // 10
-            ParallelMath::MakeUInt16(2979),     // 11
-            ParallelMath::MakeUInt16(2731),     // 12
-            ParallelMath::MakeUInt16(2521),     // 13
-            ParallelMath::MakeUInt16(2341),     // 14
-            ParallelMath::MakeUInt16(2185),     // 15
+            0,      // -1 
+            0,      // 0
+            32768,  // 1
+            16384,  // 2
+            10923,  // 3
+            8192,   // 4
+            6554,   // 5
+            5461,   // 6
+            4681,   // 7
+            4096,   // 8
+            3641,   // 9
+            3277,   // 10
+            2979,   // 11
+            2731,   // 12
+            2521,   // 13
+            2341,   // 14
+            2185,   // 15
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
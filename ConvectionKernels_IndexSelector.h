@@ -6,9 +6,10 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
-        extern const ParallelMath::UInt16 g_weightReciprocals[17];
+        extern const uint16_t g_weightReciprocals[17];
 
         template<int TVectorSize>
         class IndexSelector
@@ -89,7 +90,7 @@ namespace cvtt
 
             void ReconstructLDR_BC7(const MUInt15 &index, MUInt15* pixel, int numRealChannels)
             {
-                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(g_weightReciprocals[m_range], index) + 256, 9));
+                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(ParallelMath::MakeUInt16(g_weightReciprocals[m_range]), index) + 256, 9));
 
                 for (int ch = 0; ch < numRealChannels; ch++)
                 {
@@ -101,7 +102,7 @@ namespace cvtt
 
             void ReconstructLDRPrecise(const MUInt15 &index, MUInt15* pixel, int numRealChannels)
             {
-                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(g_weightReciprocals[m_range], index) + 64, 7));
+                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(ParallelMath::MakeUInt16(g_weightReciprocals[m_range]), index) + 64, 7));
 
                 for (int ch = 0; ch < numRealChannels; ch++)
                 {
@@ -141,6 +142,7 @@ namespace cvtt
             bool m_isUniform;
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
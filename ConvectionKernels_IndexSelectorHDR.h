@@ -7,6 +7,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         ParallelMath::SInt16 UnscaleHDRValueSigned(const ParallelMath::SInt16 &v);
@@ -33,7 +34,7 @@ namespace cvtt
 
             void ReconstructHDRSignedUninverted(const MUInt15 &index, MSInt16* pixel) const
             {
-                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(g_weightReciprocals[m_range], index) + 256, 9));
+                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(ParallelMath::MakeUInt16(g_weightReciprocals[m_range]), index) + 256, 9));
 
                 for (int ch = 0; ch < TVectorSize; ch++)
                 {
@@ -50,7 +51,7 @@ namespace cvtt
 
             void ReconstructHDRUnsignedUninverted(const MUInt15 &index, MSInt16* pixel) const
             {
-                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(g_weightReciprocals[m_range], index) + 256, 9));
+                MUInt15 weight = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(ParallelMath::CompactMultiply(ParallelMath::MakeUInt16(g_weightReciprocals[m_range]), index) + 256, 9));
 
                 for (int ch = 0; ch < TVectorSize; ch++)
                 {
@@ -150,6 +151,7 @@ namespace cvtt
             int m_range;
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 #endif
 
@@ -0,0 +1,100 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels.h"
+#include "ConvectionKernels_Instrumentation.h"
+
+#if defined(CVTT_ENABLE_INSTRUMENTATION)
+
+#include <mutex>
+
+namespace cvtt
+{
+    namespace Instrumentation
+    {
+        // Encode calls accumulate into their own stats and merge them here once at the end, so the lock is rarely contended
+        static std::mutex g_bc7StatsMutex;
+        static BC7InstrumentationStats g_bc7Stats;
+
+        template<size_t TSize>
+        static void AddCounters(uint64_t (&dest)[TSize], const uint64_t (&src)[TSize])
+        {
+            for (size_t i = 0; i < TSize; i++)
+                dest[i] += src[i];
+        }
+    }
+}
+
+void cvtt::Instrumentation::AddBC7Stats(const BC7InstrumentationStats &stats)
+{
+    std::lock_guard<std::mutex> lock(g_bc7StatsMutex);
+
+    AddCounters(g_bc7Stats.stageCycles, stats.stageCycles);
+    AddCounters(g_bc7Stats.stageCalls, stats.stageCalls);
+    AddCounters(g_bc7Stats.modeCycles, stats.modeCycles);
+    AddCounters(g_bc7Stats.modeCalls, stats.modeCalls);
+    AddCounters(g_bc7Stats.shapeCycles, stats.shapeCycles);
+    AddCounters(g_bc7Stats.shapeCalls, stats.shapeCalls);
+
+    for (int mode = 0; mode < 2; mode++)
+    {
+        AddCounters(g_bc7Stats.rotationCycles[mode], stats.rotationCycles[mode]);
+        AddCounters(g_bc7Stats.rotationCalls[mode], stats.rotationCalls[mode]);
+    }
+
+    g_bc7Stats.numPackCalls += stats.numPackCalls;
+    g_bc7Stats.numBlocks += stats.numBlocks;
+}
+
+bool cvtt::Kernels::GetBC7InstrumentationStats(BC7InstrumentationStats &outStats)
+{
+    std::lock_guard<std::mutex> lock(Instrumentation::g_bc7StatsMutex);
+    outStats = Instrumentation::g_bc7Stats;
+    return true;
+}
+
+void cvtt::Kernels::ResetBC7InstrumentationStats()
+{
+    std::lock_guard<std::mutex> lock(Instrumentation::g_bc7StatsMutex);
+    Instrumentation::g_bc7Stats = BC7InstrumentationStats();
+}
+
+#else
+
+bool cvtt::Kernels::GetBC7InstrumentationStats(BC7InstrumentationStats &outStats)
+{
+    outStats = BC7InstrumentationStats();
+    return false;
+}
+
+void cvtt::Kernels::ResetBC7InstrumentationStats()
+{
+}
+
+#endif
+
+#endif
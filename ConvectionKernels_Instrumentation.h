@@ -0,0 +1,74 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+#ifndef __CVTT_INSTRUMENTATION_H__
+#define __CVTT_INSTRUMENTATION_H__
+
+#include "ConvectionKernels_Config.h"
+
+#if defined(CVTT_ENABLE_INSTRUMENTATION)
+
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace cvtt
+{
+    struct BC7InstrumentationStats;
+
+    namespace Instrumentation
+    {
+        inline uint64_t ReadCycleCounter()
+        {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        // Adds the stats from one encode call to the totals
+        void AddBC7Stats(const BC7InstrumentationStats &stats);
+    }
+}
+
+#define CVTT_INSTRUMENTATION_BEGIN(timer) const uint64_t timer##StartCycles = ::cvtt::Instrumentation::ReadCycleCounter()
+#define CVTT_INSTRUMENTATION_END(timer) const uint64_t timer##Cycles = ::cvtt::Instrumentation::ReadCycleCounter() - timer##StartCycles
+#define CVTT_INSTRUMENTATION_RECORD(timer, cycles, calls) ((cycles) += timer##Cycles, (calls)++)
+
+#else
+
+#define CVTT_INSTRUMENTATION_BEGIN(timer)
+#define CVTT_INSTRUMENTATION_END(timer)
+#define CVTT_INSTRUMENTATION_RECORD(timer, cycles, calls) ((void)0)
+
+#endif
+
+#endif
@@ -4,6 +4,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
 
@@ -39,7 +40,7 @@ namespace cvtt
                 }
             }
 
-            void Product(MFloat *outVec, const MFloat *inVec)
+            void Product(MFloat *outVec, const MFloat *inVec) const
             {
                 for (int row = 0; row < TMatrixSize; row++)
                 {
@@ -59,10 +60,20 @@ namespace cvtt
                 }
             }
 
+            MFloat Trace() const
+            {
+                MFloat sum = ParallelMath::MakeFloatZero();
+                for (int row = 0; row < TMatrixSize; row++)
+                    sum = sum + m_values[((row * (row + 1)) >> 1) + row];
+
+                return sum;
+            }
+
         private:
             ParallelMath::Float m_values[PyramidSize];
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
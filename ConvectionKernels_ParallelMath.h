@@ -29,7 +29,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ConvectionKernels.h"
 #include "ConvectionKernels_Config.h"
 
-#ifdef CVTT_USE_SSE2
+#if defined(CVTT_USE_AVX512) || defined(CVTT_USE_AVX2)
+#include <immintrin.h>
+#elif defined(CVTT_USE_SSE41)
+#include <smmintrin.h>
+#elif defined(CVTT_USE_SSE2)
 #include <emmintrin.h>
 #endif
 
@@ -61,8 +65,2710 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace cvtt
 {
-#ifdef CVTT_USE_SSE2
-    // SSE2 version
+    CVTT_ISA_NAMESPACE_BEGIN
+
+#if defined(CVTT_USE_AVX512)
+    // AVX-512BW version
+    struct ParallelMath
+    {
+        typedef uint16_t ScalarUInt16;
+        typedef int16_t ScalarSInt16;
+
+        template<unsigned int TRoundingMode>
+        struct RoundForScope
+        {
+            unsigned int m_oldCSR;
+
+            RoundForScope()
+            {
+                m_oldCSR = _mm_getcsr();
+                _mm_setcsr((m_oldCSR & ~_MM_ROUND_MASK) | (TRoundingMode));
+            }
+
+            ~RoundForScope()
+            {
+                _mm_setcsr(m_oldCSR);
+            }
+        };
+
+        struct RoundTowardZeroForScope : RoundForScope<_MM_ROUND_TOWARD_ZERO>
+        {
+        };
+
+        struct RoundTowardNearestForScope : RoundForScope<_MM_ROUND_NEAREST>
+        {
+        };
+
+        struct RoundUpForScope : RoundForScope<_MM_ROUND_UP>
+        {
+        };
+
+        struct RoundDownForScope : RoundForScope<_MM_ROUND_DOWN>
+        {
+        };
+
+        static const int ParallelSize = 32;
+
+        enum Int16Subtype
+        {
+            IntSubtype_Signed,
+            IntSubtype_UnsignedFull,
+            IntSubtype_UnsignedTruncated,
+            IntSubtype_Abstract,
+        };
+
+        // 16-bit lanes 0-15 map to the first 32-bit vector and 16-31 to the second
+        static __m512i WidenLow16(const __m512i &v)
+        {
+            return _mm512_cvtepu16_epi32(_mm512_castsi512_si256(v));
+        }
+
+        static __m512i WidenHigh16(const __m512i &v)
+        {
+            return _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(v, 1));
+        }
+
+        static __m512i SignedWidenLow16(const __m512i &v)
+        {
+            return _mm512_cvtepi16_epi32(_mm512_castsi512_si256(v));
+        }
+
+        static __m512i SignedWidenHigh16(const __m512i &v)
+        {
+            return _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(v, 1));
+        }
+
+        static __m512i Combine16(const __m256i &lo, const __m256i &hi)
+        {
+            return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+        }
+
+        static __m512i PackSaturate32(const __m512i &lo, const __m512i &hi)
+        {
+            return Combine16(_mm512_cvtsepi32_epi16(lo), _mm512_cvtsepi32_epi16(hi));
+        }
+
+        static __m512i PackTruncate32(const __m512i &lo, const __m512i &hi)
+        {
+            return Combine16(_mm512_cvtepi32_epi16(lo), _mm512_cvtepi32_epi16(hi));
+        }
+
+        template<int TSubtype>
+        struct VInt16
+        {
+            __m512i m_value;
+
+            inline VInt16 operator+(int16_t other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_add_epi16(m_value, _mm512_set1_epi16(static_cast<int16_t>(other)));
+                return result;
+            }
+
+            inline VInt16 operator+(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_add_epi16(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator|(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_or_si512(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator&(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_and_si512(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator-(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_sub_epi16(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator<<(int bits) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_slli_epi16(m_value, bits);
+                return result;
+            }
+
+            inline VInt16 operator^(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm512_xor_si512(m_value, other.m_value);
+                return result;
+            }
+        };
+
+        typedef VInt16<IntSubtype_Signed> SInt16;
+        typedef VInt16<IntSubtype_UnsignedFull> UInt16;
+        typedef VInt16<IntSubtype_UnsignedTruncated> UInt15;
+        typedef VInt16<IntSubtype_Abstract> AInt16;
+
+        template<int TSubtype>
+        struct VInt32
+        {
+            __m512i m_values[2];
+
+            inline VInt32 operator+(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm512_add_epi32(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_add_epi32(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline VInt32 operator-(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm512_sub_epi32(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_sub_epi32(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline VInt32 operator<<(const int other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm512_slli_epi32(m_values[0], other);
+                result.m_values[1] = _mm512_slli_epi32(m_values[1], other);
+                return result;
+            }
+
+            inline VInt32 operator|(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm512_or_si512(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_or_si512(m_values[1], other.m_values[1]);
+                return result;
+            }
+        };
+
+        typedef VInt32<IntSubtype_Signed> SInt32;
+        typedef VInt32<IntSubtype_UnsignedTruncated> UInt31;
+        typedef VInt32<IntSubtype_UnsignedFull> UInt32;
+        typedef VInt32<IntSubtype_Abstract> AInt32;
+
+        template<class TTargetType>
+        struct LosslessCast
+        {
+#ifdef CVTT_PERMIT_ALIASING
+            template<int TSrcSubtype>
+            static const TTargetType& Cast(const VInt32<TSrcSubtype> &src)
+            {
+                return reinterpret_cast<VInt32<TSubtype>&>(src);
+            }
+
+            template<int TSrcSubtype>
+            static const TTargetType& Cast(const VInt16<TSrcSubtype> &src)
+            {
+                return reinterpret_cast<VInt16<TSubtype>&>(src);
+            }
+#else
+            template<int TSrcSubtype>
+            static TTargetType Cast(const VInt32<TSrcSubtype> &src)
+            {
+                TTargetType result;
+                result.m_values[0] = src.m_values[0];
+                result.m_values[1] = src.m_values[1];
+                return result;
+            }
+
+            template<int TSrcSubtype>
+            static TTargetType Cast(const VInt16<TSrcSubtype> &src)
+            {
+                TTargetType result;
+                result.m_value = src.m_value;
+                return result;
+            }
+#endif
+        };
+
+        struct Int64
+        {
+            __m512i m_values[4];
+        };
+
+        struct Float
+        {
+            __m512 m_values[2];
+
+            inline Float operator+(const Float &other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_add_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_add_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator+(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_add_ps(m_values[0], _mm512_set1_ps(other));
+                result.m_values[1] = _mm512_add_ps(m_values[1], _mm512_set1_ps(other));
+                return result;
+            }
+
+            inline Float operator-(const Float& other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_sub_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_sub_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator-() const
+            {
+                Float result;
+                result.m_values[0] = _mm512_sub_ps(_mm512_setzero_ps(), m_values[0]);
+                result.m_values[1] = _mm512_sub_ps(_mm512_setzero_ps(), m_values[1]);
+                return result;
+            }
+
+            inline Float operator*(const Float& other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_mul_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_mul_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator*(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_mul_ps(m_values[0], _mm512_set1_ps(other));
+                result.m_values[1] = _mm512_mul_ps(m_values[1], _mm512_set1_ps(other));
+                return result;
+            }
+
+            inline Float operator/(const Float &other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_div_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm512_div_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator/(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm512_div_ps(m_values[0], _mm512_set1_ps(other));
+                result.m_values[1] = _mm512_div_ps(m_values[1], _mm512_set1_ps(other));
+                return result;
+            }
+        };
+
+        // All comparison flags are mask registers with one bit per lane
+        struct Int16CompFlag
+        {
+            __mmask32 m_value;
+
+            inline Int16CompFlag operator&(const Int16CompFlag &other) const
+            {
+                Int16CompFlag result;
+                result.m_value = m_value & other.m_value;
+                return result;
+            }
+
+            inline Int16CompFlag operator|(const Int16CompFlag &other) const
+            {
+                Int16CompFlag result;
+                result.m_value = m_value | other.m_value;
+                return result;
+            }
+        };
+
+        struct Int32CompFlag
+        {
+            __mmask32 m_value;
+
+            inline Int32CompFlag operator&(const Int32CompFlag &other) const
+            {
+                Int32CompFlag result;
+                result.m_value = m_value & other.m_value;
+                return result;
+            }
+
+            inline Int32CompFlag operator|(const Int32CompFlag &other) const
+            {
+                Int32CompFlag result;
+                result.m_value = m_value | other.m_value;
+                return result;
+            }
+        };
+
+        struct FloatCompFlag
+        {
+            __mmask32 m_value;
+
+            inline FloatCompFlag operator&(const FloatCompFlag &other) const
+            {
+                FloatCompFlag result;
+                result.m_value = m_value & other.m_value;
+                return result;
+            }
+
+            inline FloatCompFlag operator|(const FloatCompFlag &other) const
+            {
+                FloatCompFlag result;
+                result.m_value = m_value | other.m_value;
+                return result;
+            }
+        };
+
+        static __mmask16 LowMask(__mmask32 mask)
+        {
+            return static_cast<__mmask16>(mask & 0xffff);
+        }
+
+        static __mmask16 HighMask(__mmask32 mask)
+        {
+            return static_cast<__mmask16>(mask >> 16);
+        }
+
+        static __mmask32 CombineMasks(__mmask16 lo, __mmask16 hi)
+        {
+            return static_cast<__mmask32>(lo) | (static_cast<__mmask32>(hi) << 16);
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> AbstractAdd(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm512_add_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> AbstractSubtract(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm512_sub_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Select(const FloatCompFlag &flag, const Float &a, const Float &b)
+        {
+            Float result;
+            result.m_values[0] = _mm512_mask_blend_ps(LowMask(flag.m_value), b.m_values[0], a.m_values[0]);
+            result.m_values[1] = _mm512_mask_blend_ps(HighMask(flag.m_value), b.m_values[1], a.m_values[1]);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> Select(const Int16CompFlag &flag, const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm512_mask_blend_epi16(flag.m_value, b.m_value, a.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> SelectOrZero(const Int16CompFlag &flag, const VInt16<TSubtype> &a)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm512_maskz_mov_epi16(flag.m_value, a.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static void ConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
+        {
+            dest.m_value = _mm512_mask_mov_epi16(dest.m_value, flag.m_value, src.m_value);
+        }
+
+        template<int TSubtype>
+        static void ConditionalSet(VInt32<TSubtype> &dest, const Int16CompFlag &flag, const VInt32<TSubtype> &src)
+        {
+            dest.m_values[0] = _mm512_mask_mov_epi32(dest.m_values[0], LowMask(flag.m_value), src.m_values[0]);
+            dest.m_values[1] = _mm512_mask_mov_epi32(dest.m_values[1], HighMask(flag.m_value), src.m_values[1]);
+        }
+
+        static void ConditionalSet(ParallelMath::Int16CompFlag &dest, const Int16CompFlag &flag, const ParallelMath::Int16CompFlag &src)
+        {
+            dest.m_value = (dest.m_value & ~flag.m_value) | (src.m_value & flag.m_value);
+        }
+
+        static SInt16 ConditionalNegate(const Int16CompFlag &flag, const SInt16 &v)
+        {
+            SInt16 result;
+            result.m_value = _mm512_mask_sub_epi16(v.m_value, flag.m_value, _mm512_setzero_si512(), v.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static void NotConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
+        {
+            dest.m_value = _mm512_mask_mov_epi16(dest.m_value, ~flag.m_value, src.m_value);
+        }
+
+        static void ConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
+        {
+            dest.m_values[0] = _mm512_mask_mov_ps(dest.m_values[0], LowMask(flag.m_value), src.m_values[0]);
+            dest.m_values[1] = _mm512_mask_mov_ps(dest.m_values[1], HighMask(flag.m_value), src.m_values[1]);
+        }
+
+        static void NotConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
+        {
+            dest.m_values[0] = _mm512_mask_mov_ps(dest.m_values[0], LowMask(~flag.m_value), src.m_values[0]);
+            dest.m_values[1] = _mm512_mask_mov_ps(dest.m_values[1], HighMask(~flag.m_value), src.m_values[1]);
+        }
+
+        static void MakeSafeDenominator(Float& v)
+        {
+            ConditionalSet(v, Equal(v, MakeFloatZero()), MakeFloat(1.0f));
+        }
+
+        static SInt16 TruncateToPrecisionSigned(const SInt16 &v, int precision)
+        {
+            int lostBits = 16 - precision;
+            if (lostBits == 0)
+                return v;
+
+            SInt16 result;
+            result.m_value = _mm512_srai_epi16(_mm512_slli_epi16(v.m_value, lostBits), lostBits);
+            return result;
+        }
+
+        static UInt16 TruncateToPrecisionUnsigned(const UInt16 &v, int precision)
+        {
+            int lostBits = 16 - precision;
+            if (lostBits == 0)
+                return v;
+
+            UInt16 result;
+            result.m_value = _mm512_srli_epi16(_mm512_slli_epi16(v.m_value, lostBits), lostBits);
+            return result;
+        }
+
+        static UInt16 Min(const UInt16 &a, const UInt16 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm512_min_epu16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 Min(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm512_min_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt15 Min(const UInt15 &a, const UInt15 &b)
+        {
+            UInt15 result;
+            result.m_value = _mm512_min_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Min(const Float &a, const Float &b)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm512_min_ps(a.m_values[i], b.m_values[i]);
+            return result;
+        }
+
+        static UInt16 Max(const UInt16 &a, const UInt16 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm512_max_epu16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 Max(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm512_max_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt15 Max(const UInt15 &a, const UInt15 &b)
+        {
+            UInt15 result;
+            result.m_value = _mm512_max_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Max(const Float &a, const Float &b)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm512_max_ps(a.m_values[i], b.m_values[i]);
+            return result;
+        }
+
+        static Float Clamp(const Float &v, float min, float max)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm512_max_ps(_mm512_min_ps(v.m_values[i], _mm512_set1_ps(max)), _mm512_set1_ps(min));
+            return result;
+        }
+
+        static Float Reciprocal(const Float &v)
+        {
+            // Uses the 256-bit approximation so results match the SSE2 and AVX2 versions
+            Float result;
+            for (int i = 0; i < 2; i++)
+            {
+                __m512d vd = _mm512_castps_pd(v.m_values[i]);
+                __m256 lo = _mm256_rcp_ps(_mm256_castpd_ps(_mm512_castpd512_pd256(vd)));
+                __m256 hi = _mm256_rcp_ps(_mm256_castpd_ps(_mm512_extractf64x4_pd(vd, 1)));
+                result.m_values[i] = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(lo)), _mm256_castps_pd(hi), 1));
+            }
+            return result;
+        }
+
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, int channel, UInt15 &chOut)
+        {
+            int16_t values[32];
+            for (int i = 0; i < 32; i++)
+                values[i] = inputBlocks[i].m_pixels[pxOffset][channel];
+
+            chOut.m_value = _mm512_loadu_si512(values);
+        }
+
+        // Reads one pixel of each block into all four channels
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, UInt15 channels[4])
+        {
+            uint32_t values[32];
+            for (int i = 0; i < 32; i++)
+                memcpy(&values[i], inputBlocks[i].m_pixels[pxOffset], 4);
+
+            // Widen to 16 bits and transpose within each 128-bit lane, leaving 4 blocks of 2 channels in each lane
+            __m512i zero = _mm512_setzero_si512();
+            __m512i rg[2];
+            __m512i ba[2];
+            for (int half = 0; half < 2; half++)
+            {
+                __m512i pixels = _mm512_loadu_si512(values + half * 16);
+                __m512i lowPixels = _mm512_unpacklo_epi8(pixels, zero);
+                __m512i highPixels = _mm512_unpackhi_epi8(pixels, zero);
+                __m512i evenOdd0 = _mm512_unpacklo_epi16(lowPixels, highPixels);
+                __m512i evenOdd1 = _mm512_unpackhi_epi16(lowPixels, highPixels);
+                rg[half] = _mm512_unpacklo_epi16(evenOdd0, evenOdd1);
+                ba[half] = _mm512_unpackhi_epi16(evenOdd0, evenOdd1);
+            }
+
+            const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+            channels[0].m_value = _mm512_permutexvar_epi64(order, _mm512_unpacklo_epi64(rg[0], rg[1]));
+            channels[1].m_value = _mm512_permutexvar_epi64(order, _mm512_unpackhi_epi64(rg[0], rg[1]));
+            channels[2].m_value = _mm512_permutexvar_epi64(order, _mm512_unpacklo_epi64(ba[0], ba[1]));
+            channels[3].m_value = _mm512_permutexvar_epi64(order, _mm512_unpackhi_epi64(ba[0], ba[1]));
+        }
+
+        // Writes one pixel of each block, from channels that are all in the 0-255 range.  Signed blocks take the two's complement bytes.
+        template<class TBlock>
+        static void ConvertLDROutputs(TBlock* outputBlocks, int pxOffset, const UInt15 channels[4])
+        {
+            __m512i rg = _mm512_or_si512(channels[0].m_value, _mm512_slli_epi16(channels[1].m_value, 8));
+            __m512i ba = _mm512_or_si512(channels[2].m_value, _mm512_slli_epi16(channels[3].m_value, 8));
+
+            // Unpacking interleaves within each 128-bit lane
+            uint32_t lowValues[16];
+            uint32_t highValues[16];
+            _mm512_storeu_si512(reinterpret_cast<__m512i*>(lowValues), _mm512_unpacklo_epi16(rg, ba));
+            _mm512_storeu_si512(reinterpret_cast<__m512i*>(highValues), _mm512_unpackhi_epi16(rg, ba));
+
+            for (int i = 0; i < 32; i++)
+            {
+                const int laneIndex = (i / 8) * 4 + (i % 4);
+                const uint32_t value = ((i % 8) < 4) ? lowValues[laneIndex] : highValues[laneIndex];
+                memcpy(outputBlocks[i].m_pixels[pxOffset], &value, 4);
+            }
+        }
+
+        static void ConvertHDRInputs(const PixelBlockF16* inputBlocks, int pxOffset, int channel, SInt16 &chOut)
+        {
+            int16_t values[32];
+            for (int i = 0; i < 32; i++)
+                values[i] = inputBlocks[i].m_pixels[pxOffset][channel];
+
+            chOut.m_value = _mm512_loadu_si512(values);
+        }
+
+        static void ConvertHDROutputs(PixelBlockF16* outputBlocks, int pxOffset, int channel, const SInt16 &ch)
+        {
+            int16_t values[32];
+            _mm512_storeu_si512(values, ch.m_value);
+
+            for (int i = 0; i < 32; i++)
+                outputBlocks[i].m_pixels[pxOffset][channel] = values[i];
+        }
+
+        static Float MakeFloat(float v)
+        {
+            Float f;
+            f.m_values[0] = f.m_values[1] = _mm512_set1_ps(v);
+            return f;
+        }
+
+        static Float MakeFloatZero()
+        {
+            Float f;
+            f.m_values[0] = f.m_values[1] = _mm512_setzero_ps();
+            return f;
+        }
+
+        static UInt16 MakeUInt16(uint16_t v)
+        {
+            UInt16 result;
+            result.m_value = _mm512_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static SInt16 MakeSInt16(int16_t v)
+        {
+            SInt16 result;
+            result.m_value = _mm512_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static AInt16 MakeAInt16(int16_t v)
+        {
+            AInt16 result;
+            result.m_value = _mm512_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static UInt15 MakeUInt15(uint16_t v)
+        {
+            UInt15 result;
+            result.m_value = _mm512_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static SInt32 MakeSInt32(int32_t v)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm512_set1_epi32(v);
+            result.m_values[1] = _mm512_set1_epi32(v);
+            return result;
+        }
+
+        static UInt31 MakeUInt31(uint32_t v)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm512_set1_epi32(v);
+            result.m_values[1] = _mm512_set1_epi32(v);
+            return result;
+        }
+
+        // Loads ParallelSize values, one per lane, from an array of scalars
+        static UInt16 LoadUInt16(const uint16_t *values)
+        {
+            UInt16 result;
+            result.m_value = _mm512_loadu_si512(values);
+            return result;
+        }
+
+        static UInt15 LoadUInt15(const uint16_t *values)
+        {
+            UInt15 result;
+            result.m_value = _mm512_loadu_si512(values);
+            return result;
+        }
+
+        static SInt16 LoadSInt16(const int16_t *values)
+        {
+            SInt16 result;
+            result.m_value = _mm512_loadu_si512(values);
+            return result;
+        }
+
+        static Int16CompFlag LoadBoolInt16(const bool *values)
+        {
+            __mmask32 mask = 0;
+            for (int i = 0; i < ParallelSize; i++)
+            {
+                if (values[i])
+                    mask = mask | (static_cast<__mmask32>(1) << i);
+            }
+
+            Int16CompFlag result;
+            result.m_value = mask;
+            return result;
+        }
+
+        // Stores each lane to an array of ParallelSize scalars
+        static void StoreUInt16(uint16_t *values, const UInt16 &v)
+        {
+            _mm512_storeu_si512(values, v.m_value);
+        }
+
+        static uint16_t Extract(const UInt16 &v, int offset)
+        {
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int16_t Extract(const SInt16 &v, int offset)
+        {
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static uint16_t Extract(const UInt15 &v, int offset)
+        {
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int16_t Extract(const AInt16 &v, int offset)
+        {
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int32_t Extract(const SInt32 &v, int offset)
+        {
+            int32_t result;
+            memcpy(&result, reinterpret_cast<const int32_t*>(&v.m_values[offset >> 4]) + (offset & 15), sizeof(result));
+            return result;
+        }
+
+        static float Extract(const Float &v, int offset)
+        {
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v.m_values[offset >> 4]) + (offset & 15), sizeof(result));
+            return result;
+        }
+
+        static bool Extract(const ParallelMath::Int16CompFlag &v, int offset)
+        {
+            return ((v.m_value >> offset) & 1) != 0;
+        }
+
+        static void PutUInt16(UInt16 &dest, int offset, uint16_t v)
+        {
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutUInt15(UInt15 &dest, int offset, uint16_t v)
+        {
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutSInt16(SInt16 &dest, int offset, int16_t v)
+        {
+            memcpy(reinterpret_cast<int16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static float ExtractFloat(const Float& v, int offset)
+        {
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v) + offset, sizeof(result));
+            return result;
+        }
+
+        static void PutFloat(Float &dest, int offset, float v)
+        {
+            memcpy(reinterpret_cast<float*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutBoolInt16(Int16CompFlag &dest, int offset, bool v)
+        {
+            const __mmask32 bit = static_cast<__mmask32>(1) << offset;
+            if (v)
+                dest.m_value = dest.m_value | bit;
+            else
+                dest.m_value = dest.m_value & ~bit;
+        }
+
+        static Int32CompFlag Less(const UInt31 &a, const UInt31 &b)
+        {
+            Int32CompFlag result;
+            result.m_value = CombineMasks(_mm512_cmplt_epi32_mask(a.m_values[0], b.m_values[0]), _mm512_cmplt_epi32_mask(a.m_values[1], b.m_values[1]));
+            return result;
+        }
+
+        static Int16CompFlag Less(const SInt16 &a, const SInt16 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm512_cmplt_epi16_mask(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Int16CompFlag Less(const UInt15 &a, const UInt15 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm512_cmplt_epi16_mask(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Int16CompFlag LessOrEqual(const UInt15 &a, const UInt15 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm512_cmplt_epi16_mask(a.m_value, b.m_value);
+            return result;
+        }
+
+        static FloatCompFlag Less(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            result.m_value = CombineMasks(_mm512_cmp_ps_mask(a.m_values[0], b.m_values[0], _CMP_LT_OS), _mm512_cmp_ps_mask(a.m_values[1], b.m_values[1], _CMP_LT_OS));
+            return result;
+        }
+
+        static FloatCompFlag LessOrEqual(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            result.m_value = CombineMasks(_mm512_cmp_ps_mask(a.m_values[0], b.m_values[0], _CMP_LE_OS), _mm512_cmp_ps_mask(a.m_values[1], b.m_values[1], _CMP_LE_OS));
+            return result;
+        }
+
+        template<int TSubtype>
+        static Int16CompFlag Equal(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm512_cmpeq_epi16_mask(a.m_value, b.m_value);
+            return result;
+        }
+
+        static FloatCompFlag Equal(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            result.m_value = CombineMasks(_mm512_cmp_ps_mask(a.m_values[0], b.m_values[0], _CMP_EQ_OQ), _mm512_cmp_ps_mask(a.m_values[1], b.m_values[1], _CMP_EQ_OQ));
+            return result;
+        }
+
+        static Int16CompFlag Equal(const Int16CompFlag &a, const Int16CompFlag &b)
+        {
+            Int16CompFlag notResult;
+            notResult.m_value = a.m_value ^ b.m_value;
+            return Not(notResult);
+        }
+
+        static Float ToFloat(const UInt16 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm512_cvtepi32_ps(WidenLow16(v.m_value));
+            result.m_values[1] = _mm512_cvtepi32_ps(WidenHigh16(v.m_value));
+            return result;
+        }
+
+        static UInt31 ToUInt31(const UInt16 &v)
+        {
+            UInt31 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const UInt16 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const UInt15 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const SInt16 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = SignedWidenLow16(v.m_value);
+            result.m_values[1] = SignedWidenHigh16(v.m_value);
+            return result;
+        }
+
+        static Float ToFloat(const SInt16 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm512_cvtepi32_ps(SignedWidenLow16(v.m_value));
+            result.m_values[1] = _mm512_cvtepi32_ps(SignedWidenHigh16(v.m_value));
+            return result;
+        }
+
+        static Float ToFloat(const UInt15 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm512_cvtepi32_ps(WidenLow16(v.m_value));
+            result.m_values[1] = _mm512_cvtepi32_ps(WidenHigh16(v.m_value));
+            return result;
+        }
+
+        static Float ToFloat(const UInt31 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm512_cvtepi32_ps(v.m_values[0]);
+            result.m_values[1] = _mm512_cvtepi32_ps(v.m_values[1]);
+            return result;
+        }
+
+        static Int16CompFlag FloatFlagToInt16(const FloatCompFlag &v)
+        {
+            Int16CompFlag result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static FloatCompFlag Int16FlagToFloat(const Int16CompFlag &v)
+        {
+            FloatCompFlag result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static Int16CompFlag Int32FlagToInt16(const Int32CompFlag &v)
+        {
+            Int16CompFlag result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static Int16CompFlag MakeBoolInt16(bool b)
+        {
+            Int16CompFlag result;
+            result.m_value = b ? static_cast<__mmask32>(0xffffffffu) : static_cast<__mmask32>(0);
+            return result;
+        }
+
+        static FloatCompFlag MakeBoolFloat(bool b)
+        {
+            FloatCompFlag result;
+            result.m_value = b ? static_cast<__mmask32>(0xffffffffu) : static_cast<__mmask32>(0);
+            return result;
+        }
+
+        static Int16CompFlag AndNot(const Int16CompFlag &a, const Int16CompFlag &b)
+        {
+            Int16CompFlag result;
+            result.m_value = a.m_value & ~b.m_value;
+            return result;
+        }
+
+        static Int16CompFlag Not(const Int16CompFlag &b)
+        {
+            Int16CompFlag result;
+            result.m_value = ~b.m_value;
+            return result;
+        }
+
+        static Int32CompFlag Not(const Int32CompFlag &b)
+        {
+            Int32CompFlag result;
+            result.m_value = ~b.m_value;
+            return result;
+        }
+
+        static UInt16 RoundAndConvertToU16(const Float &v, const void* /*roundingMode*/)
+        {
+            __m512i lo = _mm512_cvtps_epi32(_mm512_add_ps(v.m_values[0], _mm512_set1_ps(-32768)));
+            __m512i hi = _mm512_cvtps_epi32(_mm512_add_ps(v.m_values[1], _mm512_set1_ps(-32768)));
+
+            __m512i packed = PackSaturate32(lo, hi);
+
+            UInt16 result;
+            result.m_value = _mm512_xor_si512(packed, _mm512_set1_epi16(-32768));
+            return result;
+        }
+
+        static UInt15 RoundAndConvertToU15(const Float &v, const void* /*roundingMode*/)
+        {
+            __m512i lo = _mm512_cvtps_epi32(v.m_values[0]);
+            __m512i hi = _mm512_cvtps_epi32(v.m_values[1]);
+
+            UInt15 result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static SInt16 RoundAndConvertToS16(const Float &v, const void* /*roundingMode*/)
+        {
+            __m512i lo = _mm512_cvtps_epi32(v.m_values[0]);
+            __m512i hi = _mm512_cvtps_epi32(v.m_values[1]);
+
+            SInt16 result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static Float Sqrt(const Float &f)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm512_sqrt_ps(f.m_values[i]);
+            return result;
+        }
+
+        static UInt16 Abs(const SInt16 &a)
+        {
+            UInt16 result;
+            result.m_value = _mm512_abs_epi16(a.m_value);
+            return result;
+        }
+
+        static Float Abs(const Float& a)
+        {
+            __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+
+            Float result;
+            result.m_values[0] = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.m_values[0]), absMask));
+            result.m_values[1] = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.m_values[1]), absMask));
+            return result;
+        }
+
+        static UInt16 SqDiffUInt8(const UInt15 &a, const UInt15 &b)
+        {
+            __m512i diff = _mm512_sub_epi16(a.m_value, b.m_value);
+
+            UInt16 result;
+            result.m_value = _mm512_mullo_epi16(diff, diff);
+            return result;
+        }
+
+        static Float SqDiffSInt16(const SInt16 &a, const SInt16 &b)
+        {
+            __m512i diffU = _mm512_sub_epi16(_mm512_max_epi16(a.m_value, b.m_value), _mm512_min_epi16(a.m_value, b.m_value));
+
+            __m512i diffLo = WidenLow16(diffU);
+            __m512i diffHi = WidenHigh16(diffU);
+
+            Float result;
+            result.m_values[0] = _mm512_cvtepi32_ps(_mm512_mullo_epi32(diffLo, diffLo));
+            result.m_values[1] = _mm512_cvtepi32_ps(_mm512_mullo_epi32(diffHi, diffHi));
+
+            return result;
+        }
+
+        static Float TwosCLHalfToFloat(const SInt16 &v)
+        {
+            __m512i signBits = _mm512_and_si512(v.m_value, _mm512_set1_epi16(-32768));
+            __m512i mantissa = _mm512_and_si512(v.m_value, _mm512_set1_epi16(0x03ff));
+            __m512i exponent = _mm512_and_si512(v.m_value, _mm512_set1_epi16(0x7c00));
+
+            __mmask32 isDenormal = _mm512_cmpeq_epi16_mask(exponent, _mm512_setzero_si512());
+
+            // Convert exponent to high-bits
+            exponent = _mm512_add_epi16(_mm512_srli_epi16(exponent, 3), _mm512_set1_epi16(14336));
+
+            __m512i denormalCorrectionHigh = _mm512_maskz_mov_epi16(isDenormal, _mm512_or_si512(signBits, _mm512_set1_epi16(14336)));
+
+            __m512i highBits = _mm512_or_si512(signBits, _mm512_or_si512(exponent, _mm512_srli_epi16(mantissa, 3)));
+            __m512i lowBits = _mm512_slli_epi16(mantissa, 13);
+
+            __m512i flow = _mm512_or_si512(_mm512_slli_epi32(WidenLow16(highBits), 16), WidenLow16(lowBits));
+            __m512i fhigh = _mm512_or_si512(_mm512_slli_epi32(WidenHigh16(highBits), 16), WidenHigh16(lowBits));
+
+            __m512i correctionLow = _mm512_slli_epi32(WidenLow16(denormalCorrectionHigh), 16);
+            __m512i correctionHigh = _mm512_slli_epi32(WidenHigh16(denormalCorrectionHigh), 16);
+
+            Float result;
+            result.m_values[0] = _mm512_sub_ps(_mm512_castsi512_ps(flow), _mm512_castsi512_ps(correctionLow));
+            result.m_values[1] = _mm512_sub_ps(_mm512_castsi512_ps(fhigh), _mm512_castsi512_ps(correctionHigh));
+
+            return result;
+        }
+
+        static Float SqDiff2CLFloat(const SInt16 &a, const Float &b)
+        {
+            Float fa = TwosCLHalfToFloat(a);
+
+            Float diff = fa - b;
+            return diff * diff;
+        }
+
+        static Float SqDiff2CL(const SInt16 &a, const SInt16 &b)
+        {
+            Float fa = TwosCLHalfToFloat(a);
+            Float fb = TwosCLHalfToFloat(b);
+
+            Float diff = fa - fb;
+            return diff * diff;
+        }
+
+        static Float SqDiff2CLFloat(const SInt16 &a, float aWeight, const Float &b)
+        {
+            Float fa = TwosCLHalfToFloat(a) * aWeight;
+
+            Float diff = fa - b;
+            return diff * diff;
+        }
+
+        static UInt16 RightShift(const UInt16 &v, int bits)
+        {
+            UInt16 result;
+            result.m_value = _mm512_srli_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static UInt31 RightShift(const UInt31 &v, int bits)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm512_srli_epi32(v.m_values[0], bits);
+            result.m_values[1] = _mm512_srli_epi32(v.m_values[1], bits);
+            return result;
+        }
+
+        static SInt16 RightShift(const SInt16 &v, int bits)
+        {
+            SInt16 result;
+            result.m_value = _mm512_srai_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static UInt15 RightShift(const UInt15 &v, int bits)
+        {
+            UInt15 result;
+            result.m_value = _mm512_srli_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static SInt32 RightShift(const SInt32 &v, int bits)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm512_srai_epi32(v.m_values[0], bits);
+            result.m_values[1] = _mm512_srai_epi32(v.m_values[1], bits);
+            return result;
+        }
+
+        static SInt16 ToSInt16(const SInt32 &v)
+        {
+            SInt16 result;
+            result.m_value = PackSaturate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static SInt16 ToSInt16(const UInt16 &v)
+        {
+            SInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static SInt16 ToSInt16(const UInt15 &v)
+        {
+            SInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt32 &v)
+        {
+            UInt16 result;
+            result.m_value = PackTruncate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt31 &v)
+        {
+            UInt16 result;
+            result.m_value = PackTruncate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt15 &v)
+        {
+            UInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt15 ToUInt15(const UInt31 &v)
+        {
+            UInt15 result;
+            result.m_value = PackSaturate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static UInt15 ToUInt15(const SInt16 &v)
+        {
+            UInt15 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt15 ToUInt15(const UInt16 &v)
+        {
+            UInt15 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static SInt32 XMultiply(const SInt16 &a, const SInt16 &b)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm512_mullo_epi32(SignedWidenLow16(a.m_value), SignedWidenLow16(b.m_value));
+            result.m_values[1] = _mm512_mullo_epi32(SignedWidenHigh16(a.m_value), SignedWidenHigh16(b.m_value));
+            return result;
+        }
+
+        static SInt32 XMultiply(const SInt16 &a, const UInt15 &b)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm512_mullo_epi32(SignedWidenLow16(a.m_value), WidenLow16(b.m_value));
+            result.m_values[1] = _mm512_mullo_epi32(SignedWidenHigh16(a.m_value), WidenHigh16(b.m_value));
+            return result;
+        }
+
+        static SInt32 XMultiply(const UInt15 &a, const SInt16 &b)
+        {
+            return XMultiply(b, a);
+        }
+
+        static UInt32 XMultiply(const UInt16 &a, const UInt16 &b)
+        {
+            UInt32 result;
+            result.m_values[0] = _mm512_mullo_epi32(WidenLow16(a.m_value), WidenLow16(b.m_value));
+            result.m_values[1] = _mm512_mullo_epi32(WidenHigh16(a.m_value), WidenHigh16(b.m_value));
+            return result;
+        }
+
+        static UInt16 CompactMultiply(const UInt16 &a, const UInt15 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm512_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt16 CompactMultiply(const UInt15 &a, const UInt15 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm512_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 CompactMultiply(const SInt16 &a, const UInt15 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm512_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 CompactMultiply(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm512_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt15 &a, const UInt15 &b)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm512_mullo_epi32(WidenLow16(a.m_value), WidenLow16(b.m_value));
+            result.m_values[1] = _mm512_mullo_epi32(WidenHigh16(a.m_value), WidenHigh16(b.m_value));
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt16 &a, const UInt15 &b)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm512_mullo_epi32(WidenLow16(a.m_value), WidenLow16(b.m_value));
+            result.m_values[1] = _mm512_mullo_epi32(WidenHigh16(a.m_value), WidenHigh16(b.m_value));
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt15 &a, const UInt16 &b)
+        {
+            return XMultiply(b, a);
+        }
+
+        static bool AnySet(const Int16CompFlag &v)
+        {
+            return v.m_value != 0;
+        }
+
+        static bool AllSet(const Int16CompFlag &v)
+        {
+            return v.m_value == static_cast<__mmask32>(0xffffffffu);
+        }
+
+        static bool AnySet(const FloatCompFlag &v)
+        {
+            return v.m_value != 0;
+        }
+
+        static bool AllSet(const FloatCompFlag &v)
+        {
+            return v.m_value == static_cast<__mmask32>(0xffffffffu);
+        }
+    };
+
+#elif defined(CVTT_USE_AVX2)
+    // AVX2 version
+    struct ParallelMath
+    {
+        typedef uint16_t ScalarUInt16;
+        typedef int16_t ScalarSInt16;
+
+        template<unsigned int TRoundingMode>
+        struct RoundForScope
+        {
+            unsigned int m_oldCSR;
+
+            RoundForScope()
+            {
+                m_oldCSR = _mm_getcsr();
+                _mm_setcsr((m_oldCSR & ~_MM_ROUND_MASK) | (TRoundingMode));
+            }
+
+            ~RoundForScope()
+            {
+                _mm_setcsr(m_oldCSR);
+            }
+        };
+
+        struct RoundTowardZeroForScope : RoundForScope<_MM_ROUND_TOWARD_ZERO>
+        {
+        };
+
+        struct RoundTowardNearestForScope : RoundForScope<_MM_ROUND_NEAREST>
+        {
+        };
+
+        struct RoundUpForScope : RoundForScope<_MM_ROUND_UP>
+        {
+        };
+
+        struct RoundDownForScope : RoundForScope<_MM_ROUND_DOWN>
+        {
+        };
+
+        static const int ParallelSize = 16;
+
+        enum Int16Subtype
+        {
+            IntSubtype_Signed,
+            IntSubtype_UnsignedFull,
+            IntSubtype_UnsignedTruncated,
+            IntSubtype_Abstract,
+        };
+
+        // AVX2 pack and unpack ops work within 128-bit lanes, so 16-bit lanes 0-7 map to the first 32-bit vector and 8-15 to the second
+        static __m256i WidenLow16(const __m256i &v)
+        {
+            return _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v));
+        }
+
+        static __m256i WidenHigh16(const __m256i &v)
+        {
+            return _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1));
+        }
+
+        static __m256i SignedWidenLow16(const __m256i &v)
+        {
+            return _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+        }
+
+        static __m256i SignedWidenHigh16(const __m256i &v)
+        {
+            return _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+        }
+
+        static __m256i InterleaveLow16(const __m256i &a, const __m256i &b)
+        {
+            return _mm256_permute2x128_si256(_mm256_unpacklo_epi16(a, b), _mm256_unpackhi_epi16(a, b), 0x20);
+        }
+
+        static __m256i InterleaveHigh16(const __m256i &a, const __m256i &b)
+        {
+            return _mm256_permute2x128_si256(_mm256_unpacklo_epi16(a, b), _mm256_unpackhi_epi16(a, b), 0x31);
+        }
+
+        static __m256i PackSaturate32(const __m256i &lo, const __m256i &hi)
+        {
+            return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xd8);
+        }
+
+        template<int TSubtype>
+        struct VInt16
+        {
+            __m256i m_value;
+
+            inline VInt16 operator+(int16_t other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_add_epi16(m_value, _mm256_set1_epi16(static_cast<int16_t>(other)));
+                return result;
+            }
+
+            inline VInt16 operator+(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_add_epi16(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator|(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_or_si256(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator&(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_and_si256(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator-(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_sub_epi16(m_value, other.m_value);
+                return result;
+            }
+
+            inline VInt16 operator<<(int bits) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_slli_epi16(m_value, bits);
+                return result;
+            }
+
+            inline VInt16 operator^(const VInt16 &other) const
+            {
+                VInt16 result;
+                result.m_value = _mm256_xor_si256(m_value, other.m_value);
+                return result;
+            }
+        };
+
+        typedef VInt16<IntSubtype_Signed> SInt16;
+        typedef VInt16<IntSubtype_UnsignedFull> UInt16;
+        typedef VInt16<IntSubtype_UnsignedTruncated> UInt15;
+        typedef VInt16<IntSubtype_Abstract> AInt16;
+
+        template<int TSubtype>
+        struct VInt32
+        {
+            __m256i m_values[2];
+
+            inline VInt32 operator+(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm256_add_epi32(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_add_epi32(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline VInt32 operator-(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm256_sub_epi32(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_sub_epi32(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline VInt32 operator<<(const int other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm256_slli_epi32(m_values[0], other);
+                result.m_values[1] = _mm256_slli_epi32(m_values[1], other);
+                return result;
+            }
+
+            inline VInt32 operator|(const VInt32& other) const
+            {
+                VInt32 result;
+                result.m_values[0] = _mm256_or_si256(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_or_si256(m_values[1], other.m_values[1]);
+                return result;
+            }
+        };
+
+        typedef VInt32<IntSubtype_Signed> SInt32;
+        typedef VInt32<IntSubtype_UnsignedTruncated> UInt31;
+        typedef VInt32<IntSubtype_UnsignedFull> UInt32;
+        typedef VInt32<IntSubtype_Abstract> AInt32;
+
+        template<class TTargetType>
+        struct LosslessCast
+        {
+#ifdef CVTT_PERMIT_ALIASING
+            template<int TSrcSubtype>
+            static const TTargetType& Cast(const VInt32<TSrcSubtype> &src)
+            {
+                return reinterpret_cast<VInt32<TSubtype>&>(src);
+            }
+
+            template<int TSrcSubtype>
+            static const TTargetType& Cast(const VInt16<TSrcSubtype> &src)
+            {
+                return reinterpret_cast<VInt16<TSubtype>&>(src);
+            }
+#else
+            template<int TSrcSubtype>
+            static TTargetType Cast(const VInt32<TSrcSubtype> &src)
+            {
+                TTargetType result;
+                result.m_values[0] = src.m_values[0];
+                result.m_values[1] = src.m_values[1];
+                return result;
+            }
+
+            template<int TSrcSubtype>
+            static TTargetType Cast(const VInt16<TSrcSubtype> &src)
+            {
+                TTargetType result;
+                result.m_value = src.m_value;
+                return result;
+            }
+#endif
+        };
+
+        struct Int64
+        {
+            __m256i m_values[4];
+        };
+
+        struct Float
+        {
+            __m256 m_values[2];
+
+            inline Float operator+(const Float &other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_add_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_add_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator+(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_add_ps(m_values[0], _mm256_set1_ps(other));
+                result.m_values[1] = _mm256_add_ps(m_values[1], _mm256_set1_ps(other));
+                return result;
+            }
+
+            inline Float operator-(const Float& other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_sub_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_sub_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator-() const
+            {
+                Float result;
+                result.m_values[0] = _mm256_sub_ps(_mm256_setzero_ps(), m_values[0]);
+                result.m_values[1] = _mm256_sub_ps(_mm256_setzero_ps(), m_values[1]);
+                return result;
+            }
+
+            inline Float operator*(const Float& other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_mul_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_mul_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator*(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_mul_ps(m_values[0], _mm256_set1_ps(other));
+                result.m_values[1] = _mm256_mul_ps(m_values[1], _mm256_set1_ps(other));
+                return result;
+            }
+
+            inline Float operator/(const Float &other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_div_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_div_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Float operator/(float other) const
+            {
+                Float result;
+                result.m_values[0] = _mm256_div_ps(m_values[0], _mm256_set1_ps(other));
+                result.m_values[1] = _mm256_div_ps(m_values[1], _mm256_set1_ps(other));
+                return result;
+            }
+        };
+
+        struct Int16CompFlag
+        {
+            __m256i m_value;
+
+            inline Int16CompFlag operator&(const Int16CompFlag &other) const
+            {
+                Int16CompFlag result;
+                result.m_value = _mm256_and_si256(m_value, other.m_value);
+                return result;
+            }
+
+            inline Int16CompFlag operator|(const Int16CompFlag &other) const
+            {
+                Int16CompFlag result;
+                result.m_value = _mm256_or_si256(m_value, other.m_value);
+                return result;
+            }
+        };
+
+        struct Int32CompFlag
+        {
+            __m256i m_values[2];
+
+            inline Int32CompFlag operator&(const Int32CompFlag &other) const
+            {
+                Int32CompFlag result;
+                result.m_values[0] = _mm256_and_si256(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_and_si256(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline Int32CompFlag operator|(const Int32CompFlag &other) const
+            {
+                Int32CompFlag result;
+                result.m_values[0] = _mm256_or_si256(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_or_si256(m_values[1], other.m_values[1]);
+                return result;
+            }
+        };
+
+        struct FloatCompFlag
+        {
+            __m256 m_values[2];
+
+            inline FloatCompFlag operator&(const FloatCompFlag &other) const
+            {
+                FloatCompFlag result;
+                result.m_values[0] = _mm256_and_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_and_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+
+            inline FloatCompFlag operator|(const FloatCompFlag &other) const
+            {
+                FloatCompFlag result;
+                result.m_values[0] = _mm256_or_ps(m_values[0], other.m_values[0]);
+                result.m_values[1] = _mm256_or_ps(m_values[1], other.m_values[1]);
+                return result;
+            }
+        };
+
+        template<int TSubtype>
+        static VInt16<TSubtype> AbstractAdd(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm256_add_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> AbstractSubtract(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm256_sub_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Select(const FloatCompFlag &flag, const Float &a, const Float &b)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_blendv_ps(b.m_values[i], a.m_values[i], flag.m_values[i]);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> Select(const Int16CompFlag &flag, const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm256_blendv_epi8(b.m_value, a.m_value, flag.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static VInt16<TSubtype> SelectOrZero(const Int16CompFlag &flag, const VInt16<TSubtype> &a)
+        {
+            VInt16<TSubtype> result;
+            result.m_value = _mm256_and_si256(flag.m_value, a.m_value);
+            return result;
+        }
+
+        template<int TSubtype>
+        static void ConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
+        {
+            dest.m_value = _mm256_blendv_epi8(dest.m_value, src.m_value, flag.m_value);
+        }
+
+        template<int TSubtype>
+        static void ConditionalSet(VInt32<TSubtype> &dest, const Int16CompFlag &flag, const VInt32<TSubtype> &src)
+        {
+            __m256i lowFlags = SignedWidenLow16(flag.m_value);
+            __m256i highFlags = SignedWidenHigh16(flag.m_value);
+            dest.m_values[0] = _mm256_blendv_epi8(dest.m_values[0], src.m_values[0], lowFlags);
+            dest.m_values[1] = _mm256_blendv_epi8(dest.m_values[1], src.m_values[1], highFlags);
+        }
+
+        static void ConditionalSet(ParallelMath::Int16CompFlag &dest, const Int16CompFlag &flag, const ParallelMath::Int16CompFlag &src)
+        {
+            dest.m_value = _mm256_blendv_epi8(dest.m_value, src.m_value, flag.m_value);
+        }
+
+        static SInt16 ConditionalNegate(const Int16CompFlag &flag, const SInt16 &v)
+        {
+            SInt16 result;
+            result.m_value = _mm256_add_epi16(_mm256_xor_si256(flag.m_value, v.m_value), _mm256_srli_epi16(flag.m_value, 15));
+            return result;
+        }
+
+        template<int TSubtype>
+        static void NotConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
+        {
+            dest.m_value = _mm256_blendv_epi8(src.m_value, dest.m_value, flag.m_value);
+        }
+
+        static void ConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
+        {
+            for (int i = 0; i < 2; i++)
+                dest.m_values[i] = _mm256_blendv_ps(dest.m_values[i], src.m_values[i], flag.m_values[i]);
+        }
+
+        static void NotConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
+        {
+            for (int i = 0; i < 2; i++)
+                dest.m_values[i] = _mm256_blendv_ps(src.m_values[i], dest.m_values[i], flag.m_values[i]);
+        }
+
+        static void MakeSafeDenominator(Float& v)
+        {
+            ConditionalSet(v, Equal(v, MakeFloatZero()), MakeFloat(1.0f));
+        }
+
+        static SInt16 TruncateToPrecisionSigned(const SInt16 &v, int precision)
+        {
+            int lostBits = 16 - precision;
+            if (lostBits == 0)
+                return v;
+
+            SInt16 result;
+            result.m_value = _mm256_srai_epi16(_mm256_slli_epi16(v.m_value, lostBits), lostBits);
+            return result;
+        }
+
+        static UInt16 TruncateToPrecisionUnsigned(const UInt16 &v, int precision)
+        {
+            int lostBits = 16 - precision;
+            if (lostBits == 0)
+                return v;
+
+            UInt16 result;
+            result.m_value = _mm256_srli_epi16(_mm256_slli_epi16(v.m_value, lostBits), lostBits);
+            return result;
+        }
+
+        static UInt16 Min(const UInt16 &a, const UInt16 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm256_min_epu16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 Min(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm256_min_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt15 Min(const UInt15 &a, const UInt15 &b)
+        {
+            UInt15 result;
+            result.m_value = _mm256_min_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Min(const Float &a, const Float &b)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_min_ps(a.m_values[i], b.m_values[i]);
+            return result;
+        }
+
+        static UInt16 Max(const UInt16 &a, const UInt16 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm256_max_epu16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 Max(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm256_max_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt15 Max(const UInt15 &a, const UInt15 &b)
+        {
+            UInt15 result;
+            result.m_value = _mm256_max_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static Float Max(const Float &a, const Float &b)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_max_ps(a.m_values[i], b.m_values[i]);
+            return result;
+        }
+
+        static Float Clamp(const Float &v, float min, float max)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_max_ps(_mm256_min_ps(v.m_values[i], _mm256_set1_ps(max)), _mm256_set1_ps(min));
+            return result;
+        }
+
+        static Float Reciprocal(const Float &v)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_rcp_ps(v.m_values[i]);
+            return result;
+        }
+
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, int channel, UInt15 &chOut)
+        {
+            int16_t values[16];
+            for (int i = 0; i < 16; i++)
+                values[i] = inputBlocks[i].m_pixels[pxOffset][channel];
+
+            chOut.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        }
+
+        // Reads one pixel of each block into all four channels
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, UInt15 channels[4])
+        {
+            uint32_t values[16];
+            for (int i = 0; i < 16; i++)
+                memcpy(&values[i], inputBlocks[i].m_pixels[pxOffset], 4);
+
+            // Widen to 16 bits and transpose within each 128-bit lane, leaving 4 blocks of 2 channels in each lane
+            __m256i zero = _mm256_setzero_si256();
+            __m256i rg[2];
+            __m256i ba[2];
+            for (int half = 0; half < 2; half++)
+            {
+                __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + half * 8));
+                __m256i lowPixels = _mm256_unpacklo_epi8(pixels, zero);
+                __m256i highPixels = _mm256_unpackhi_epi8(pixels, zero);
+                __m256i evenOdd0 = _mm256_unpacklo_epi16(lowPixels, highPixels);
+                __m256i evenOdd1 = _mm256_unpackhi_epi16(lowPixels, highPixels);
+                rg[half] = _mm256_unpacklo_epi16(evenOdd0, evenOdd1);
+                ba[half] = _mm256_unpackhi_epi16(evenOdd0, evenOdd1);
+            }
+
+            channels[0].m_value = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(rg[0], rg[1]), 0xd8);
+            channels[1].m_value = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(rg[0], rg[1]), 0xd8);
+            channels[2].m_value = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(ba[0], ba[1]), 0xd8);
+            channels[3].m_value = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(ba[0], ba[1]), 0xd8);
+        }
+
+        // Writes one pixel of each block, from channels that are all in the 0-255 range.  Signed blocks take the two's complement bytes.
+        template<class TBlock>
+        static void ConvertLDROutputs(TBlock* outputBlocks, int pxOffset, const UInt15 channels[4])
+        {
+            __m256i rg = _mm256_or_si256(channels[0].m_value, _mm256_slli_epi16(channels[1].m_value, 8));
+            __m256i ba = _mm256_or_si256(channels[2].m_value, _mm256_slli_epi16(channels[3].m_value, 8));
+
+            // Unpacking interleaves within each 128-bit lane
+            uint32_t lowValues[8];
+            uint32_t highValues[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lowValues), _mm256_unpacklo_epi16(rg, ba));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(highValues), _mm256_unpackhi_epi16(rg, ba));
+
+            for (int i = 0; i < 16; i++)
+            {
+                const int laneIndex = (i / 8) * 4 + (i % 4);
+                const uint32_t value = ((i % 8) < 4) ? lowValues[laneIndex] : highValues[laneIndex];
+                memcpy(outputBlocks[i].m_pixels[pxOffset], &value, 4);
+            }
+        }
+
+        static void ConvertHDRInputs(const PixelBlockF16* inputBlocks, int pxOffset, int channel, SInt16 &chOut)
+        {
+            int16_t values[16];
+            for (int i = 0; i < 16; i++)
+                values[i] = inputBlocks[i].m_pixels[pxOffset][channel];
+
+            chOut.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        }
+
+        static void ConvertHDROutputs(PixelBlockF16* outputBlocks, int pxOffset, int channel, const SInt16 &ch)
+        {
+            int16_t values[16];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), ch.m_value);
+
+            for (int i = 0; i < 16; i++)
+                outputBlocks[i].m_pixels[pxOffset][channel] = values[i];
+        }
+
+        static Float MakeFloat(float v)
+        {
+            Float f;
+            f.m_values[0] = f.m_values[1] = _mm256_set1_ps(v);
+            return f;
+        }
+
+        static Float MakeFloatZero()
+        {
+            Float f;
+            f.m_values[0] = f.m_values[1] = _mm256_setzero_ps();
+            return f;
+        }
+
+        static UInt16 MakeUInt16(uint16_t v)
+        {
+            UInt16 result;
+            result.m_value = _mm256_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static SInt16 MakeSInt16(int16_t v)
+        {
+            SInt16 result;
+            result.m_value = _mm256_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static AInt16 MakeAInt16(int16_t v)
+        {
+            AInt16 result;
+            result.m_value = _mm256_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static UInt15 MakeUInt15(uint16_t v)
+        {
+            UInt15 result;
+            result.m_value = _mm256_set1_epi16(static_cast<short>(v));
+            return result;
+        }
+
+        static SInt32 MakeSInt32(int32_t v)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm256_set1_epi32(v);
+            result.m_values[1] = _mm256_set1_epi32(v);
+            return result;
+        }
+
+        static UInt31 MakeUInt31(uint32_t v)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm256_set1_epi32(v);
+            result.m_values[1] = _mm256_set1_epi32(v);
+            return result;
+        }
+
+        // Loads ParallelSize values, one per lane, from an array of scalars
+        static UInt16 LoadUInt16(const uint16_t *values)
+        {
+            UInt16 result;
+            result.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+            return result;
+        }
+
+        static UInt15 LoadUInt15(const uint16_t *values)
+        {
+            UInt15 result;
+            result.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+            return result;
+        }
+
+        static SInt16 LoadSInt16(const int16_t *values)
+        {
+            SInt16 result;
+            result.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+            return result;
+        }
+
+        static Int16CompFlag LoadBoolInt16(const bool *values)
+        {
+            int16_t flags[ParallelSize];
+            for (int i = 0; i < ParallelSize; i++)
+                flags[i] = values[i] ? -1 : 0;
+
+            Int16CompFlag result;
+            result.m_value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags));
+            return result;
+        }
+
+        // Stores each lane to an array of ParallelSize scalars
+        static void StoreUInt16(uint16_t *values, const UInt16 &v)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), v.m_value);
+        }
+
+        static uint16_t Extract(const UInt16 &v, int offset)
+        {
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int16_t Extract(const SInt16 &v, int offset)
+        {
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static uint16_t Extract(const UInt15 &v, int offset)
+        {
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int16_t Extract(const AInt16 &v, int offset)
+        {
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
+        }
+
+        static int32_t Extract(const SInt32 &v, int offset)
+        {
+            int32_t result;
+            memcpy(&result, reinterpret_cast<const int32_t*>(&v.m_values[offset >> 3]) + (offset & 7), sizeof(result));
+            return result;
+        }
+
+        static float Extract(const Float &v, int offset)
+        {
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v.m_values[offset >> 3]) + (offset & 7), sizeof(result));
+            return result;
+        }
+
+        static bool Extract(const ParallelMath::Int16CompFlag &v, int offset)
+        {
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result != 0;
+        }
+
+        static void PutUInt16(UInt16 &dest, int offset, uint16_t v)
+        {
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutUInt15(UInt15 &dest, int offset, uint16_t v)
+        {
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutSInt16(SInt16 &dest, int offset, int16_t v)
+        {
+            memcpy(reinterpret_cast<int16_t*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static float ExtractFloat(const Float& v, int offset)
+        {
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v) + offset, sizeof(result));
+            return result;
+        }
+
+        static void PutFloat(Float &dest, int offset, float v)
+        {
+            memcpy(reinterpret_cast<float*>(&dest) + offset, &v, sizeof(v));
+        }
+
+        static void PutBoolInt16(Int16CompFlag &dest, int offset, bool v)
+        {
+            const int16_t value = v ? -1 : 0;
+            memcpy(reinterpret_cast<int16_t*>(&dest) + offset, &value, sizeof(value));
+        }
+
+        static Int32CompFlag Less(const UInt31 &a, const UInt31 &b)
+        {
+            Int32CompFlag result;
+            result.m_values[0] = _mm256_cmpgt_epi32(b.m_values[0], a.m_values[0]);
+            result.m_values[1] = _mm256_cmpgt_epi32(b.m_values[1], a.m_values[1]);
+            return result;
+        }
+
+        static Int16CompFlag Less(const SInt16 &a, const SInt16 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_cmpgt_epi16(b.m_value, a.m_value);
+            return result;
+        }
+
+        static Int16CompFlag Less(const UInt15 &a, const UInt15 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_cmpgt_epi16(b.m_value, a.m_value);
+            return result;
+        }
+
+        static Int16CompFlag LessOrEqual(const UInt15 &a, const UInt15 &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_cmpgt_epi16(b.m_value, a.m_value);
+            return result;
+        }
+
+        static FloatCompFlag Less(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_cmp_ps(a.m_values[i], b.m_values[i], _CMP_LT_OS);
+            return result;
+        }
+
+        static FloatCompFlag LessOrEqual(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_cmp_ps(a.m_values[i], b.m_values[i], _CMP_LE_OS);
+            return result;
+        }
+
+        template<int TSubtype>
+        static Int16CompFlag Equal(const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_cmpeq_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static FloatCompFlag Equal(const Float &a, const Float &b)
+        {
+            FloatCompFlag result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_cmp_ps(a.m_values[i], b.m_values[i], _CMP_EQ_OQ);
+            return result;
+        }
+
+        static Int16CompFlag Equal(const Int16CompFlag &a, const Int16CompFlag &b)
+        {
+            Int16CompFlag notResult;
+            notResult.m_value = _mm256_xor_si256(a.m_value, b.m_value);
+            return Not(notResult);
+        }
+
+        static Float ToFloat(const UInt16 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm256_cvtepi32_ps(WidenLow16(v.m_value));
+            result.m_values[1] = _mm256_cvtepi32_ps(WidenHigh16(v.m_value));
+            return result;
+        }
+
+        static UInt31 ToUInt31(const UInt16 &v)
+        {
+            UInt31 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const UInt16 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const UInt15 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = WidenLow16(v.m_value);
+            result.m_values[1] = WidenHigh16(v.m_value);
+            return result;
+        }
+
+        static SInt32 ToInt32(const SInt16 &v)
+        {
+            SInt32 result;
+            result.m_values[0] = SignedWidenLow16(v.m_value);
+            result.m_values[1] = SignedWidenHigh16(v.m_value);
+            return result;
+        }
+
+        static Float ToFloat(const SInt16 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm256_cvtepi32_ps(SignedWidenLow16(v.m_value));
+            result.m_values[1] = _mm256_cvtepi32_ps(SignedWidenHigh16(v.m_value));
+            return result;
+        }
+
+        static Float ToFloat(const UInt15 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm256_cvtepi32_ps(WidenLow16(v.m_value));
+            result.m_values[1] = _mm256_cvtepi32_ps(WidenHigh16(v.m_value));
+            return result;
+        }
+
+        static Float ToFloat(const UInt31 &v)
+        {
+            Float result;
+            result.m_values[0] = _mm256_cvtepi32_ps(v.m_values[0]);
+            result.m_values[1] = _mm256_cvtepi32_ps(v.m_values[1]);
+            return result;
+        }
+
+        static Int16CompFlag FloatFlagToInt16(const FloatCompFlag &v)
+        {
+            __m256i lo = _mm256_castps_si256(v.m_values[0]);
+            __m256i hi = _mm256_castps_si256(v.m_values[1]);
+
+            Int16CompFlag result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static FloatCompFlag Int16FlagToFloat(const Int16CompFlag &v)
+        {
+            __m256i lo = SignedWidenLow16(v.m_value);
+            __m256i hi = SignedWidenHigh16(v.m_value);
+
+            FloatCompFlag result;
+            result.m_values[0] = _mm256_castsi256_ps(lo);
+            result.m_values[1] = _mm256_castsi256_ps(hi);
+            return result;
+        }
+
+        static Int16CompFlag Int32FlagToInt16(const Int32CompFlag &v)
+        {
+            __m256i lo = v.m_values[0];
+            __m256i hi = v.m_values[1];
+
+            Int16CompFlag result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static Int16CompFlag MakeBoolInt16(bool b)
+        {
+            Int16CompFlag result;
+            if (b)
+                result.m_value = _mm256_set1_epi16(-1);
+            else
+                result.m_value = _mm256_setzero_si256();
+            return result;
+        }
+
+        static FloatCompFlag MakeBoolFloat(bool b)
+        {
+            FloatCompFlag result;
+            if (b)
+                result.m_values[0] = result.m_values[1] = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            else
+                result.m_values[0] = result.m_values[1] = _mm256_setzero_ps();
+            return result;
+        }
+
+        static Int16CompFlag AndNot(const Int16CompFlag &a, const Int16CompFlag &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_andnot_si256(b.m_value, a.m_value);
+            return result;
+        }
+
+        static Int16CompFlag Not(const Int16CompFlag &b)
+        {
+            Int16CompFlag result;
+            result.m_value = _mm256_xor_si256(b.m_value, _mm256_set1_epi32(-1));
+            return result;
+        }
+
+        static Int32CompFlag Not(const Int32CompFlag &b)
+        {
+            Int32CompFlag result;
+            result.m_values[0] = _mm256_xor_si256(b.m_values[0], _mm256_set1_epi32(-1));
+            result.m_values[1] = _mm256_xor_si256(b.m_values[1], _mm256_set1_epi32(-1));
+            return result;
+        }
+
+        static UInt16 RoundAndConvertToU16(const Float &v, const void* /*roundingMode*/)
+        {
+            __m256i lo = _mm256_cvtps_epi32(_mm256_add_ps(v.m_values[0], _mm256_set1_ps(-32768)));
+            __m256i hi = _mm256_cvtps_epi32(_mm256_add_ps(v.m_values[1], _mm256_set1_ps(-32768)));
+
+            __m256i packed = PackSaturate32(lo, hi);
+
+            UInt16 result;
+            result.m_value = _mm256_xor_si256(packed, _mm256_set1_epi16(-32768));
+            return result;
+        }
+
+        static UInt15 RoundAndConvertToU15(const Float &v, const void* /*roundingMode*/)
+        {
+            __m256i lo = _mm256_cvtps_epi32(v.m_values[0]);
+            __m256i hi = _mm256_cvtps_epi32(v.m_values[1]);
+
+            UInt15 result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static SInt16 RoundAndConvertToS16(const Float &v, const void* /*roundingMode*/)
+        {
+            __m256i lo = _mm256_cvtps_epi32(v.m_values[0]);
+            __m256i hi = _mm256_cvtps_epi32(v.m_values[1]);
+
+            SInt16 result;
+            result.m_value = PackSaturate32(lo, hi);
+            return result;
+        }
+
+        static Float Sqrt(const Float &f)
+        {
+            Float result;
+            for (int i = 0; i < 2; i++)
+                result.m_values[i] = _mm256_sqrt_ps(f.m_values[i]);
+            return result;
+        }
+
+        static UInt16 Abs(const SInt16 &a)
+        {
+            __m256i signBitsXor = _mm256_srai_epi16(a.m_value, 15);
+            __m256i signBitsAdd = _mm256_srli_epi16(a.m_value, 15);
+
+            UInt16 result;
+            result.m_value = _mm256_add_epi16(_mm256_xor_si256(a.m_value, signBitsXor), signBitsAdd);
+            return result;
+        }
+
+        static Float Abs(const Float& a)
+        {
+            __m256 invMask = _mm256_set1_ps(-0.0f);
+
+            Float result;
+            result.m_values[0] = _mm256_andnot_ps(invMask, a.m_values[0]);
+            result.m_values[1] = _mm256_andnot_ps(invMask, a.m_values[1]);
+            return result;
+        }
+
+        static UInt16 SqDiffUInt8(const UInt15 &a, const UInt15 &b)
+        {
+            __m256i diff = _mm256_sub_epi16(a.m_value, b.m_value);
+
+            UInt16 result;
+            result.m_value = _mm256_mullo_epi16(diff, diff);
+            return result;
+        }
+
+        static Float SqDiffSInt16(const SInt16 &a, const SInt16 &b)
+        {
+            __m256i diffU = _mm256_sub_epi16(_mm256_max_epi16(a.m_value, b.m_value), _mm256_min_epi16(a.m_value, b.m_value));
+
+            __m256i mulHi = _mm256_mulhi_epu16(diffU, diffU);
+            __m256i mulLo = _mm256_mullo_epi16(diffU, diffU);
+
+            Float result;
+            result.m_values[0] = _mm256_cvtepi32_ps(InterleaveLow16(mulLo, mulHi));
+            result.m_values[1] = _mm256_cvtepi32_ps(InterleaveHigh16(mulLo, mulHi));
+
+            return result;
+        }
+
+        static Float TwosCLHalfToFloat(const SInt16 &v)
+        {
+            __m256i signBits = _mm256_and_si256(v.m_value, _mm256_set1_epi16(-32768));
+            __m256i mantissa = _mm256_and_si256(v.m_value, _mm256_set1_epi16(0x03ff));
+            __m256i exponent = _mm256_and_si256(v.m_value, _mm256_set1_epi16(0x7c00));
+
+            __m256i isDenormal = _mm256_cmpeq_epi16(exponent, _mm256_setzero_si256());
+
+            // Convert exponent to high-bits
+            exponent = _mm256_add_epi16(_mm256_srli_epi16(exponent, 3), _mm256_set1_epi16(14336));
+
+            __m256i denormalCorrectionHigh = _mm256_and_si256(isDenormal, _mm256_or_si256(signBits, _mm256_set1_epi16(14336)));
+
+            __m256i highBits = _mm256_or_si256(signBits, _mm256_or_si256(exponent, _mm256_srli_epi16(mantissa, 3)));
+            __m256i lowBits = _mm256_slli_epi16(mantissa, 13);
+
+            __m256i flow = InterleaveLow16(lowBits, highBits);
+            __m256i fhigh = InterleaveHigh16(lowBits, highBits);
+
+            __m256i correctionLow = InterleaveLow16(_mm256_setzero_si256(), denormalCorrectionHigh);
+            __m256i correctionHigh = InterleaveHigh16(_mm256_setzero_si256(), denormalCorrectionHigh);
+
+            Float result;
+            result.m_values[0] = _mm256_sub_ps(_mm256_castsi256_ps(flow), _mm256_castsi256_ps(correctionLow));
+            result.m_values[1] = _mm256_sub_ps(_mm256_castsi256_ps(fhigh), _mm256_castsi256_ps(correctionHigh));
+
+            return result;
+        }
+
+        static Float SqDiff2CLFloat(const SInt16 &a, const Float &b)
+        {
+            Float fa = TwosCLHalfToFloat(a);
+
+            Float diff = fa - b;
+            return diff * diff;
+        }
+
+        static Float SqDiff2CL(const SInt16 &a, const SInt16 &b)
+        {
+            Float fa = TwosCLHalfToFloat(a);
+            Float fb = TwosCLHalfToFloat(b);
+
+            Float diff = fa - fb;
+            return diff * diff;
+        }
+
+        static Float SqDiff2CLFloat(const SInt16 &a, float aWeight, const Float &b)
+        {
+            Float fa = TwosCLHalfToFloat(a) * aWeight;
+
+            Float diff = fa - b;
+            return diff * diff;
+        }
+
+        static UInt16 RightShift(const UInt16 &v, int bits)
+        {
+            UInt16 result;
+            result.m_value = _mm256_srli_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static UInt31 RightShift(const UInt31 &v, int bits)
+        {
+            UInt31 result;
+            result.m_values[0] = _mm256_srli_epi32(v.m_values[0], bits);
+            result.m_values[1] = _mm256_srli_epi32(v.m_values[1], bits);
+            return result;
+        }
+
+        static SInt16 RightShift(const SInt16 &v, int bits)
+        {
+            SInt16 result;
+            result.m_value = _mm256_srai_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static UInt15 RightShift(const UInt15 &v, int bits)
+        {
+            UInt15 result;
+            result.m_value = _mm256_srli_epi16(v.m_value, bits);
+            return result;
+        }
+
+        static SInt32 RightShift(const SInt32 &v, int bits)
+        {
+            SInt32 result;
+            result.m_values[0] = _mm256_srai_epi32(v.m_values[0], bits);
+            result.m_values[1] = _mm256_srai_epi32(v.m_values[1], bits);
+            return result;
+        }
+
+        static SInt16 ToSInt16(const SInt32 &v)
+        {
+            SInt16 result;
+            result.m_value = PackSaturate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static SInt16 ToSInt16(const UInt16 &v)
+        {
+            SInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static SInt16 ToSInt16(const UInt15 &v)
+        {
+            SInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt32 &v)
+        {
+            __m256i low = _mm256_srai_epi32(_mm256_slli_epi32(v.m_values[0], 16), 16);
+            __m256i high = _mm256_srai_epi32(_mm256_slli_epi32(v.m_values[1], 16), 16);
+
+            UInt16 result;
+            result.m_value = PackSaturate32(low, high);
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt31 &v)
+        {
+            __m256i low = _mm256_srai_epi32(_mm256_slli_epi32(v.m_values[0], 16), 16);
+            __m256i high = _mm256_srai_epi32(_mm256_slli_epi32(v.m_values[1], 16), 16);
+
+            UInt16 result;
+            result.m_value = PackSaturate32(low, high);
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt15 &v)
+        {
+            UInt16 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt15 ToUInt15(const UInt31 &v)
+        {
+            UInt15 result;
+            result.m_value = PackSaturate32(v.m_values[0], v.m_values[1]);
+            return result;
+        }
+
+        static UInt15 ToUInt15(const SInt16 &v)
+        {
+            UInt15 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static UInt15 ToUInt15(const UInt16 &v)
+        {
+            UInt15 result;
+            result.m_value = v.m_value;
+            return result;
+        }
+
+        static SInt32 XMultiply(const SInt16 &a, const SInt16 &b)
+        {
+            __m256i high = _mm256_mulhi_epi16(a.m_value, b.m_value);
+            __m256i low = _mm256_mullo_epi16(a.m_value, b.m_value);
+
+            SInt32 result;
+            result.m_values[0] = InterleaveLow16(low, high);
+            result.m_values[1] = InterleaveHigh16(low, high);
+            return result;
+        }
+
+        static SInt32 XMultiply(const SInt16 &a, const UInt15 &b)
+        {
+            __m256i high = _mm256_mulhi_epi16(a.m_value, b.m_value);
+            __m256i low = _mm256_mullo_epi16(a.m_value, b.m_value);
+
+            SInt32 result;
+            result.m_values[0] = InterleaveLow16(low, high);
+            result.m_values[1] = InterleaveHigh16(low, high);
+            return result;
+        }
+
+        static SInt32 XMultiply(const UInt15 &a, const SInt16 &b)
+        {
+            return XMultiply(b, a);
+        }
+
+        static UInt32 XMultiply(const UInt16 &a, const UInt16 &b)
+        {
+            __m256i high = _mm256_mulhi_epu16(a.m_value, b.m_value);
+            __m256i low = _mm256_mullo_epi16(a.m_value, b.m_value);
+
+            UInt32 result;
+            result.m_values[0] = InterleaveLow16(low, high);
+            result.m_values[1] = InterleaveHigh16(low, high);
+            return result;
+        }
+
+        static UInt16 CompactMultiply(const UInt16 &a, const UInt15 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm256_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt16 CompactMultiply(const UInt15 &a, const UInt15 &b)
+        {
+            UInt16 result;
+            result.m_value = _mm256_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 CompactMultiply(const SInt16 &a, const UInt15 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm256_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static SInt16 CompactMultiply(const SInt16 &a, const SInt16 &b)
+        {
+            SInt16 result;
+            result.m_value = _mm256_mullo_epi16(a.m_value, b.m_value);
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt15 &a, const UInt15 &b)
+        {
+            __m256i high = _mm256_mulhi_epu16(a.m_value, b.m_value);
+            __m256i low = _mm256_mullo_epi16(a.m_value, b.m_value);
+
+            UInt31 result;
+            result.m_values[0] = InterleaveLow16(low, high);
+            result.m_values[1] = InterleaveHigh16(low, high);
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt16 &a, const UInt15 &b)
+        {
+            __m256i high = _mm256_mulhi_epu16(a.m_value, b.m_value);
+            __m256i low = _mm256_mullo_epi16(a.m_value, b.m_value);
+
+            UInt31 result;
+            result.m_values[0] = InterleaveLow16(low, high);
+            result.m_values[1] = InterleaveHigh16(low, high);
+            return result;
+        }
+
+        static UInt31 XMultiply(const UInt15 &a, const UInt16 &b)
+        {
+            return XMultiply(b, a);
+        }
+
+        static bool AnySet(const Int16CompFlag &v)
+        {
+            return _mm256_movemask_epi8(v.m_value) != 0;
+        }
+
+        static bool AllSet(const Int16CompFlag &v)
+        {
+            return _mm256_movemask_epi8(v.m_value) == -1;
+        }
+
+        static bool AnySet(const FloatCompFlag &v)
+        {
+            return _mm256_movemask_ps(v.m_values[0]) != 0 || _mm256_movemask_ps(v.m_values[1]) != 0;
+        }
+
+        static bool AllSet(const FloatCompFlag &v)
+        {
+            return _mm256_movemask_ps(v.m_values[0]) == 0xff && _mm256_movemask_ps(v.m_values[1]) == 0xff;
+        }
+    };
+
+#elif defined(CVTT_USE_SSE2)
+    // SSE2 version, optionally using SSE4.1 instructions
     struct ParallelMath
     {
         typedef uint16_t ScalarUInt16;
@@ -404,7 +3110,11 @@ namespace cvtt
         {
             Float result;
             for (int i = 0; i < 2; i++)
+#if defined(CVTT_USE_SSE41)
+                result.m_values[i] = _mm_blendv_ps(b.m_values[i], a.m_values[i], flag.m_values[i]);
+#else
                 result.m_values[i] = _mm_or_ps(_mm_and_ps(flag.m_values[i], a.m_values[i]), _mm_andnot_ps(flag.m_values[i], b.m_values[i]));
+#endif
             return result;
         }
 
@@ -412,7 +3122,11 @@ namespace cvtt
         static VInt16<TSubtype> Select(const Int16CompFlag &flag, const VInt16<TSubtype> &a, const VInt16<TSubtype> &b)
         {
             VInt16<TSubtype> result;
+#if defined(CVTT_USE_SSE41)
+            result.m_value = _mm_blendv_epi8(b.m_value, a.m_value, flag.m_value);
+#else
             result.m_value = _mm_or_si128(_mm_and_si128(flag.m_value, a.m_value), _mm_andnot_si128(flag.m_value, b.m_value));
+#endif
             return result;
         }
 
@@ -427,7 +3141,11 @@ namespace cvtt
         template<int TSubtype>
         static void ConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
         {
+#if defined(CVTT_USE_SSE41)
+            dest.m_value = _mm_blendv_epi8(dest.m_value, src.m_value, flag.m_value);
+#else
             dest.m_value = _mm_or_si128(_mm_andnot_si128(flag.m_value, dest.m_value), _mm_and_si128(flag.m_value, src.m_value));
+#endif
         }
 
         template<int TSubtype>
@@ -435,8 +3153,13 @@ namespace cvtt
         {
             __m128i lowFlags = _mm_unpacklo_epi16(flag.m_value, flag.m_value);
             __m128i highFlags = _mm_unpackhi_epi16(flag.m_value, flag.m_value);
+#if defined(CVTT_USE_SSE41)
+            dest.m_values[0] = _mm_blendv_epi8(dest.m_values[0], src.m_values[0], lowFlags);
+            dest.m_values[1] = _mm_blendv_epi8(dest.m_values[1], src.m_values[1], highFlags);
+#else
             dest.m_values[0] = _mm_or_si128(_mm_andnot_si128(lowFlags, dest.m_values[0]), _mm_and_si128(lowFlags, src.m_values[0]));
             dest.m_values[1] = _mm_or_si128(_mm_andnot_si128(highFlags, dest.m_values[1]), _mm_and_si128(highFlags, src.m_values[1]));
+#endif
         }
 
         static void ConditionalSet(ParallelMath::Int16CompFlag &dest, const Int16CompFlag &flag, const ParallelMath::Int16CompFlag &src)
@@ -454,19 +3177,31 @@ namespace cvtt
         template<int TSubtype>
         static void NotConditionalSet(VInt16<TSubtype> &dest, const Int16CompFlag &flag, const VInt16<TSubtype> &src)
         {
+#if defined(CVTT_USE_SSE41)
+            dest.m_value = _mm_blendv_epi8(src.m_value, dest.m_value, flag.m_value);
+#else
             dest.m_value = _mm_or_si128(_mm_and_si128(flag.m_value, dest.m_value), _mm_andnot_si128(flag.m_value, src.m_value));
+#endif
         }
 
         static void ConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
         {
             for (int i = 0; i < 2; i++)
+#if defined(CVTT_USE_SSE41)
+                dest.m_values[i] = _mm_blendv_ps(dest.m_values[i], src.m_values[i], flag.m_values[i]);
+#else
                 dest.m_values[i] = _mm_or_ps(_mm_andnot_ps(flag.m_values[i], dest.m_values[i]), _mm_and_ps(flag.m_values[i], src.m_values[i]));
+#endif
         }
 
         static void NotConditionalSet(Float &dest, const FloatCompFlag &flag, const Float &src)
         {
             for (int i = 0; i < 2; i++)
+#if defined(CVTT_USE_SSE41)
+                dest.m_values[i] = _mm_blendv_ps(src.m_values[i], dest.m_values[i], flag.m_values[i]);
+#else
                 dest.m_values[i] = _mm_or_ps(_mm_and_ps(flag.m_values[i], dest.m_values[i]), _mm_andnot_ps(flag.m_values[i], src.m_values[i]));
+#endif
         }
 
         static void MakeSafeDenominator(Float& v)
@@ -498,10 +3233,13 @@ namespace cvtt
 
         static UInt16 Min(const UInt16 &a, const UInt16 &b)
         {
-            __m128i bitFlip = _mm_set1_epi16(-32768);
-
             UInt16 result;
+#if defined(CVTT_USE_SSE41)
+            result.m_value = _mm_min_epu16(a.m_value, b.m_value);
+#else
+            __m128i bitFlip = _mm_set1_epi16(-32768);
             result.m_value = _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a.m_value, bitFlip), _mm_xor_si128(b.m_value, bitFlip)), bitFlip);
+#endif
             return result;
         }
 
@@ -529,10 +3267,13 @@ namespace cvtt
 
         static UInt16 Max(const UInt16 &a, const UInt16 &b)
         {
-            __m128i bitFlip = _mm_set1_epi16(-32768);
-
             UInt16 result;
+#if defined(CVTT_USE_SSE41)
+            result.m_value = _mm_max_epu16(a.m_value, b.m_value);
+#else
+            __m128i bitFlip = _mm_set1_epi16(-32768);
             result.m_value = _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a.m_value, bitFlip), _mm_xor_si128(b.m_value, bitFlip)), bitFlip);
+#endif
             return result;
         }
 
@@ -583,6 +3324,55 @@ namespace cvtt
             chOut.m_value = _mm_set_epi16(values[7], values[6], values[5], values[4], values[3], values[2], values[1], values[0]);
         }
 
+        // Reads one pixel of each block into all four channels
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, UInt15 channels[4])
+        {
+            uint32_t values[8];
+            for (int i = 0; i < 8; i++)
+                memcpy(&values[i], inputBlocks[i].m_pixels[pxOffset], 4);
+
+            // Widen to 16 bits and transpose, leaving 4 blocks of 2 channels in each register
+            __m128i zero = _mm_setzero_si128();
+            __m128i rg[2];
+            __m128i ba[2];
+            for (int half = 0; half < 2; half++)
+            {
+                __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + half * 4));
+                __m128i lowPixels = _mm_unpacklo_epi8(pixels, zero);
+                __m128i highPixels = _mm_unpackhi_epi8(pixels, zero);
+                __m128i evenOdd0 = _mm_unpacklo_epi16(lowPixels, highPixels);
+                __m128i evenOdd1 = _mm_unpackhi_epi16(lowPixels, highPixels);
+                rg[half] = _mm_unpacklo_epi16(evenOdd0, evenOdd1);
+                ba[half] = _mm_unpackhi_epi16(evenOdd0, evenOdd1);
+            }
+
+            channels[0].m_value = _mm_unpacklo_epi64(rg[0], rg[1]);
+            channels[1].m_value = _mm_unpackhi_epi64(rg[0], rg[1]);
+            channels[2].m_value = _mm_unpacklo_epi64(ba[0], ba[1]);
+            channels[3].m_value = _mm_unpackhi_epi64(ba[0], ba[1]);
+        }
+
+        // Writes one pixel of each block, from channels that are all in the 0-255 range.  Signed blocks take the two's complement bytes.
+        template<class TBlock>
+        static void ConvertLDROutputs(TBlock* outputBlocks, int pxOffset, const UInt15 channels[4])
+        {
+            __m128i rg = _mm_or_si128(channels[0].m_value, _mm_slli_epi16(channels[1].m_value, 8));
+            __m128i ba = _mm_or_si128(channels[2].m_value, _mm_slli_epi16(channels[3].m_value, 8));
+
+            // Unpacking interleaves within each 128-bit lane
+            uint32_t lowValues[4];
+            uint32_t highValues[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lowValues), _mm_unpacklo_epi16(rg, ba));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(highValues), _mm_unpackhi_epi16(rg, ba));
+
+            for (int i = 0; i < 8; i++)
+            {
+                const int laneIndex = (i / 8) * 4 + (i % 4);
+                const uint32_t value = ((i % 8) < 4) ? lowValues[laneIndex] : highValues[laneIndex];
+                memcpy(outputBlocks[i].m_pixels[pxOffset], &value, 4);
+            }
+        }
+
         static void ConvertHDRInputs(const PixelBlockF16* inputBlocks, int pxOffset, int channel, SInt16 &chOut)
         {
             int16_t values[8];
@@ -592,6 +3382,15 @@ namespace cvtt
             chOut.m_value = _mm_set_epi16(values[7], values[6], values[5], values[4], values[3], values[2], values[1], values[0]);
         }
 
+        static void ConvertHDROutputs(PixelBlockF16* outputBlocks, int pxOffset, int channel, const SInt16 &ch)
+        {
+            int16_t values[8];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values), ch.m_value);
+
+            for (int i = 0; i < 8; i++)
+                outputBlocks[i].m_pixels[pxOffset][channel] = values[i];
+        }
+
         static Float MakeFloat(float v)
         {
             Float f;
@@ -650,69 +3449,125 @@ namespace cvtt
             return result;
         }
 
+        // Loads ParallelSize values, one per lane, from an array of scalars
+        static UInt16 LoadUInt16(const uint16_t *values)
+        {
+            UInt16 result;
+            result.m_value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+            return result;
+        }
+
+        static UInt15 LoadUInt15(const uint16_t *values)
+        {
+            UInt15 result;
+            result.m_value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+            return result;
+        }
+
+        static SInt16 LoadSInt16(const int16_t *values)
+        {
+            SInt16 result;
+            result.m_value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+            return result;
+        }
+
+        static Int16CompFlag LoadBoolInt16(const bool *values)
+        {
+            int16_t flags[ParallelSize];
+            for (int i = 0; i < ParallelSize; i++)
+                flags[i] = values[i] ? -1 : 0;
+
+            Int16CompFlag result;
+            result.m_value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags));
+            return result;
+        }
+
+        // Stores each lane to an array of ParallelSize scalars
+        static void StoreUInt16(uint16_t *values, const UInt16 &v)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values), v.m_value);
+        }
+
         static uint16_t Extract(const UInt16 &v, int offset)
         {
-            return reinterpret_cast<const uint16_t*>(&v.m_value)[offset];
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
         }
 
         static int16_t Extract(const SInt16 &v, int offset)
         {
-            return reinterpret_cast<const int16_t*>(&v.m_value)[offset];
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
         }
 
         static uint16_t Extract(const UInt15 &v, int offset)
         {
-            return reinterpret_cast<const uint16_t*>(&v.m_value)[offset];
+            uint16_t result;
+            memcpy(&result, reinterpret_cast<const uint16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
         }
 
         static int16_t Extract(const AInt16 &v, int offset)
         {
-            return reinterpret_cast<const int16_t*>(&v.m_value)[offset];
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result;
         }
 
         static int32_t Extract(const SInt32 &v, int offset)
         {
-            return reinterpret_cast<const int32_t*>(&v.m_values[offset >> 2])[offset & 3];
+            int32_t result;
+            memcpy(&result, reinterpret_cast<const int32_t*>(&v.m_values[offset >> 2]) + (offset & 3), sizeof(result));
+            return result;
         }
 
         static float Extract(const Float &v, int offset)
         {
-            return reinterpret_cast<const float*>(&v.m_values[offset >> 2])[offset & 3];
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v.m_values[offset >> 2]) + (offset & 3), sizeof(result));
+            return result;
         }
 
         static bool Extract(const ParallelMath::Int16CompFlag &v, int offset)
         {
-            return reinterpret_cast<const int16_t*>(&v.m_value)[offset] != 0;
+            int16_t result;
+            memcpy(&result, reinterpret_cast<const int16_t*>(&v.m_value) + offset, sizeof(result));
+            return result != 0;
         }
 
         static void PutUInt16(UInt16 &dest, int offset, uint16_t v)
         {
-            reinterpret_cast<uint16_t*>(&dest)[offset] = v;
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
         }
 
         static void PutUInt15(UInt15 &dest, int offset, uint16_t v)
         {
-            reinterpret_cast<uint16_t*>(&dest)[offset] = v;
+            memcpy(reinterpret_cast<uint16_t*>(&dest) + offset, &v, sizeof(v));
         }
 
         static void PutSInt16(SInt16 &dest, int offset, int16_t v)
         {
-            reinterpret_cast<int16_t*>(&dest)[offset] = v;
+            memcpy(reinterpret_cast<int16_t*>(&dest) + offset, &v, sizeof(v));
         }
 
         static float ExtractFloat(const Float& v, int offset)
         {
-            return reinterpret_cast<const float*>(&v)[offset];
+            float result;
+            memcpy(&result, reinterpret_cast<const float*>(&v) + offset, sizeof(result));
+            return result;
         }
 
         static void PutFloat(Float &dest, int offset, float v)
         {
-            reinterpret_cast<float*>(&dest)[offset] = v;
+            memcpy(reinterpret_cast<float*>(&dest) + offset, &v, sizeof(v));
         }
 
         static void PutBoolInt16(Int16CompFlag &dest, int offset, bool v)
         {
-            reinterpret_cast<int16_t*>(&dest)[offset] = v ? -1 : 0;
+            const int16_t value = v ? -1 : 0;
+            memcpy(reinterpret_cast<int16_t*>(&dest) + offset, &value, sizeof(value));
         }
 
         static Int32CompFlag Less(const UInt31 &a, const UInt31 &b)
@@ -1125,21 +3980,46 @@ namespace cvtt
 
         static UInt16 ToUInt16(const UInt32 &v)
         {
+#if defined(CVTT_USE_SSE41)
+            __m128i lowMask = _mm_set1_epi32(0xffff);
+            __m128i low = _mm_and_si128(v.m_values[0], lowMask);
+            __m128i high = _mm_and_si128(v.m_values[1], lowMask);
+
+            UInt16 result;
+            result.m_value = _mm_packus_epi32(low, high);
+#else
             __m128i low = _mm_srai_epi32(_mm_slli_epi32(v.m_values[0], 16), 16);
             __m128i high = _mm_srai_epi32(_mm_slli_epi32(v.m_values[1], 16), 16);
 
             UInt16 result;
             result.m_value = _mm_packs_epi32(low, high);
+#endif
             return result;
         }
 
         static UInt16 ToUInt16(const UInt31 &v)
         {
+#if defined(CVTT_USE_SSE41)
+            __m128i lowMask = _mm_set1_epi32(0xffff);
+            __m128i low = _mm_and_si128(v.m_values[0], lowMask);
+            __m128i high = _mm_and_si128(v.m_values[1], lowMask);
+
+            UInt16 result;
+            result.m_value = _mm_packus_epi32(low, high);
+#else
             __m128i low = _mm_srai_epi32(_mm_slli_epi32(v.m_values[0], 16), 16);
             __m128i high = _mm_srai_epi32(_mm_slli_epi32(v.m_values[1], 16), 16);
 
             UInt16 result;
             result.m_value = _mm_packs_epi32(low, high);
+#endif
+            return result;
+        }
+
+        static UInt16 ToUInt16(const UInt15 &v)
+        {
+            UInt16 result;
+            result.m_value = v.m_value;
             return result;
         }
 
@@ -1259,12 +4139,20 @@ namespace cvtt
 
         static bool AnySet(const Int16CompFlag &v)
         {
+#if defined(CVTT_USE_SSE41)
+            return _mm_testz_si128(v.m_value, v.m_value) == 0;
+#else
             return _mm_movemask_epi8(v.m_value) != 0;
+#endif
         }
 
         static bool AllSet(const Int16CompFlag &v)
         {
+#if defined(CVTT_USE_SSE41)
+            return _mm_test_all_ones(v.m_value) != 0;
+#else
             return _mm_movemask_epi8(v.m_value) == 0xffff;
+#endif
         }
 
         static bool AnySet(const FloatCompFlag &v)
@@ -1476,11 +4364,33 @@ namespace cvtt
             chOut = inputBlocks[0].m_pixels[pxOffset][channel];
         }
 
+        // Reads one pixel of each block into all four channels
+        static void ConvertLDRInputs(const PixelBlockU8* inputBlocks, int pxOffset, int32_t channels[4])
+        {
+            for (int ch = 0; ch < 4; ch++)
+                channels[ch] = inputBlocks[0].m_pixels[pxOffset][ch];
+        }
+
+        template<class TBlock>
+        static void ConvertLDROutputs(TBlock* outputBlocks, int pxOffset, const int32_t channels[4])
+        {
+            uint8_t values[4];
+            for (int ch = 0; ch < 4; ch++)
+                values[ch] = static_cast<uint8_t>(channels[ch]);
+
+            memcpy(outputBlocks[0].m_pixels[pxOffset], values, 4);
+        }
+
         static void ConvertHDRInputs(const PixelBlockF16* inputBlocks, int pxOffset, int channel, int32_t& chOut)
         {
             chOut = inputBlocks[0].m_pixels[pxOffset][channel];
         }
 
+        static void ConvertHDROutputs(PixelBlockF16* outputBlocks, int pxOffset, int channel, const int32_t &ch)
+        {
+            outputBlocks[0].m_pixels[pxOffset][channel] = static_cast<int16_t>(ch);
+        }
+
         static float MakeFloat(float v)
         {
             return v;
@@ -1521,6 +4431,31 @@ namespace cvtt
             return v;
         }
 
+        static int32_t LoadUInt16(const uint16_t *values)
+        {
+            return values[0];
+        }
+
+        static int32_t LoadUInt15(const uint16_t *values)
+        {
+            return values[0];
+        }
+
+        static int32_t LoadSInt16(const int16_t *values)
+        {
+            return values[0];
+        }
+
+        static bool LoadBoolInt16(const bool *values)
+        {
+            return values[0];
+        }
+
+        static void StoreUInt16(uint16_t *values, int32_t v)
+        {
+            values[0] = static_cast<uint16_t>(v);
+        }
+
         static int32_t Extract(int32_t v, int offset)
         {
             UNREFERENCED_PARAMETER(offset);
@@ -1811,6 +4746,8 @@ namespace cvtt
     };
 
 #endif
+
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
@@ -0,0 +1,230 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels_Surface.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <algorithm>
+
+namespace cvtt
+{
+    namespace PersistentBlockCacheInternal
+    {
+        static const char kMagic[4] = { 'C', 'V', 'B', 'C' };
+
+        // Entries are grouped into buckets, and a block can be stored in any entry of its bucket
+        static const uint32_t kBucketSize = 4;
+
+        class KeyHasher
+        {
+        public:
+            KeyHasher()
+                : m_hash(0xcbf29ce484222325ull)
+            {
+            }
+
+            void AddBytes(const void *data, size_t size)
+            {
+                const uint8_t *bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; i++)
+                    m_hash = (m_hash ^ bytes[i]) * 0x100000001b3ull;
+            }
+
+            void AddUInt32(uint32_t value)
+            {
+                uint8_t bytes[4];
+                for (int i = 0; i < 4; i++)
+                    bytes[i] = static_cast<uint8_t>(value >> (i * 8));
+                AddBytes(bytes, 4);
+            }
+
+            void AddFloat(float value)
+            {
+                uint32_t bits;
+                memcpy(&bits, &value, 4);
+                AddUInt32(bits);
+            }
+
+            uint64_t GetHash() const
+            {
+                return m_hash;
+            }
+
+        private:
+            uint64_t m_hash;
+        };
+
+        static PersistentBlockCache::Entry *GetBucket(PersistentBlockCache &cache, uint64_t configKey, uint32_t blockHash)
+        {
+            const uint32_t bucketHash = blockHash ^ static_cast<uint32_t>(configKey) ^ static_cast<uint32_t>(configKey >> 32);
+            return cache.GetEntries() + (bucketHash % (cache.m_numEntries / kBucketSize)) * kBucketSize;
+        }
+
+        static bool IsMatch(const PersistentBlockCache::Entry &entry, uint64_t configKey, uint32_t blockHash, const void *sourceBlock, size_t sourceBlockSize)
+        {
+            return entry.m_isValid && entry.m_configKey == configKey && entry.m_blockHash == blockHash && !memcmp(entry.m_sourceBlock, sourceBlock, sourceBlockSize);
+        }
+    }
+}
+
+void cvtt::SurfaceEncoding::InitPersistentCacheParams(EncodeParams &params, std::mutex *persistentCacheMutex)
+{
+    const Options &options = *params.m_options;
+
+    params.m_persistentCache = NULL;
+    params.m_persistentCacheKey = 0;
+    params.m_persistentCacheMutex = NULL;
+
+    // Blocks served from the cache wouldn't be counted
+    if (options.blockCache == NULL || options.stats != NULL)
+        return;
+
+    // Everything that affects the encoded output, except for the source pixels
+    PersistentBlockCacheInternal::KeyHasher hasher;
+    hasher.AddUInt32(PersistentBlockCache::kVersion);
+    hasher.AddUInt32(params.m_format);
+    hasher.AddUInt32(options.flags);
+    hasher.AddFloat(options.threshold);
+    hasher.AddFloat(options.redWeight);
+    hasher.AddFloat(options.greenWeight);
+    hasher.AddFloat(options.blueWeight);
+    hasher.AddFloat(options.alphaWeight);
+    hasher.AddUInt32(static_cast<uint32_t>(options.refineRoundsBC7));
+    hasher.AddUInt32(static_cast<uint32_t>(options.refineRoundsBC6H));
+    hasher.AddUInt32(static_cast<uint32_t>(options.refineRoundsIIC));
+    hasher.AddUInt32(static_cast<uint32_t>(options.refineRoundsS3TC));
+    hasher.AddUInt32(static_cast<uint32_t>(options.seedPoints));
+    hasher.AddFloat(options.pruneToleranceBC7);
+
+    if (params.m_format == SurfaceFormat_BC7)
+    {
+        uint8_t serializedPlan[BC7EncodingPlan::kSerializedSize];
+        Kernels::SerializeBC7EncodingPlan(*params.m_encodingPlan, serializedPlan);
+        hasher.AddBytes(serializedPlan, sizeof(serializedPlan));
+    }
+
+    params.m_persistentCache = options.blockCache;
+    params.m_persistentCacheKey = hasher.GetHash();
+    params.m_persistentCacheMutex = persistentCacheMutex;
+}
+
+bool cvtt::SurfaceEncoding::LookupPersistentBlock(const EncodeParams &params, uint32_t blockHash, const void *sourceBlock, size_t sourceBlockSize, uint8_t *outputBlock, size_t outputBlockSize)
+{
+    assert(params.m_persistentCache != NULL);
+    assert(sourceBlockSize <= sizeof(PersistentBlockCache::Entry::m_sourceBlock));
+    assert(outputBlockSize <= sizeof(PersistentBlockCache::Entry::m_outputBlock));
+
+    std::unique_lock<std::mutex> lock;
+    if (params.m_persistentCacheMutex)
+        lock = std::unique_lock<std::mutex>(*params.m_persistentCacheMutex);
+
+    const PersistentBlockCache::Entry *bucket = PersistentBlockCacheInternal::GetBucket(*params.m_persistentCache, params.m_persistentCacheKey, blockHash);
+
+    for (uint32_t i = 0; i < PersistentBlockCacheInternal::kBucketSize; i++)
+    {
+        if (PersistentBlockCacheInternal::IsMatch(bucket[i], params.m_persistentCacheKey, blockHash, sourceBlock, sourceBlockSize))
+        {
+            memcpy(outputBlock, bucket[i].m_outputBlock, outputBlockSize);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void cvtt::SurfaceEncoding::StorePersistentBlock(const EncodeParams &params, uint32_t blockHash, const void *sourceBlock, size_t sourceBlockSize, const uint8_t *outputBlock, size_t outputBlockSize)
+{
+    assert(params.m_persistentCache != NULL);
+    assert(sourceBlockSize <= sizeof(PersistentBlockCache::Entry::m_sourceBlock));
+    assert(outputBlockSize <= sizeof(PersistentBlockCache::Entry::m_outputBlock));
+
+    std::unique_lock<std::mutex> lock;
+    if (params.m_persistentCacheMutex)
+        lock = std::unique_lock<std::mutex>(*params.m_persistentCacheMutex);
+
+    PersistentBlockCache::Entry *bucket = PersistentBlockCacheInternal::GetBucket(*params.m_persistentCache, params.m_persistentCacheKey, blockHash);
+
+    // Use an empty entry or one that already holds this block if there is one, otherwise replace a pseudo-random entry
+    uint32_t entryIndex = (blockHash >> 24) % PersistentBlockCacheInternal::kBucketSize;
+    for (uint32_t i = 0; i < PersistentBlockCacheInternal::kBucketSize; i++)
+    {
+        if (!bucket[i].m_isValid || PersistentBlockCacheInternal::IsMatch(bucket[i], params.m_persistentCacheKey, blockHash, sourceBlock, sourceBlockSize))
+        {
+            entryIndex = i;
+            break;
+        }
+    }
+
+    PersistentBlockCache::Entry &entry = bucket[entryIndex];
+    entry.m_configKey = params.m_persistentCacheKey;
+    entry.m_blockHash = blockHash;
+    entry.m_isValid = 1;
+    memset(entry.m_sourceBlock, 0, sizeof(entry.m_sourceBlock));
+    memcpy(entry.m_sourceBlock, sourceBlock, sourceBlockSize);
+    memset(entry.m_outputBlock, 0, sizeof(entry.m_outputBlock));
+    memcpy(entry.m_outputBlock, outputBlock, outputBlockSize);
+}
+
+size_t cvtt::Kernels::GetPersistentBlockCacheSize(uint32_t numEntries)
+{
+    return sizeof(PersistentBlockCache) + static_cast<size_t>(numEntries) * sizeof(PersistentBlockCache::Entry);
+}
+
+cvtt::PersistentBlockCache *cvtt::Kernels::InitPersistentBlockCache(void *storage, size_t size)
+{
+    assert((reinterpret_cast<size_t>(storage) & 7) == 0);
+
+    const uint32_t bucketSize = PersistentBlockCacheInternal::kBucketSize;
+
+    if (storage == NULL || size < GetPersistentBlockCacheSize(bucketSize))
+        return NULL;
+
+    size_t numEntries = (size - sizeof(PersistentBlockCache)) / sizeof(PersistentBlockCache::Entry);
+    numEntries = std::min<size_t>(numEntries, 0xffffffffu) / bucketSize * bucketSize;
+
+    PersistentBlockCache *cache = static_cast<PersistentBlockCache*>(storage);
+
+    const bool isSameLayout = !memcmp(cache->m_magic, PersistentBlockCacheInternal::kMagic, 4)
+        && cache->m_version == PersistentBlockCache::kVersion
+        && cache->m_entrySize == sizeof(PersistentBlockCache::Entry)
+        && cache->m_numEntries == numEntries;
+
+    if (!isSameLayout)
+    {
+        memset(storage, 0, GetPersistentBlockCacheSize(static_cast<uint32_t>(numEntries)));
+        memcpy(cache->m_magic, PersistentBlockCacheInternal::kMagic, 4);
+        cache->m_version = PersistentBlockCache::kVersion;
+        cache->m_entrySize = sizeof(PersistentBlockCache::Entry);
+        cache->m_numEntries = static_cast<uint32_t>(numEntries);
+    }
+
+    return cache;
+}
+
+#endif
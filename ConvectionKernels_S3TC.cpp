@@ -38,11 +38,13 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 
 #include "ConvectionKernels_AggregatedError.h"
 #include "ConvectionKernels_BCCommon.h"
+#include "ConvectionKernels_ClusterFitter.h"
 #include "ConvectionKernels_EndpointRefiner.h"
 #include "ConvectionKernels_EndpointSelector.h"
 #include "ConvectionKernels_IndexSelector.h"
 #include "ConvectionKernels_UnfinishedEndpoints.h"
 #include "ConvectionKernels_S3TC_SingleColor.h"
+#include "ConvectionKernels_Util.h"
 
 void cvtt::Internal::S3TCComputer::Init(MFloat& error)
 {
@@ -257,45 +259,13 @@ void cvtt::Internal::S3TCComputer::TestEndpoints(uint32_t flags, const MUInt15 p
     }
 }
 
-void cvtt::Internal::S3TCComputer::TestCounts(uint32_t flags, const int *counts, int nCounts, const MUInt15 &numElements, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const MFloat preWeightedPixels[16][4], bool alphaTest,
-    const MFloat floatSortedInputs[16][4], const MFloat preWeightedFloatSortedInputs[16][4], const float *channelWeights, MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange,
-    const ParallelMath::RoundTowardNearestForScope* rtn)
+void cvtt::Internal::S3TCComputer::TestCounts(uint32_t flags, const int *counts, int nCounts, const ClusterFitter<3> &clusterFitter, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const MFloat preWeightedPixels[16][4], bool alphaTest,
+    const float *channelWeights, MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange, const ParallelMath::RoundTowardNearestForScope* rtn)
 {
     UNREFERENCED_PARAMETER(alphaTest);
-    UNREFERENCED_PARAMETER(flags);
-
-    EndpointRefiner<3> refiner;
-
-    refiner.Init(nCounts, channelWeights);
-
-    bool escape = false;
-    int e = 0;
-    for (int i = 0; i < nCounts; i++)
-    {
-        for (int n = 0; n < counts[i]; n++)
-        {
-            ParallelMath::Int16CompFlag valid = ParallelMath::Less(ParallelMath::MakeUInt15(static_cast<uint16_t>(n)), numElements);
-            if (!ParallelMath::AnySet(valid))
-            {
-                escape = true;
-                break;
-            }
-
-            if (ParallelMath::AllSet(valid))
-                refiner.ContributeUnweightedPW(preWeightedFloatSortedInputs[e++], ParallelMath::MakeUInt15(static_cast<uint16_t>(i)));
-            else
-            {
-                MFloat weight = ParallelMath::Select(ParallelMath::Int16FlagToFloat(valid), ParallelMath::MakeFloat(1.0f), ParallelMath::MakeFloat(0.0f));
-                refiner.ContributePW(preWeightedFloatSortedInputs[e++], ParallelMath::MakeUInt15(static_cast<uint16_t>(i)), weight);
-            }
-        }
-
-        if (escape)
-            break;
-    }
 
     MUInt15 endPoints[2][3];
-    refiner.GetRefinedEndpointsLDR(endPoints, rtn);
+    clusterFitter.GetRefinedEndpointsLDR(counts, nCounts, channelWeights, endPoints, rtn);
 
     TestEndpoints(flags, pixels, floatPixels, preWeightedPixels, endPoints, nCounts, channelWeights, bestError, bestEndpoints, bestIndexes, bestRange, NULL, rtn);
 }
@@ -340,8 +310,15 @@ void cvtt::Internal::S3TCComputer::PackExplicitAlpha(uint32_t flags, const Pixel
     }
 }
 
-void cvtt::Internal::S3TCComputer::PackInterpolatedAlpha(uint32_t flags, const PixelBlockU8* inputs, int inputChannel, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds)
+template<int TNumChannels>
+void cvtt::Internal::S3TCComputer::PackInterpolatedAlphaChannels(uint32_t flags, const PixelBlockU8* inputs, const int inputChannels[TNumChannels], uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds)
 {
+    if (flags & Flags::S3TC_RealTime)
+    {
+        PackInterpolatedAlphaRealTime(inputs, inputChannels, TNumChannels, packedBlocks, packedBlockStride, isSigned);
+        return;
+    }
+
     if (maxTweakRounds < 1)
         maxTweakRounds = 1;
 
@@ -352,60 +329,76 @@ void cvtt::Internal::S3TCComputer::PackInterpolatedAlpha(uint32_t flags, const P
 
     float oneWeight[1] = { 1.0f };
 
-    MUInt15 pixels[16];
-    MFloat floatPixels[16];
+    MUInt15 pixels[TNumChannels][16];
+    MFloat floatPixels[TNumChannels][16];
 
     MUInt15 highTerminal = isSigned ? ParallelMath::MakeUInt15(254) : ParallelMath::MakeUInt15(255);
     MUInt15 highTerminalMinusOne = highTerminal - ParallelMath::MakeUInt15(1);
 
     for (int px = 0; px < 16; px++)
     {
-        ParallelMath::ConvertLDRInputs(inputs, px, inputChannel, pixels[px]);
+        for (int ch = 0; ch < TNumChannels; ch++)
+        {
+            ParallelMath::ConvertLDRInputs(inputs, px, inputChannels[ch], pixels[ch][px]);
 
-        if (isSigned)
-            pixels[px] = ParallelMath::Min(pixels[px], highTerminal);
+            if (isSigned)
+                pixels[ch][px] = ParallelMath::Min(pixels[ch][px], highTerminal);
 
-        floatPixels[px] = ParallelMath::ToFloat(pixels[px]);
+            floatPixels[ch][px] = ParallelMath::ToFloat(pixels[ch][px]);
+        }
     }
 
-    MUInt15 sortedPixels[16];
-    for (int px = 0; px < 16; px++)
-        sortedPixels[px] = pixels[px];
+    MUInt15 sortedPixels[TNumChannels][16];
+    for (int ch = 0; ch < TNumChannels; ch++)
+        for (int px = 0; px < 16; px++)
+            sortedPixels[ch][px] = pixels[ch][px];
 
     for (int sortEnd = 15; sortEnd > 0; sortEnd--)
     {
         for (int sortOffset = 0; sortOffset < sortEnd; sortOffset++)
         {
-            MUInt15 a = sortedPixels[sortOffset];
-            MUInt15 b = sortedPixels[sortOffset + 1];
+            for (int ch = 0; ch < TNumChannels; ch++)
+            {
+                MUInt15 a = sortedPixels[ch][sortOffset];
+                MUInt15 b = sortedPixels[ch][sortOffset + 1];
 
-            sortedPixels[sortOffset] = ParallelMath::Min(a, b);
-            sortedPixels[sortOffset + 1] = ParallelMath::Max(a, b);
+                sortedPixels[ch][sortOffset] = ParallelMath::Min(a, b);
+                sortedPixels[ch][sortOffset + 1] = ParallelMath::Max(a, b);
+            }
         }
     }
 
     MUInt15 zero = ParallelMath::MakeUInt15(0);
     MUInt15 one = ParallelMath::MakeUInt15(1);
 
-    MUInt15 bestIsFullRange = zero;
-    MFloat bestError = ParallelMath::MakeFloat(FLT_MAX);
-    MUInt15 bestEP[2] = { zero, zero };
-    MUInt15 bestIndexes[16] = {
-        zero, zero, zero, zero,
-        zero, zero, zero, zero,
-        zero, zero, zero, zero,
-        zero, zero, zero, zero
-    };
+    MUInt15 bestIsFullRange[TNumChannels];
+    MFloat bestError[TNumChannels];
+    MUInt15 bestEP[TNumChannels][2];
+    MUInt15 bestIndexes[TNumChannels][16];
+
+    for (int ch = 0; ch < TNumChannels; ch++)
+    {
+        bestIsFullRange[ch] = zero;
+        bestError[ch] = ParallelMath::MakeFloat(FLT_MAX);
+        bestEP[ch][0] = bestEP[ch][1] = zero;
+        for (int px = 0; px < 16; px++)
+            bestIndexes[ch][px] = zero;
+    }
 
     // Full-precision
     {
-        MUInt15 minEP = sortedPixels[0];
-        MUInt15 maxEP = sortedPixels[15];
+        UnfinishedEndpoints<1> ufep[TNumChannels];
 
-        MFloat base[1] = { ParallelMath::ToFloat(minEP) };
-        MFloat offset[1] = { ParallelMath::ToFloat(maxEP - minEP) };
+        for (int ch = 0; ch < TNumChannels; ch++)
+        {
+            MUInt15 minEP = sortedPixels[ch][0];
+            MUInt15 maxEP = sortedPixels[ch][15];
 
-        UnfinishedEndpoints<1> ufep = UnfinishedEndpoints<1>(base, offset);
+            MFloat base[1] = { ParallelMath::ToFloat(minEP) };
+            MFloat offset[1] = { ParallelMath::ToFloat(maxEP - minEP) };
+
+            ufep[ch] = UnfinishedEndpoints<1>(base, offset);
+        }
 
         int numTweakRounds = BCCommon::TweakRoundsForRange(8);
         if (numTweakRounds > maxTweakRounds)
@@ -413,235 +406,308 @@ void cvtt::Internal::S3TCComputer::PackInterpolatedAlpha(uint32_t flags, const P
 
         for (int tweak = 0; tweak < numTweakRounds; tweak++)
         {
-            MUInt15 ep[2][1];
+            MUInt15 ep[TNumChannels][2][1];
 
-            ufep.FinishLDR(tweak, 8, ep[0], ep[1]);
+            for (int ch = 0; ch < TNumChannels; ch++)
+                ufep[ch].FinishLDR(tweak, 8, ep[ch][0], ep[ch][1]);
 
             for (int refinePass = 0; refinePass < numRefineRounds; refinePass++)
             {
-                EndpointRefiner<1> refiner;
-                refiner.Init(8, oneWeight);
+                EndpointRefiner<1> refiner[TNumChannels];
+                IndexSelector<1> indexSelector[TNumChannels];
+                AggregatedError<1> aggError[TNumChannels];
+
+                for (int ch = 0; ch < TNumChannels; ch++)
+                {
+                    refiner[ch].Init(8, oneWeight);
 
-                if (isSigned)
-                    for (int epi = 0; epi < 2; epi++)
-                        ep[epi][0] = ParallelMath::Min(ep[epi][0], highTerminal);
+                    if (isSigned)
+                        for (int epi = 0; epi < 2; epi++)
+                            ep[ch][epi][0] = ParallelMath::Min(ep[ch][epi][0], highTerminal);
 
-                IndexSelector<1> indexSelector;
-                indexSelector.Init<false>(oneWeight, ep, 8);
+                    indexSelector[ch].template Init<false>(oneWeight, ep[ch], 8);
+                }
 
-                MUInt15 indexes[16];
+                MUInt15 indexes[TNumChannels][16];
 
-                AggregatedError<1> aggError;
                 for (int px = 0; px < 16; px++)
                 {
-                    MUInt15 index = indexSelector.SelectIndexLDR(&floatPixels[px], &rtn);
+                    for (int ch = 0; ch < TNumChannels; ch++)
+                    {
+                        MUInt15 index = indexSelector[ch].SelectIndexLDR(&floatPixels[ch][px], &rtn);
 
-                    MUInt15 reconstructedPixel;
+                        MUInt15 reconstructedPixel;
 
-                    indexSelector.ReconstructLDRPrecise(index, &reconstructedPixel);
-                    BCCommon::ComputeErrorLDR<1>(flags, &reconstructedPixel, &pixels[px], aggError);
+                        indexSelector[ch].ReconstructLDRPrecise(index, &reconstructedPixel);
+                        BCCommon::ComputeErrorLDR<1>(flags, &reconstructedPixel, &pixels[ch][px], aggError[ch]);
 
-                    if (refinePass != numRefineRounds - 1)
-                        refiner.ContributeUnweightedPW(&floatPixels[px], index);
+                        if (refinePass != numRefineRounds - 1)
+                            refiner[ch].ContributeUnweightedPW(&floatPixels[ch][px], index);
 
-                    indexes[px] = index;
+                        indexes[ch][px] = index;
+                    }
                 }
-                MFloat error = aggError.Finalize(flags | Flags::Uniform, oneWeight);
-
-                ParallelMath::FloatCompFlag errorBetter = ParallelMath::Less(error, bestError);
-                ParallelMath::Int16CompFlag errorBetter16 = ParallelMath::FloatFlagToInt16(errorBetter);
 
-                if (ParallelMath::AnySet(errorBetter16))
+                for (int ch = 0; ch < TNumChannels; ch++)
                 {
-                    bestError = ParallelMath::Min(error, bestError);
-                    ParallelMath::ConditionalSet(bestIsFullRange, errorBetter16, one);
-                    for (int px = 0; px < 16; px++)
-                        ParallelMath::ConditionalSet(bestIndexes[px], errorBetter16, indexes[px]);
+                    MFloat error = aggError[ch].Finalize(flags | Flags::Uniform, oneWeight);
 
-                    for (int epi = 0; epi < 2; epi++)
-                        ParallelMath::ConditionalSet(bestEP[epi], errorBetter16, ep[epi][0]);
-                }
+                    ParallelMath::FloatCompFlag errorBetter = ParallelMath::Less(error, bestError[ch]);
+                    ParallelMath::Int16CompFlag errorBetter16 = ParallelMath::FloatFlagToInt16(errorBetter);
+
+                    if (ParallelMath::AnySet(errorBetter16))
+                    {
+                        bestError[ch] = ParallelMath::Min(error, bestError[ch]);
+                        ParallelMath::ConditionalSet(bestIsFullRange[ch], errorBetter16, one);
+                        for (int px = 0; px < 16; px++)
+                            ParallelMath::ConditionalSet(bestIndexes[ch][px], errorBetter16, indexes[ch][px]);
+
+                        for (int epi = 0; epi < 2; epi++)
+                            ParallelMath::ConditionalSet(bestEP[ch][epi], errorBetter16, ep[ch][epi][0]);
+                    }
 
-                if (refinePass != numRefineRounds - 1)
-                    refiner.GetRefinedEndpointsLDR(ep, &rtn);
+                    if (refinePass != numRefineRounds - 1)
+                        refiner[ch].GetRefinedEndpointsLDR(ep[ch], &rtn);
+                }
             }
         }
     }
 
     // Reduced precision with special endpoints
     {
-        MUInt15 bestHeuristicMin = sortedPixels[0];
-        MUInt15 bestHeuristicMax = sortedPixels[15];
-
-        ParallelMath::Int16CompFlag canTryClipping;
-
-        // In reduced precision, we want try putting endpoints at the reserved indexes at the ends.
-        // The heuristic we use is to assign indexes to the end as long as they aren't off by more than half of the index range.
-        // This will usually not find anything, but it's cheap to check.
+        MUInt15 bestHeuristicMin[TNumChannels];
+        MUInt15 bestHeuristicMax[TNumChannels];
 
+        for (int ch = 0; ch < TNumChannels; ch++)
         {
-            MUInt15 largestPossibleRange = bestHeuristicMax - bestHeuristicMin; // Max: 255
-            MUInt15 lowestPossibleClearance = ParallelMath::Min(bestHeuristicMin, static_cast<MUInt15>(highTerminal - bestHeuristicMax));
+            const MUInt15 *sorted = sortedPixels[ch];
 
-            MUInt15 lowestPossibleClearanceTimes10 = (lowestPossibleClearance << 2) + (lowestPossibleClearance << 4);
-            canTryClipping = ParallelMath::LessOrEqual(lowestPossibleClearanceTimes10, largestPossibleRange);
-        }
+            bestHeuristicMin[ch] = sorted[0];
+            bestHeuristicMax[ch] = sorted[15];
 
-        if (ParallelMath::AnySet(canTryClipping))
-        {
-            MUInt15 lowClearances[16];
-            MUInt15 highClearances[16];
-            MUInt15 bestSkipCount = ParallelMath::MakeUInt15(0);
+            ParallelMath::Int16CompFlag canTryClipping;
 
-            lowClearances[0] = highClearances[0] = ParallelMath::MakeUInt15(0);
+            // In reduced precision, we want try putting endpoints at the reserved indexes at the ends.
+            // The heuristic we use is to assign indexes to the end as long as they aren't off by more than half of the index range.
+            // This will usually not find anything, but it's cheap to check.
 
-            for (int px = 1; px < 16; px++)
             {
-                lowClearances[px] = sortedPixels[px - 1];
-                highClearances[px] = highTerminal - sortedPixels[16 - px];
+                MUInt15 largestPossibleRange = bestHeuristicMax[ch] - bestHeuristicMin[ch]; // Max: 255
+                MUInt15 lowestPossibleClearance = ParallelMath::Min(bestHeuristicMin[ch], static_cast<MUInt15>(highTerminal - bestHeuristicMax[ch]));
+
+                MUInt15 lowestPossibleClearanceTimes10 = (lowestPossibleClearance << 2) + (lowestPossibleClearance << 4);
+                canTryClipping = ParallelMath::LessOrEqual(lowestPossibleClearanceTimes10, largestPossibleRange);
             }
 
-            for (uint16_t firstIndex = 0; firstIndex < 16; firstIndex++)
+            if (ParallelMath::AnySet(canTryClipping))
             {
-                uint16_t numSkippedLow = firstIndex;
+                MUInt15 lowClearances[16];
+                MUInt15 highClearances[16];
+                MUInt15 bestSkipCount = ParallelMath::MakeUInt15(0);
 
-                MUInt15 lowClearance = lowClearances[firstIndex];
+                lowClearances[0] = highClearances[0] = ParallelMath::MakeUInt15(0);
 
-                for (uint16_t lastIndex = firstIndex; lastIndex < 16; lastIndex++)
+                for (int px = 1; px < 16; px++)
                 {
-                    uint16_t numSkippedHigh = 15 - lastIndex;
-                    uint16_t numSkipped = numSkippedLow + numSkippedHigh;
+                    lowClearances[px] = sorted[px - 1];
+                    highClearances[px] = highTerminal - sorted[16 - px];
+                }
 
-                    MUInt15 numSkippedV = ParallelMath::MakeUInt15(numSkipped);
+                for (uint16_t firstIndex = 0; firstIndex < 16; firstIndex++)
+                {
+                    uint16_t numSkippedLow = firstIndex;
 
-                    ParallelMath::Int16CompFlag areMoreSkipped = ParallelMath::Less(bestSkipCount, numSkippedV);
+                    MUInt15 lowClearance = lowClearances[firstIndex];
 
-                    if (!ParallelMath::AnySet(areMoreSkipped))
-                        continue;
+                    for (uint16_t lastIndex = firstIndex; lastIndex < 16; lastIndex++)
+                    {
+                        uint16_t numSkippedHigh = 15 - lastIndex;
+                        uint16_t numSkipped = numSkippedLow + numSkippedHigh;
+
+                        MUInt15 numSkippedV = ParallelMath::MakeUInt15(numSkipped);
+
+                        ParallelMath::Int16CompFlag areMoreSkipped = ParallelMath::Less(bestSkipCount, numSkippedV);
 
-                    MUInt15 clearance = ParallelMath::Max(highClearances[numSkippedHigh], lowClearance);
-                    MUInt15 clearanceTimes10 = (clearance << 2) + (clearance << 4);
+                        if (!ParallelMath::AnySet(areMoreSkipped))
+                            continue;
 
-                    MUInt15 range = sortedPixels[lastIndex] - sortedPixels[firstIndex];
+                        MUInt15 clearance = ParallelMath::Max(highClearances[numSkippedHigh], lowClearance);
+                        MUInt15 clearanceTimes10 = (clearance << 2) + (clearance << 4);
 
-                    ParallelMath::Int16CompFlag isBetter = (areMoreSkipped & ParallelMath::LessOrEqual(clearanceTimes10, range));
-                    ParallelMath::ConditionalSet(bestHeuristicMin, isBetter, sortedPixels[firstIndex]);
-                    ParallelMath::ConditionalSet(bestHeuristicMax, isBetter, sortedPixels[lastIndex]);
+                        MUInt15 range = sorted[lastIndex] - sorted[firstIndex];
+
+                        ParallelMath::Int16CompFlag isBetter = (areMoreSkipped & ParallelMath::LessOrEqual(clearanceTimes10, range));
+                        ParallelMath::ConditionalSet(bestHeuristicMin[ch], isBetter, sorted[firstIndex]);
+                        ParallelMath::ConditionalSet(bestHeuristicMax[ch], isBetter, sorted[lastIndex]);
+                    }
                 }
             }
         }
 
-        MUInt15 bestSimpleMin = one;
-        MUInt15 bestSimpleMax = highTerminalMinusOne;
+        MUInt15 minEPs[TNumChannels][2];
+        MUInt15 maxEPs[TNumChannels][2];
+        int minEPRange[TNumChannels];
+        int maxEPRange[TNumChannels];
 
-        for (int px = 0; px < 16; px++)
+        for (int ch = 0; ch < TNumChannels; ch++)
         {
-            ParallelMath::ConditionalSet(bestSimpleMin, ParallelMath::Less(zero, sortedPixels[15 - px]), sortedPixels[15 - px]);
-            ParallelMath::ConditionalSet(bestSimpleMax, ParallelMath::Less(sortedPixels[px], highTerminal), sortedPixels[px]);
-        }
+            MUInt15 bestSimpleMin = one;
+            MUInt15 bestSimpleMax = highTerminalMinusOne;
+
+            for (int px = 0; px < 16; px++)
+            {
+                ParallelMath::ConditionalSet(bestSimpleMin, ParallelMath::Less(zero, sortedPixels[ch][15 - px]), sortedPixels[ch][15 - px]);
+                ParallelMath::ConditionalSet(bestSimpleMax, ParallelMath::Less(sortedPixels[ch][px], highTerminal), sortedPixels[ch][px]);
+            }
+
+            minEPs[ch][0] = bestSimpleMin;
+            minEPs[ch][1] = bestHeuristicMin[ch];
+            maxEPs[ch][0] = bestSimpleMax;
+            maxEPs[ch][1] = bestHeuristicMax[ch];
 
-        MUInt15 minEPs[2] = { bestSimpleMin, bestHeuristicMin };
-        MUInt15 maxEPs[2] = { bestSimpleMax, bestHeuristicMax };
+            minEPRange[ch] = 2;
+            if (ParallelMath::AllSet(ParallelMath::Equal(minEPs[ch][0], minEPs[ch][1])))
+                minEPRange[ch] = 1;
 
-        int minEPRange = 2;
-        if (ParallelMath::AllSet(ParallelMath::Equal(minEPs[0], minEPs[1])))
-            minEPRange = 1;
+            maxEPRange[ch] = 2;
+            if (ParallelMath::AllSet(ParallelMath::Equal(maxEPs[ch][0], maxEPs[ch][1])))
+                maxEPRange[ch] = 1;
+        }
 
-        int maxEPRange = 2;
-        if (ParallelMath::AllSet(ParallelMath::Equal(maxEPs[0], maxEPs[1])))
-            maxEPRange = 1;
+        int numTweakRounds = BCCommon::TweakRoundsForRange(6);
+        if (numTweakRounds > maxTweakRounds)
+            numTweakRounds = maxTweakRounds;
 
-        for (int minEPIndex = 0; minEPIndex < minEPRange; minEPIndex++)
+        for (int minEPIndex = 0; minEPIndex < 2; minEPIndex++)
         {
-            for (int maxEPIndex = 0; maxEPIndex < maxEPRange; maxEPIndex++)
+            for (int maxEPIndex = 0; maxEPIndex < 2; maxEPIndex++)
             {
-                MFloat base[1] = { ParallelMath::ToFloat(minEPs[minEPIndex]) };
-                MFloat offset[1] = { ParallelMath::ToFloat(maxEPs[maxEPIndex] - minEPs[minEPIndex]) };
+                // Channels whose candidate endpoints are all duplicates of one already tried sit out this pass
+                bool channelActive[TNumChannels];
+                int numActiveChannels = 0;
 
-                UnfinishedEndpoints<1> ufep = UnfinishedEndpoints<1>(base, offset);
+                UnfinishedEndpoints<1> ufep[TNumChannels];
 
-                int numTweakRounds = BCCommon::TweakRoundsForRange(6);
-                if (numTweakRounds > maxTweakRounds)
-                    numTweakRounds = maxTweakRounds;
+                for (int ch = 0; ch < TNumChannels; ch++)
+                {
+                    channelActive[ch] = (minEPIndex < minEPRange[ch] && maxEPIndex < maxEPRange[ch]);
+                    if (!channelActive[ch])
+                        continue;
+
+                    numActiveChannels++;
+
+                    MFloat base[1] = { ParallelMath::ToFloat(minEPs[ch][minEPIndex]) };
+                    MFloat offset[1] = { ParallelMath::ToFloat(maxEPs[ch][maxEPIndex] - minEPs[ch][minEPIndex]) };
+
+                    ufep[ch] = UnfinishedEndpoints<1>(base, offset);
+                }
+
+                if (numActiveChannels == 0)
+                    continue;
 
                 for (int tweak = 0; tweak < numTweakRounds; tweak++)
                 {
-                    MUInt15 ep[2][1];
+                    MUInt15 ep[TNumChannels][2][1];
 
-                    ufep.FinishLDR(tweak, 8, ep[0], ep[1]);
+                    for (int ch = 0; ch < TNumChannels; ch++)
+                        if (channelActive[ch])
+                            ufep[ch].FinishLDR(tweak, 8, ep[ch][0], ep[ch][1]);
 
                     for (int refinePass = 0; refinePass < numRefineRounds; refinePass++)
                     {
-                        EndpointRefiner<1> refiner;
-                        refiner.Init(6, oneWeight);
+                        EndpointRefiner<1> refiner[TNumChannels];
+                        IndexSelector<1> indexSelector[TNumChannels];
+                        MUInt15 indexes[TNumChannels][16];
+                        MFloat error[TNumChannels];
+
+                        for (int ch = 0; ch < TNumChannels; ch++)
+                        {
+                            if (!channelActive[ch])
+                                continue;
+
+                            refiner[ch].Init(6, oneWeight);
 
-                        if (isSigned)
-                            for (int epi = 0; epi < 2; epi++)
-                                ep[epi][0] = ParallelMath::Min(ep[epi][0], highTerminal);
+                            if (isSigned)
+                                for (int epi = 0; epi < 2; epi++)
+                                    ep[ch][epi][0] = ParallelMath::Min(ep[ch][epi][0], highTerminal);
 
-                        IndexSelector<1> indexSelector;
-                        indexSelector.Init<false>(oneWeight, ep, 6);
+                            indexSelector[ch].template Init<false>(oneWeight, ep[ch], 6);
 
-                        MUInt15 indexes[16];
-                        MFloat error = ParallelMath::MakeFloatZero();
+                            error[ch] = ParallelMath::MakeFloatZero();
+                        }
 
                         for (int px = 0; px < 16; px++)
                         {
-                            MUInt15 selectedIndex = indexSelector.SelectIndexLDR(&floatPixels[px], &rtn);
+                            for (int ch = 0; ch < TNumChannels; ch++)
+                            {
+                                if (!channelActive[ch])
+                                    continue;
 
-                            MUInt15 reconstructedPixel;
+                                const MFloat *floatPixel = &floatPixels[ch][px];
+                                const MUInt15 *pixel = &pixels[ch][px];
 
-                            indexSelector.ReconstructLDRPrecise(selectedIndex, &reconstructedPixel);
+                                MUInt15 selectedIndex = indexSelector[ch].SelectIndexLDR(floatPixel, &rtn);
 
-                            MFloat zeroError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &zero, &pixels[px], 1, oneWeight);
-                            MFloat highTerminalError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &highTerminal, &pixels[px], 1, oneWeight);
-                            MFloat selectedIndexError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &reconstructedPixel, &pixels[px], 1, oneWeight);
+                                MUInt15 reconstructedPixel;
 
-                            MFloat bestPixelError = zeroError;
-                            MUInt15 index = ParallelMath::MakeUInt15(6);
+                                indexSelector[ch].ReconstructLDRPrecise(selectedIndex, &reconstructedPixel);
 
-                            ParallelMath::ConditionalSet(index, ParallelMath::FloatFlagToInt16(ParallelMath::Less(highTerminalError, bestPixelError)), ParallelMath::MakeUInt15(7));
-                            bestPixelError = ParallelMath::Min(bestPixelError, highTerminalError);
+                                MFloat zeroError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &zero, pixel, 1, oneWeight);
+                                MFloat highTerminalError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &highTerminal, pixel, 1, oneWeight);
+                                MFloat selectedIndexError = BCCommon::ComputeErrorLDRSimple<1>(flags | Flags::Uniform, &reconstructedPixel, pixel, 1, oneWeight);
 
-                            ParallelMath::FloatCompFlag selectedIndexBetter = ParallelMath::Less(selectedIndexError, bestPixelError);
+                                MFloat bestPixelError = zeroError;
+                                MUInt15 index = ParallelMath::MakeUInt15(6);
 
-                            if (ParallelMath::AllSet(selectedIndexBetter))
-                            {
-                                if (refinePass != numRefineRounds - 1)
-                                    refiner.ContributeUnweightedPW(&floatPixels[px], selectedIndex);
-                            }
-                            else
-                            {
-                                MFloat refineWeight = ParallelMath::Select(selectedIndexBetter, ParallelMath::MakeFloat(1.0f), ParallelMath::MakeFloatZero());
+                                ParallelMath::ConditionalSet(index, ParallelMath::FloatFlagToInt16(ParallelMath::Less(highTerminalError, bestPixelError)), ParallelMath::MakeUInt15(7));
+                                bestPixelError = ParallelMath::Min(bestPixelError, highTerminalError);
 
-                                if (refinePass != numRefineRounds - 1)
-                                    refiner.ContributePW(&floatPixels[px], selectedIndex, refineWeight);
-                            }
+                                ParallelMath::FloatCompFlag selectedIndexBetter = ParallelMath::Less(selectedIndexError, bestPixelError);
 
-                            ParallelMath::ConditionalSet(index, ParallelMath::FloatFlagToInt16(selectedIndexBetter), selectedIndex);
-                            bestPixelError = ParallelMath::Min(bestPixelError, selectedIndexError);
+                                if (ParallelMath::AllSet(selectedIndexBetter))
+                                {
+                                    if (refinePass != numRefineRounds - 1)
+                                        refiner[ch].ContributeUnweightedPW(floatPixel, selectedIndex);
+                                }
+                                else
+                                {
+                                    MFloat refineWeight = ParallelMath::Select(selectedIndexBetter, ParallelMath::MakeFloat(1.0f), ParallelMath::MakeFloatZero());
 
-                            error = error + bestPixelError;
+                                    if (refinePass != numRefineRounds - 1)
+                                        refiner[ch].ContributePW(floatPixel, selectedIndex, refineWeight);
+                                }
 
-                            indexes[px] = index;
-                        }
+                                ParallelMath::ConditionalSet(index, ParallelMath::FloatFlagToInt16(selectedIndexBetter), selectedIndex);
+                                bestPixelError = ParallelMath::Min(bestPixelError, selectedIndexError);
 
-                        ParallelMath::FloatCompFlag errorBetter = ParallelMath::Less(error, bestError);
-                        ParallelMath::Int16CompFlag errorBetter16 = ParallelMath::FloatFlagToInt16(errorBetter);
+                                error[ch] = error[ch] + bestPixelError;
 
-                        if (ParallelMath::AnySet(errorBetter16))
+                                indexes[ch][px] = index;
+                            }
+                        }
+
+                        for (int ch = 0; ch < TNumChannels; ch++)
                         {
-                            bestError = ParallelMath::Min(error, bestError);
-                            ParallelMath::ConditionalSet(bestIsFullRange, errorBetter16, zero);
-                            for (int px = 0; px < 16; px++)
-                                ParallelMath::ConditionalSet(bestIndexes[px], errorBetter16, indexes[px]);
+                            if (!channelActive[ch])
+                                continue;
 
-                            for (int epi = 0; epi < 2; epi++)
-                                ParallelMath::ConditionalSet(bestEP[epi], errorBetter16, ep[epi][0]);
-                        }
+                            ParallelMath::FloatCompFlag errorBetter = ParallelMath::Less(error[ch], bestError[ch]);
+                            ParallelMath::Int16CompFlag errorBetter16 = ParallelMath::FloatFlagToInt16(errorBetter);
 
-                        if (refinePass != numRefineRounds - 1)
-                            refiner.GetRefinedEndpointsLDR(ep, &rtn);
+                            if (ParallelMath::AnySet(errorBetter16))
+                            {
+                                bestError[ch] = ParallelMath::Min(error[ch], bestError[ch]);
+                                ParallelMath::ConditionalSet(bestIsFullRange[ch], errorBetter16, zero);
+                                for (int px = 0; px < 16; px++)
+                                    ParallelMath::ConditionalSet(bestIndexes[ch][px], errorBetter16, indexes[ch][px]);
+
+                                for (int epi = 0; epi < 2; epi++)
+                                    ParallelMath::ConditionalSet(bestEP[ch][epi], errorBetter16, ep[ch][epi][0]);
+                            }
+
+                            if (refinePass != numRefineRounds - 1)
+                                refiner[ch].GetRefinedEndpointsLDR(ep[ch], &rtn);
+                        }
                     }
                 }
             }
@@ -650,72 +716,97 @@ void cvtt::Internal::S3TCComputer::PackInterpolatedAlpha(uint32_t flags, const P
 
     for (int block = 0; block < ParallelMath::ParallelSize; block++)
     {
-        int ep0 = ParallelMath::Extract(bestEP[0], block);
-        int ep1 = ParallelMath::Extract(bestEP[1], block);
-        int isFullRange = ParallelMath::Extract(bestIsFullRange, block);
-
-        if (isSigned)
+        for (int ch = 0; ch < TNumChannels; ch++)
         {
-            ep0 -= 127;
-            ep1 -= 127;
+            uint8_t *packedBlock = packedBlocks + ch * 8;
 
-            assert(ep0 >= -127 && ep0 <= 127);
-            assert(ep1 >= -127 && ep1 <= 127);
-        }
+            int ep0 = ParallelMath::Extract(bestEP[ch][0], block);
+            int ep1 = ParallelMath::Extract(bestEP[ch][1], block);
+            int isFullRange = ParallelMath::Extract(bestIsFullRange[ch], block);
 
+            if (isSigned)
+            {
+                ep0 -= 127;
+                ep1 -= 127;
 
-        bool swapEndpoints = (isFullRange != 0) != (ep0 > ep1);
+                assert(ep0 >= -127 && ep0 <= 127);
+                assert(ep1 >= -127 && ep1 <= 127);
+            }
 
-        if (swapEndpoints)
-            std::swap(ep0, ep1);
 
-        uint16_t dumpBits = 0;
-        int dumpBitsOffset = 0;
-        int dumpByteOffset = 2;
-        packedBlocks[0] = static_cast<uint8_t>(ep0 & 0xff);
-        packedBlocks[1] = static_cast<uint8_t>(ep1 & 0xff);
+            bool swapEndpoints = (isFullRange != 0) != (ep0 > ep1);
 
-        int maxValue = (isFullRange != 0) ? 7 : 5;
+            if (swapEndpoints)
+                Util::Swap(ep0, ep1);
 
-        for (int px = 0; px < 16; px++)
-        {
-            int index = ParallelMath::Extract(bestIndexes[px], block);
+            uint16_t dumpBits = 0;
+            int dumpBitsOffset = 0;
+            int dumpByteOffset = 2;
+            packedBlock[0] = static_cast<uint8_t>(ep0 & 0xff);
+            packedBlock[1] = static_cast<uint8_t>(ep1 & 0xff);
 
-            if (swapEndpoints && index <= maxValue)
-                index = maxValue - index;
+            int maxValue = (isFullRange != 0) ? 7 : 5;
 
-            if (index != 0)
+            for (int px = 0; px < 16; px++)
             {
-                if (index == maxValue)
-                    index = 1;
-                else if (index < maxValue)
-                    index++;
-            }
+                int index = ParallelMath::Extract(bestIndexes[ch][px], block);
 
-            assert(index >= 0 && index < 8);
+                if (swapEndpoints && index <= maxValue)
+                    index = maxValue - index;
 
-            dumpBits |= static_cast<uint16_t>(index << dumpBitsOffset);
-            dumpBitsOffset += 3;
+                if (index != 0)
+                {
+                    if (index == maxValue)
+                        index = 1;
+                    else if (index < maxValue)
+                        index++;
+                }
 
-            if (dumpBitsOffset >= 8)
-            {
-                assert(dumpByteOffset < 8);
-                packedBlocks[dumpByteOffset] = static_cast<uint8_t>(dumpBits & 0xff);
-                dumpBits >>= 8;
-                dumpBitsOffset -= 8;
-                dumpByteOffset++;
+                assert(index >= 0 && index < 8);
+
+                dumpBits |= static_cast<uint16_t>(index << dumpBitsOffset);
+                dumpBitsOffset += 3;
+
+                if (dumpBitsOffset >= 8)
+                {
+                    assert(dumpByteOffset < 8);
+                    packedBlock[dumpByteOffset] = static_cast<uint8_t>(dumpBits & 0xff);
+                    dumpBits >>= 8;
+                    dumpBitsOffset -= 8;
+                    dumpByteOffset++;
+                }
             }
-        }
 
-        assert(dumpBitsOffset == 0);
-        assert(dumpByteOffset == 8);
+            assert(dumpBitsOffset == 0);
+            assert(dumpByteOffset == 8);
+        }
 
         packedBlocks += packedBlockStride;
     }
 }
 
+void cvtt::Internal::S3TCComputer::PackInterpolatedAlpha(uint32_t flags, const PixelBlockU8* inputs, int inputChannel, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds)
+{
+    const int inputChannels[1] = { inputChannel };
+
+    PackInterpolatedAlphaChannels<1>(flags, inputs, inputChannels, packedBlocks, packedBlockStride, isSigned, maxTweakRounds, numRefineRounds);
+}
+
+void cvtt::Internal::S3TCComputer::PackInterpolatedAlphaRG(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds)
+{
+    const int inputChannels[2] = { 0, 1 };
+
+    PackInterpolatedAlphaChannels<2>(flags, inputs, inputChannels, packedBlocks, packedBlockStride, isSigned, maxTweakRounds, numRefineRounds);
+}
+
 void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, const float channelWeights[4], bool alphaTest, float alphaThreshold, bool exhaustive, int maxTweakRounds, int numRefineRounds)
 {
+    if (flags & Flags::S3TC_RealTime)
+    {
+        PackRGBRealTime(inputs, packedBlocks, packedBlockStride, channelWeights, alphaTest, alphaThreshold);
+        return;
+    }
+
     ParallelMath::RoundTowardNearestForScope rtn;
 
     if (numRefineRounds < 1)
@@ -745,7 +836,7 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
 
     if (alphaTest)
     {
-        MUInt15 threshold = ParallelMath::MakeUInt15(static_cast<uint16_t>(floor(alphaThreshold * 255.0f + 0.5f)));
+        MUInt15 threshold = ParallelMath::MakeUInt15(static_cast<uint16_t>(floorf(alphaThreshold * 255.0f + 0.5f)));
 
         for (int px = 0; px < 16; px++)
         {
@@ -826,16 +917,49 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
             }
         }
 
-        // Sort bins
-        for (int sortEnd = 1; sortEnd < 16; sortEnd++)
+        // Sort bins with a bitonic sorting network, carrying each pixel's color along with its bin.  The original indexes in the
+        // low bits make every bin unique, so the order is the same as any other sort.  Red and green are packed together to save
+        // a select per comparison.
+        MUInt16 sortedRG[16];
+        MUInt15 sortedB[16];
+        for (int px = 0; px < 16; px++)
+        {
+            sortedRG[px] = ParallelMath::LosslessCast<MUInt16>::Cast(pixels[px][0]) | (ParallelMath::LosslessCast<MUInt16>::Cast(pixels[px][1]) << 8);
+            sortedB[px] = pixels[px][2];
+        }
+
+        for (int mergeSize = 2; mergeSize <= 16; mergeSize *= 2)
         {
-            for (int sortLoc = sortEnd; sortLoc > 0; sortLoc--)
+            for (int span = mergeSize / 2; span > 0; span /= 2)
             {
-                MSInt16 a = sortBins[sortLoc];
-                MSInt16 b = sortBins[sortLoc - 1];
+                for (int low = 0; low < 16; low++)
+                {
+                    const int high = (low ^ span);
+                    if (high < low)
+                        continue;
+
+                    const bool ascending = ((low & mergeSize) == 0);
+                    const int minLoc = ascending ? low : high;
+                    const int maxLoc = ascending ? high : low;
+
+                    MSInt16 a = sortBins[minLoc];
+                    MSInt16 b = sortBins[maxLoc];
+
+                    ParallelMath::Int16CompFlag swap = ParallelMath::Less(b, a);
+
+                    sortBins[minLoc] = ParallelMath::Min(a, b);
+                    sortBins[maxLoc] = ParallelMath::Max(a, b);
+
+                    MUInt16 rgA = sortedRG[minLoc];
+                    MUInt16 rgB = sortedRG[maxLoc];
+                    sortedRG[minLoc] = ParallelMath::Select(swap, rgB, rgA);
+                    sortedRG[maxLoc] = ParallelMath::Select(swap, rgA, rgB);
 
-                sortBins[sortLoc] = ParallelMath::Max(a, b);
-                sortBins[sortLoc - 1] = ParallelMath::Min(a, b);
+                    MUInt15 bA = sortedB[minLoc];
+                    MUInt15 bB = sortedB[maxLoc];
+                    sortedB[minLoc] = ParallelMath::Select(swap, bB, bA);
+                    sortedB[maxLoc] = ParallelMath::Select(swap, bA, bB);
+                }
             }
         }
 
@@ -850,38 +974,28 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
 
         MUInt15 numElements = ParallelMath::MakeUInt15(16) - firstElement;
 
-        MUInt15 sortedInputs[16][4];
-        MFloat floatSortedInputs[16][4];
-        MFloat pwFloatSortedInputs[16][4];
+        MUInt15 sortedInputs[16][3];
+        MFloat pwFloatSortedInputs[16][3];
 
         for (int e = 0; e < 16; e++)
         {
-            for (int ch = 0; ch < 4; ch++)
-                sortedInputs[e][ch] = ParallelMath::MakeUInt15(0);
-        }
-
-        for (int block = 0; block < ParallelMath::ParallelSize; block++)
-        {
-            for (int e = ParallelMath::Extract(firstElement, block); e < 16; e++)
-            {
-                ParallelMath::ScalarUInt16 sortBin = ParallelMath::Extract(sortBins[e], block);
-                int originalIndex = (sortBin & 15);
+            ParallelMath::Int16CompFlag isInvalid = ParallelMath::Less(sortBins[e], ParallelMath::MakeSInt16(0));
 
-                for (int ch = 0; ch < 4; ch++)
-                    ParallelMath::PutUInt15(sortedInputs[15 - e][ch], block, ParallelMath::Extract(pixels[originalIndex][ch], block));
-            }
+            MUInt16 rg = ParallelMath::Select(isInvalid, ParallelMath::MakeUInt16(0), sortedRG[e]);
+            sortedInputs[15 - e][0] = ParallelMath::LosslessCast<MUInt15>::Cast(rg & ParallelMath::MakeUInt16(255));
+            sortedInputs[15 - e][1] = ParallelMath::LosslessCast<MUInt15>::Cast(ParallelMath::RightShift(rg, 8));
+            sortedInputs[15 - e][2] = ParallelMath::Select(isInvalid, ParallelMath::MakeUInt15(0), sortedB[e]);
         }
 
         for (int e = 0; e < 16; e++)
         {
-            for (int ch = 0; ch < 4; ch++)
-            {
-                MFloat f = ParallelMath::ToFloat(sortedInputs[e][ch]);
-                floatSortedInputs[e][ch] = f;
-                pwFloatSortedInputs[e][ch] = f * channelWeights[ch];
-            }
+            for (int ch = 0; ch < 3; ch++)
+                pwFloatSortedInputs[e][ch] = ParallelMath::ToFloat(sortedInputs[e][ch]) * channelWeights[ch];
         }
 
+        ClusterFitter<3> clusterFitter;
+        clusterFitter.Init(pwFloatSortedInputs, numElements);
+
         for (int n0 = 0; n0 <= 15; n0++)
         {
             int remainingFor1 = 16 - n0;
@@ -903,7 +1017,7 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
 
                     int counts[4] = { n0, n1, n2, n3 };
 
-                    TestCounts(flags, counts, 4, numElements, pixels, floatPixels, preWeightedPixels, alphaTest, floatSortedInputs, pwFloatSortedInputs, channelWeights, bestError, bestEndpoints, bestIndexes, bestRange, &rtn);
+                    TestCounts(flags, counts, 4, clusterFitter, pixels, floatPixels, preWeightedPixels, alphaTest, channelWeights, bestError, bestEndpoints, bestIndexes, bestRange, &rtn);
                 }
             }
         }
@@ -927,7 +1041,7 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
 
                     int counts[3] = { n0, n1, n2 };
 
-                    TestCounts(flags, counts, 3, numElements, pixels, floatPixels, preWeightedPixels, alphaTest, floatSortedInputs, pwFloatSortedInputs, channelWeights, bestError, bestEndpoints, bestIndexes, bestRange, &rtn);
+                    TestCounts(flags, counts, 3, clusterFitter, pixels, floatPixels, preWeightedPixels, alphaTest, channelWeights, bestError, bestEndpoints, bestIndexes, bestRange, &rtn);
                 }
             }
 
@@ -996,7 +1110,7 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
             }
             else if (compressedEP[0] < compressedEP[1])
             {
-                std::swap(compressedEP[0], compressedEP[1]);
+                Util::Swap(compressedEP[0], compressedEP[1]);
                 indexOrder[0] = 1;
                 indexOrder[1] = 3;
                 indexOrder[2] = 2;
@@ -1016,7 +1130,7 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
 
             if (compressedEP[0] > compressedEP[1])
             {
-                std::swap(compressedEP[0], compressedEP[1]);
+                Util::Swap(compressedEP[0], compressedEP[1]);
                 indexOrder[0] = 1;
                 indexOrder[1] = 2;
                 indexOrder[2] = 0;
@@ -1051,4 +1165,484 @@ void cvtt::Internal::S3TCComputer::PackRGB(uint32_t flags, const PixelBlockU8* i
     }
 }
 
+void cvtt::Internal::S3TCComputer::PackRGBRealTime(const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, const float channelWeights[4], bool alphaTest, float alphaThreshold)
+{
+    ParallelMath::RoundTowardNearestForScope rtn;
+
+    MUInt15 pixels[16][3];
+    MFloat floatPixels[16][3];
+    ParallelMath::Int16CompFlag isTransparent[16];
+    ParallelMath::Int16CompFlag anyTransparent = ParallelMath::MakeBoolInt16(false);
+
+    MUInt15 threshold = ParallelMath::MakeUInt15(static_cast<uint16_t>(floorf(alphaThreshold * 255.0f + 0.5f)));
+
+    MUInt15 minColor[3];
+    MUInt15 maxColor[3];
+
+    for (int ch = 0; ch < 3; ch++)
+    {
+        minColor[ch] = ParallelMath::MakeUInt15(255);
+        maxColor[ch] = ParallelMath::MakeUInt15(0);
+    }
+
+    for (int px = 0; px < 16; px++)
+    {
+        MUInt15 channels[4];
+        ParallelMath::ConvertLDRInputs(inputs, px, channels);
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            pixels[px][ch] = channels[ch];
+            floatPixels[px][ch] = ParallelMath::ToFloat(pixels[px][ch]);
+        }
+
+        if (alphaTest)
+        {
+            isTransparent[px] = ParallelMath::Less(channels[3], threshold);
+            anyTransparent = anyTransparent | isTransparent[px];
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                minColor[ch] = ParallelMath::Min(minColor[ch], ParallelMath::Select(isTransparent[px], ParallelMath::MakeUInt15(255), pixels[px][ch]));
+                maxColor[ch] = ParallelMath::Max(maxColor[ch], ParallelMath::Select(isTransparent[px], ParallelMath::MakeUInt15(0), pixels[px][ch]));
+            }
+        }
+        else
+        {
+            for (int ch = 0; ch < 3; ch++)
+            {
+                minColor[ch] = ParallelMath::Min(minColor[ch], pixels[px][ch]);
+                maxColor[ch] = ParallelMath::Max(maxColor[ch], pixels[px][ch]);
+            }
+        }
+    }
+
+    if (alphaTest)
+    {
+        // Fully transparent blocks have an empty bounding box
+        ParallelMath::Int16CompFlag isEmpty = ParallelMath::Less(maxColor[0], minColor[0]);
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            ParallelMath::ConditionalSet(minColor[ch], isEmpty, ParallelMath::MakeUInt15(0));
+            ParallelMath::ConditionalSet(maxColor[ch], isEmpty, ParallelMath::MakeUInt15(0));
+        }
+    }
+
+    // Pick the bounding box diagonal by the sign of each channel's covariance with the channel of largest weighted extent
+    MFloat center[3];
+    MFloat extent[3];
+    for (int ch = 0; ch < 3; ch++)
+    {
+        center[ch] = ParallelMath::ToFloat(minColor[ch] + maxColor[ch]) * 0.5f;
+        extent[ch] = ParallelMath::ToFloat(maxColor[ch] - minColor[ch]) * channelWeights[ch];
+    }
+
+    MFloat covRG = ParallelMath::MakeFloatZero();
+    MFloat covRB = ParallelMath::MakeFloatZero();
+    MFloat covGB = ParallelMath::MakeFloatZero();
+
+    for (int px = 0; px < 16; px++)
+    {
+        MFloat offset[3];
+        for (int ch = 0; ch < 3; ch++)
+        {
+            offset[ch] = floatPixels[px][ch] - center[ch];
+            if (alphaTest)
+                offset[ch] = ParallelMath::Select(ParallelMath::Int16FlagToFloat(isTransparent[px]), ParallelMath::MakeFloatZero(), offset[ch]);
+        }
+
+        covRG = covRG + offset[0] * offset[1];
+        covRB = covRB + offset[0] * offset[2];
+        covGB = covGB + offset[1] * offset[2];
+    }
+
+    ParallelMath::Int16CompFlag negativeRG = ParallelMath::FloatFlagToInt16(ParallelMath::Less(covRG, ParallelMath::MakeFloatZero()));
+    ParallelMath::Int16CompFlag negativeRB = ParallelMath::FloatFlagToInt16(ParallelMath::Less(covRB, ParallelMath::MakeFloatZero()));
+    ParallelMath::Int16CompFlag negativeGB = ParallelMath::FloatFlagToInt16(ParallelMath::Less(covGB, ParallelMath::MakeFloatZero()));
+
+    ParallelMath::Int16CompFlag redDominant = ParallelMath::Not(ParallelMath::FloatFlagToInt16(ParallelMath::Less(extent[0], extent[1]) | ParallelMath::Less(extent[0], extent[2])));
+    ParallelMath::Int16CompFlag greenDominant = ParallelMath::AndNot(ParallelMath::Not(ParallelMath::FloatFlagToInt16(ParallelMath::Less(extent[1], extent[2]))), redDominant);
+    ParallelMath::Int16CompFlag blueDominant = ParallelMath::Not(redDominant | greenDominant);
+
+    ParallelMath::Int16CompFlag flip[3];
+    flip[0] = (greenDominant & negativeRG) | (blueDominant & negativeRB);
+    flip[1] = (redDominant & negativeRG) | (blueDominant & negativeGB);
+    flip[2] = (redDominant & negativeRB) | (greenDominant & negativeGB);
+
+    // Inset the endpoints by 1/16 of the extent, which roughly centers the interpolated colors on the pixels
+    MUInt15 endPoints[2][3];
+    for (int ch = 0; ch < 3; ch++)
+    {
+        MUInt15 inset = ParallelMath::RightShift(maxColor[ch] - minColor[ch], 4);
+        MUInt15 low = minColor[ch] + inset;
+        MUInt15 high = maxColor[ch] - inset;
+
+        endPoints[0][ch] = ParallelMath::Select(flip[ch], high, low);
+        endPoints[1][ch] = ParallelMath::Select(flip[ch], low, high);
+    }
+
+    for (int epi = 0; epi < 2; epi++)
+        QuantizeTo565(endPoints[epi]);
+
+    // 4-color blocks need the first endpoint to be greater and 3-color blocks need it to be less or equal.  The quantized
+    // channels are expanded monotonically, so comparing them in order compares the packed values.
+    {
+        ParallelMath::Int16CompFlag firstLess = ParallelMath::Less(endPoints[0][2], endPoints[1][2]);
+        ParallelMath::Int16CompFlag firstGreater = ParallelMath::Less(endPoints[1][2], endPoints[0][2]);
+        for (int ch = 1; ch >= 0; ch--)
+        {
+            ParallelMath::Int16CompFlag isEqual = ParallelMath::Equal(endPoints[0][ch], endPoints[1][ch]);
+            firstLess = ParallelMath::Less(endPoints[0][ch], endPoints[1][ch]) | (isEqual & firstLess);
+            firstGreater = ParallelMath::Less(endPoints[1][ch], endPoints[0][ch]) | (isEqual & firstGreater);
+        }
+
+        ParallelMath::Int16CompFlag swapEndpoints = (anyTransparent & firstGreater) | ParallelMath::AndNot(firstLess, anyTransparent);
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            MUInt15 ep0 = endPoints[0][ch];
+            MUInt15 ep1 = endPoints[1][ch];
+            endPoints[0][ch] = ParallelMath::Select(swapEndpoints, ep1, ep0);
+            endPoints[1][ch] = ParallelMath::Select(swapEndpoints, ep0, ep1);
+        }
+    }
+
+    IndexSelector<3> indexSelector;
+    indexSelector.Init<false>(channelWeights, endPoints, 4);
+
+    MUInt15 indexes[16];
+    for (int px = 0; px < 16; px++)
+    {
+        // Equal endpoints select index 0 for every pixel, so the block is valid in either mode
+        MUInt15 index = indexSelector.SelectIndexLDR(floatPixels[px], &rtn);
+
+        MUInt15 code = index + ParallelMath::MakeUInt15(1);
+        ParallelMath::ConditionalSet(code, ParallelMath::Equal(index, ParallelMath::MakeUInt15(0)), ParallelMath::MakeUInt15(0));
+        ParallelMath::ConditionalSet(code, ParallelMath::Equal(index, ParallelMath::MakeUInt15(3)), ParallelMath::MakeUInt15(1));
+
+        indexes[px] = code;
+    }
+
+    if (alphaTest && ParallelMath::AnySet(anyTransparent))
+    {
+        IndexSelector<3> indexSelector3;
+        indexSelector3.Init<false>(channelWeights, endPoints, 3);
+
+        for (int px = 0; px < 16; px++)
+        {
+            MUInt15 index = indexSelector3.SelectIndexLDR(floatPixels[px], &rtn);
+
+            MUInt15 code = ParallelMath::MakeUInt15(3) - index;
+            ParallelMath::ConditionalSet(code, ParallelMath::Equal(index, ParallelMath::MakeUInt15(0)), ParallelMath::MakeUInt15(0));
+            ParallelMath::ConditionalSet(code, isTransparent[px], ParallelMath::MakeUInt15(3));
+
+            ParallelMath::ConditionalSet(indexes[px], anyTransparent, code);
+        }
+    }
+
+    uint16_t wordValues[4][ParallelMath::ParallelSize];
+
+    for (int epi = 0; epi < 2; epi++)
+    {
+        MUInt15 highBits = endPoints[epi][0] & ParallelMath::MakeUInt15(0xf8);
+        MUInt15 lowBits = ((endPoints[epi][1] & ParallelMath::MakeUInt15(0xfc)) << 3) | ParallelMath::RightShift(endPoints[epi][2], 3);
+
+        ParallelMath::StoreUInt16(wordValues[epi], (ParallelMath::ToUInt16(highBits) << 8) | ParallelMath::ToUInt16(lowBits));
+    }
+
+    MUInt16 packedIndexes[2] = { ParallelMath::MakeUInt16(0), ParallelMath::MakeUInt16(0) };
+    for (int px = 0; px < 16; px++)
+        packedIndexes[px / 8] = packedIndexes[px / 8] | (ParallelMath::ToUInt16(indexes[px]) << ((px % 8) * 2));
+
+    for (int i = 0; i < 2; i++)
+        ParallelMath::StoreUInt16(wordValues[2 + i], packedIndexes[i]);
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        for (int word = 0; word < 4; word++)
+        {
+            const uint16_t value = wordValues[word][block];
+
+            packedBlocks[word * 2] = static_cast<uint8_t>(value & 0xff);
+            packedBlocks[word * 2 + 1] = static_cast<uint8_t>((value >> 8) & 0xff);
+        }
+
+        packedBlocks += packedBlockStride;
+    }
+}
+
+void cvtt::Internal::S3TCComputer::PackInterpolatedAlphaRealTime(const PixelBlockU8* inputs, const int *inputChannels, int numChannels, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned)
+{
+    ParallelMath::RoundTowardNearestForScope rtn;
+
+    float oneWeight[1] = { 1.0f };
+
+    MUInt15 highTerminal = isSigned ? ParallelMath::MakeUInt15(254) : ParallelMath::MakeUInt15(255);
+
+    // A single channel is cheaper to read by itself than to transpose out of the whole pixel
+    MUInt15 pixels[16][4];
+    for (int px = 0; px < 16; px++)
+    {
+        if (numChannels == 1)
+            ParallelMath::ConvertLDRInputs(inputs, px, inputChannels[0], pixels[px][inputChannels[0]]);
+        else
+            ParallelMath::ConvertLDRInputs(inputs, px, pixels[px]);
+    }
+
+    for (int ch = 0; ch < numChannels; ch++)
+    {
+        MFloat floatPixels[16];
+        MUInt15 endPoints[2][1] = { { highTerminal }, { ParallelMath::MakeUInt15(0) } };
+
+        for (int px = 0; px < 16; px++)
+        {
+            MUInt15 pixel = pixels[px][inputChannels[ch]];
+
+            if (isSigned)
+                pixel = ParallelMath::Min(pixel, highTerminal);
+
+            floatPixels[px] = ParallelMath::ToFloat(pixel);
+
+            endPoints[0][0] = ParallelMath::Min(endPoints[0][0], pixel);
+            endPoints[1][0] = ParallelMath::Max(endPoints[1][0], pixel);
+        }
+
+        IndexSelector<1> indexSelector;
+        indexSelector.Init<false>(oneWeight, endPoints, 8);
+
+        // The maximum is stored first to select 8-value mode.  Equal endpoints select code 1 for every pixel, which is valid in both modes.
+        MUInt16 packedIndexes[3] = { ParallelMath::MakeUInt16(0), ParallelMath::MakeUInt16(0), ParallelMath::MakeUInt16(0) };
+        for (int px = 0; px < 16; px++)
+        {
+            MUInt15 reverseIndex = ParallelMath::MakeUInt15(7) - indexSelector.SelectIndexLDR(&floatPixels[px], &rtn);
+
+            MUInt15 code = reverseIndex + ParallelMath::MakeUInt15(1);
+            ParallelMath::ConditionalSet(code, ParallelMath::Equal(reverseIndex, ParallelMath::MakeUInt15(0)), ParallelMath::MakeUInt15(0));
+            ParallelMath::ConditionalSet(code, ParallelMath::Equal(reverseIndex, ParallelMath::MakeUInt15(7)), ParallelMath::MakeUInt15(1));
+
+            MUInt16 code16 = ParallelMath::ToUInt16(code);
+
+            int word = (px * 3) / 16;
+            int shift = (px * 3) % 16;
+            packedIndexes[word] = packedIndexes[word] | (code16 << shift);
+            if (shift > 13)
+                packedIndexes[word + 1] = packedIndexes[word + 1] | ParallelMath::RightShift(code16, 16 - shift);
+        }
+
+        // Signed endpoints are biased by 127, adding 129 instead wraps them to their two's complement bytes
+        MUInt15 epBytes[2] = { endPoints[1][0], endPoints[0][0] };
+        if (isSigned)
+        {
+            for (int epi = 0; epi < 2; epi++)
+                epBytes[epi] = (epBytes[epi] + ParallelMath::MakeUInt15(129)) & ParallelMath::MakeUInt15(0xff);
+        }
+
+        uint16_t wordValues[4][ParallelMath::ParallelSize];
+        ParallelMath::StoreUInt16(wordValues[0], ParallelMath::ToUInt16(epBytes[0]) | (ParallelMath::ToUInt16(epBytes[1]) << 8));
+        for (int word = 1; word < 4; word++)
+            ParallelMath::StoreUInt16(wordValues[word], packedIndexes[word - 1]);
+
+        uint8_t *packedBlock = packedBlocks + ch * 8;
+        for (int block = 0; block < ParallelMath::ParallelSize; block++)
+        {
+            for (int word = 0; word < 4; word++)
+            {
+                const uint16_t value = wordValues[word][block];
+
+                packedBlock[word * 2] = static_cast<uint8_t>(value & 0xff);
+                packedBlock[word * 2 + 1] = static_cast<uint8_t>((value >> 8) & 0xff);
+            }
+
+            packedBlock += packedBlockStride;
+        }
+    }
+}
+
+// Uses the same rounding as IndexSelector::ReconstructLDRPrecise, so decoded blocks match the encoder's error estimates
+cvtt::ParallelMath::UInt15 cvtt::Internal::S3TCComputer::InterpolateLDR(const MUInt15 &ep0, const MUInt15 &ep1, int index, int range)
+{
+    const uint16_t weight = static_cast<uint16_t>((g_weightReciprocals[range] * index + 64) >> 7);
+
+    MUInt16 sum = ParallelMath::CompactMultiply(ep0, ParallelMath::MakeUInt15(static_cast<uint16_t>(256 - weight)))
+        + ParallelMath::CompactMultiply(ep1, ParallelMath::MakeUInt15(weight));
+
+    return ParallelMath::ToUInt15(ParallelMath::RightShift(sum + ParallelMath::MakeUInt16(128), 8));
+}
+
+void cvtt::Internal::S3TCComputer::UnpackExplicitAlpha(const uint8_t* packedBlocks, size_t packedBlockStride, MUInt15 outValues[16])
+{
+    uint16_t indexWordValues[4][ParallelMath::ParallelSize];
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        const uint8_t *packedBlock = packedBlocks + block * packedBlockStride;
+
+        for (int word = 0; word < 4; word++)
+            indexWordValues[word][block] = static_cast<uint16_t>(packedBlock[word * 2] | (packedBlock[word * 2 + 1] << 8));
+    }
+
+    MUInt16 indexWords[4];
+    for (int word = 0; word < 4; word++)
+        indexWords[word] = ParallelMath::LoadUInt16(indexWordValues[word]);
+
+    for (int px = 0; px < 16; px++)
+    {
+        MUInt15 index = ParallelMath::ToUInt15(ParallelMath::RightShift(indexWords[px / 4], (px % 4) * 4) & ParallelMath::MakeUInt16(15));
+        outValues[px] = (index << 4) | index;
+    }
+}
+
+void cvtt::Internal::S3TCComputer::UnpackInterpolatedAlpha(const uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, MUInt15 outValues[16])
+{
+    uint16_t epValues[2][ParallelMath::ParallelSize];
+    uint16_t indexWordValues[3][ParallelMath::ParallelSize];
+    bool isSixValueFlags[ParallelMath::ParallelSize];
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        const uint8_t *packedBlock = packedBlocks + block * packedBlockStride;
+
+        int rawEP[2];
+        for (int epi = 0; epi < 2; epi++)
+        {
+            if (isSigned)
+            {
+                rawEP[epi] = static_cast<int8_t>(packedBlock[epi]);
+                epValues[epi][block] = static_cast<uint16_t>(Util::Max(rawEP[epi], -127) + 127);
+            }
+            else
+            {
+                rawEP[epi] = packedBlock[epi];
+                epValues[epi][block] = static_cast<uint16_t>(rawEP[epi]);
+            }
+        }
+
+        isSixValueFlags[block] = (rawEP[0] <= rawEP[1]);
+
+        for (int word = 0; word < 3; word++)
+            indexWordValues[word][block] = static_cast<uint16_t>(packedBlock[2 + word * 2] | (packedBlock[3 + word * 2] << 8));
+    }
+
+    MUInt15 ep[2];
+    for (int epi = 0; epi < 2; epi++)
+        ep[epi] = ParallelMath::LoadUInt15(epValues[epi]);
+
+    MUInt16 indexWords[3];
+    for (int word = 0; word < 3; word++)
+        indexWords[word] = ParallelMath::LoadUInt16(indexWordValues[word]);
+
+    ParallelMath::Int16CompFlag isSixValue = ParallelMath::LoadBoolInt16(isSixValueFlags);
+
+    MUInt15 palette[8];
+    palette[0] = ep[0];
+    palette[1] = ep[1];
+
+    for (int i = 2; i < 8; i++)
+        palette[i] = InterpolateLDR(ep[0], ep[1], i - 1, 8);
+
+    for (int i = 2; i < 6; i++)
+        ParallelMath::ConditionalSet(palette[i], isSixValue, InterpolateLDR(ep[0], ep[1], i - 1, 6));
+
+    ParallelMath::ConditionalSet(palette[6], isSixValue, ParallelMath::MakeUInt15(0));
+    ParallelMath::ConditionalSet(palette[7], isSixValue, ParallelMath::MakeUInt15(isSigned ? 254 : 255));
+
+    for (int px = 0; px < 16; px++)
+    {
+        const int bitPos = px * 3;
+        const int word = bitPos / 16;
+        const int shift = bitPos % 16;
+
+        MUInt16 indexBits = ParallelMath::RightShift(indexWords[word], shift);
+        if (shift > 13)
+            indexBits = indexBits | (indexWords[word + 1] << (16 - shift));
+
+        MUInt15 index = ParallelMath::ToUInt15(indexBits & ParallelMath::MakeUInt16(7));
+
+        ParallelMath::Int16CompFlag indexBit[3];
+        for (int bit = 0; bit < 3; bit++)
+        {
+            MUInt15 bitMask = ParallelMath::MakeUInt15(static_cast<uint16_t>(1 << bit));
+            indexBit[bit] = ParallelMath::Equal(index & bitMask, bitMask);
+        }
+
+        MUInt15 pair[4];
+        for (int i = 0; i < 4; i++)
+            pair[i] = ParallelMath::Select(indexBit[0], palette[i * 2 + 1], palette[i * 2]);
+
+        MUInt15 quad[2];
+        for (int i = 0; i < 2; i++)
+            quad[i] = ParallelMath::Select(indexBit[1], pair[i * 2 + 1], pair[i * 2]);
+
+        outValues[px] = ParallelMath::Select(indexBit[2], quad[1], quad[0]);
+    }
+}
+
+void cvtt::Internal::S3TCComputer::UnpackRGB(const uint8_t* packedBlocks, size_t packedBlockStride, bool allowTransparent, MUInt15 outPixels[16][4])
+{
+    // Words 0 and 1 are the endpoints, 2 and 3 are the indexes
+    uint16_t wordValues[4][ParallelMath::ParallelSize];
+    bool isThreeColorFlags[ParallelMath::ParallelSize];
+
+    for (int block = 0; block < ParallelMath::ParallelSize; block++)
+    {
+        const uint8_t *packedBlock = packedBlocks + block * packedBlockStride;
+
+        for (int word = 0; word < 4; word++)
+            wordValues[word][block] = static_cast<uint16_t>(packedBlock[word * 2] | (packedBlock[word * 2 + 1] << 8));
+
+        isThreeColorFlags[block] = allowTransparent && (wordValues[0][block] <= wordValues[1][block]);
+    }
+
+    MUInt16 epWords[2];
+    MUInt16 indexWords[2];
+    for (int i = 0; i < 2; i++)
+    {
+        epWords[i] = ParallelMath::LoadUInt16(wordValues[i]);
+        indexWords[i] = ParallelMath::LoadUInt16(wordValues[i + 2]);
+    }
+
+    ParallelMath::Int16CompFlag isThreeColor = ParallelMath::LoadBoolInt16(isThreeColorFlags);
+
+    MUInt15 palette[4][3];
+    for (int epi = 0; epi < 2; epi++)
+    {
+        MUInt15 r = ParallelMath::ToUInt15(ParallelMath::RightShift(epWords[epi], 11));
+        MUInt15 g = ParallelMath::ToUInt15(ParallelMath::RightShift(epWords[epi], 5) & ParallelMath::MakeUInt16(63));
+        MUInt15 b = ParallelMath::ToUInt15(epWords[epi] & ParallelMath::MakeUInt16(31));
+
+        palette[epi][0] = (r << 3) | ParallelMath::RightShift(r, 2);
+        palette[epi][1] = (g << 2) | ParallelMath::RightShift(g, 4);
+        palette[epi][2] = (b << 3) | ParallelMath::RightShift(b, 2);
+    }
+
+    for (int ch = 0; ch < 3; ch++)
+    {
+        palette[2][ch] = InterpolateLDR(palette[0][ch], palette[1][ch], 1, 4);
+        palette[3][ch] = InterpolateLDR(palette[0][ch], palette[1][ch], 2, 4);
+
+        ParallelMath::ConditionalSet(palette[2][ch], isThreeColor, InterpolateLDR(palette[0][ch], palette[1][ch], 1, 3));
+        ParallelMath::ConditionalSet(palette[3][ch], isThreeColor, ParallelMath::MakeUInt15(0));
+    }
+
+    for (int px = 0; px < 16; px++)
+    {
+        MUInt15 index = ParallelMath::ToUInt15(ParallelMath::RightShift(indexWords[px / 8], (px % 8) * 2) & ParallelMath::MakeUInt16(3));
+
+        ParallelMath::Int16CompFlag indexBit0 = ParallelMath::Equal(index & ParallelMath::MakeUInt15(1), ParallelMath::MakeUInt15(1));
+        ParallelMath::Int16CompFlag indexBit1 = ParallelMath::Equal(index & ParallelMath::MakeUInt15(2), ParallelMath::MakeUInt15(2));
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            MUInt15 low = ParallelMath::Select(indexBit0, palette[1][ch], palette[0][ch]);
+            MUInt15 high = ParallelMath::Select(indexBit0, palette[3][ch], palette[2][ch]);
+            outPixels[px][ch] = ParallelMath::Select(indexBit1, high, low);
+        }
+
+        // Index 3 of 3-color blocks is transparent black
+        outPixels[px][3] = ParallelMath::MakeUInt15(255);
+        ParallelMath::ConditionalSet(outPixels[px][3], isThreeColor & indexBit0 & indexBit1, ParallelMath::MakeUInt15(0));
+    }
+}
+
 #endif
@@ -6,17 +6,23 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
+        template<int TVectorSize>
+        class ClusterFitter;
+
         template<int TVectorSize>
         class EndpointRefiner;
     }
+    CVTT_ISA_NAMESPACE_END
 
     struct PixelBlockU8;
 }
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         class S3TCComputer
@@ -38,14 +44,30 @@ namespace cvtt
                 MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange, const ParallelMath::RoundTowardNearestForScope *rtn);
             static void TestEndpoints(uint32_t flags, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const MFloat preWeightedPixels[16][4], const MUInt15 unquantizedEndPoints[2][3], int range, const float* channelWeights,
                 MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange, EndpointRefiner<3> *refiner, const ParallelMath::RoundTowardNearestForScope *rtn);
-            static void TestCounts(uint32_t flags, const int *counts, int nCounts, const MUInt15 &numElements, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const MFloat preWeightedPixels[16][4], bool alphaTest,
-                const MFloat floatSortedInputs[16][4], const MFloat preWeightedFloatSortedInputs[16][4], const float *channelWeights, MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange,
-                const ParallelMath::RoundTowardNearestForScope* rtn);
+            static void TestCounts(uint32_t flags, const int *counts, int nCounts, const ClusterFitter<3> &clusterFitter, const MUInt15 pixels[16][4], const MFloat floatPixels[16][4], const MFloat preWeightedPixels[16][4], bool alphaTest,
+                const float *channelWeights, MFloat &bestError, MUInt15 bestEndpoints[2][3], MUInt15 bestIndexes[16], MUInt15 &bestRange, const ParallelMath::RoundTowardNearestForScope* rtn);
             static void PackExplicitAlpha(uint32_t flags, const PixelBlockU8* inputs, int inputChannel, uint8_t* packedBlocks, size_t packedBlockStride);
             static void PackInterpolatedAlpha(uint32_t flags, const PixelBlockU8* inputs, int inputChannel, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds);
+            static void PackInterpolatedAlphaRG(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds);
             static void PackRGB(uint32_t flags, const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, const float channelWeights[4], bool alphaTest, float alphaThreshold, bool exhaustive, int maxTweakRounds, int numRefineRounds);
+
+            // Signed interpolated alpha values are biased by 127
+            static void UnpackExplicitAlpha(const uint8_t* packedBlocks, size_t packedBlockStride, MUInt15 outValues[16]);
+            static void UnpackInterpolatedAlpha(const uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, MUInt15 outValues[16]);
+            static void UnpackRGB(const uint8_t* packedBlocks, size_t packedBlockStride, bool allowTransparent, MUInt15 outPixels[16][4]);
+
+        private:
+            static MUInt15 InterpolateLDR(const MUInt15 &ep0, const MUInt15 &ep1, int index, int range);
+
+            static void PackRGBRealTime(const PixelBlockU8* inputs, uint8_t* packedBlocks, size_t packedBlockStride, const float channelWeights[4], bool alphaTest, float alphaThreshold);
+            static void PackInterpolatedAlphaRealTime(const PixelBlockU8* inputs, const int *inputChannels, int numChannels, uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned);
+
+            // Encodes each input channel to its own 8-byte interpolated alpha block, interleaving the per-channel searches
+            template<int TNumChannels>
+            static void PackInterpolatedAlphaChannels(uint32_t flags, const PixelBlockU8* inputs, const int inputChannels[TNumChannels], uint8_t* packedBlocks, size_t packedBlockStride, bool isSigned, int maxTweakRounds, int numRefineRounds);
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
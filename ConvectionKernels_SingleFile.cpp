@@ -38,11 +38,19 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 #include "ConvectionKernels_API.cpp"
 #include "ConvectionKernels_BC67.cpp"
 #include "ConvectionKernels_BC6H_IO.cpp"
+#include "ConvectionKernels_BC7Trainer.cpp"
 #include "ConvectionKernels_BC7_PrioData.cpp"
 #include "ConvectionKernels_BCCommon.cpp"
+#include "ConvectionKernels_Dispatch.cpp"
+#include "ConvectionKernels_EncodingStats.cpp"
 #include "ConvectionKernels_ETC.cpp"
 #include "ConvectionKernels_IndexSelector.cpp"
+#include "ConvectionKernels_Instrumentation.cpp"
+#include "ConvectionKernels_PersistentBlockCache.cpp"
 #include "ConvectionKernels_S3TC.cpp"
+#include "ConvectionKernels_Surface.cpp"
+#include "ConvectionKernels_SurfaceParallel.cpp"
+#include "ConvectionKernels_SurfaceStream.cpp"
 #include "ConvectionKernels_Util.cpp"
 
 #endif
@@ -0,0 +1,564 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels_Surface.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+
+namespace cvtt
+{
+    namespace SurfaceEncoding
+    {
+        template<class TBlock>
+        static void GatherBlocks(TBlock *blocks, size_t numBlocks, const uint8_t *const rows[4], uint32_t width, uint32_t blockX)
+        {
+            const size_t pixelSize = sizeof(blocks[0].m_pixels[0]);
+
+            for (size_t block = 0; block < numBlocks; block++)
+            {
+                uint8_t *blockBytes = reinterpret_cast<uint8_t*>(blocks[block].m_pixels);
+                const uint32_t x = static_cast<uint32_t>((blockX + block) * 4);
+
+                if (x + 4 <= width)
+                {
+                    for (int subY = 0; subY < 4; subY++)
+                        memcpy(blockBytes + subY * 4 * pixelSize, rows[subY] + x * pixelSize, 4 * pixelSize);
+                }
+                else
+                {
+                    for (int subY = 0; subY < 4; subY++)
+                    {
+                        for (uint32_t subX = 0; subX < 4; subX++)
+                        {
+                            const uint32_t clampedX = std::min(x + subX, width - 1);
+                            memcpy(blockBytes + (subY * 4 + subX) * pixelSize, rows[subY] + clampedX * pixelSize, pixelSize);
+                        }
+                    }
+                }
+            }
+        }
+
+        static void EncodeBatch(const EncodeParams &params, uint8_t *pBC, const PixelBlockU8 *blocks, size_t numBlocks)
+        {
+            const Options &options = *params.m_options;
+
+            switch (params.m_format)
+            {
+            case SurfaceFormat_BC1:
+                Kernels::EncodeBC1Batch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC2:
+                Kernels::EncodeBC2Batch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC3:
+                Kernels::EncodeBC3Batch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC4U:
+                Kernels::EncodeBC4UBatch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC5U:
+                Kernels::EncodeBC5UBatch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC7:
+                Kernels::EncodeBC7Batch(pBC, blocks, numBlocks, options, *params.m_encodingPlan);
+                break;
+            case SurfaceFormat_ETC1:
+                Kernels::EncodeETC1Batch(pBC, blocks, numBlocks, options, params.m_etc1Data);
+                break;
+            case SurfaceFormat_ETC2:
+                Kernels::EncodeETC2Batch(pBC, blocks, numBlocks, options, params.m_etc2Data);
+                break;
+            case SurfaceFormat_ETC2RGBA:
+                Kernels::EncodeETC2RGBABatch(pBC, blocks, numBlocks, options, params.m_etc2Data);
+                break;
+            case SurfaceFormat_ETC2PunchthroughAlpha:
+                Kernels::EncodeETC2PunchthroughAlphaBatch(pBC, blocks, numBlocks, options, params.m_etc2Data);
+                break;
+            case SurfaceFormat_ETC2Alpha:
+                Kernels::EncodeETC2AlphaBatch(pBC, blocks, numBlocks, options);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        static void EncodeBatch(const EncodeParams &params, uint8_t *pBC, const PixelBlockS8 *blocks, size_t numBlocks)
+        {
+            const Options &options = *params.m_options;
+
+            switch (params.m_format)
+            {
+            case SurfaceFormat_BC4S:
+                Kernels::EncodeBC4SBatch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC5S:
+                Kernels::EncodeBC5SBatch(pBC, blocks, numBlocks, options);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        static void EncodeBatch(const EncodeParams &params, uint8_t *pBC, const PixelBlockF16 *blocks, size_t numBlocks)
+        {
+            const Options &options = *params.m_options;
+
+            switch (params.m_format)
+            {
+            case SurfaceFormat_BC6HU:
+                Kernels::EncodeBC6HUBatch(pBC, blocks, numBlocks, options);
+                break;
+            case SurfaceFormat_BC6HS:
+                Kernels::EncodeBC6HSBatch(pBC, blocks, numBlocks, options);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        static void EncodeBatch(const EncodeParams &params, uint8_t *pBC, const PixelBlockScalarS16 *blocks, size_t numBlocks)
+        {
+            const Options &options = *params.m_options;
+
+            switch (params.m_format)
+            {
+            case SurfaceFormat_ETC2Alpha11U:
+                Kernels::EncodeETC2Alpha11Batch(pBC, blocks, numBlocks, false, options);
+                break;
+            case SurfaceFormat_ETC2Alpha11S:
+                Kernels::EncodeETC2Alpha11Batch(pBC, blocks, numBlocks, true, options);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        template<class TBlock>
+        static uint32_t HashBlock(const TBlock &block)
+        {
+            uint32_t words[sizeof(TBlock) / 4];
+            memcpy(words, &block, sizeof(TBlock));
+
+            uint32_t hash = 0x811c9dc5u;
+            for (size_t i = 0; i < sizeof(TBlock) / 4; i++)
+                hash = (hash ^ words[i]) * 0x01000193u;
+
+            return hash ^ (hash >> 15);
+        }
+
+        // Blocks that missed the caches wait here until there are enough of them to fill a batch.  Blocks that repeat a
+        // pending block are copied from it once the batch has been encoded.  Either cache can be missing.
+        template<class TBlock>
+        class PendingBlockBatch
+        {
+        public:
+            PendingBlockBatch(const EncodeParams &params, uint8_t *pBC, uint32_t blockSize)
+                : m_params(params)
+                , m_cache(params.m_options->stats ? NULL : params.m_blockCache)
+                , m_pBC(pBC)
+                , m_blockSize(blockSize)
+                , m_numBlocks(0)
+                , m_numRepeats(0)
+            {
+            }
+
+            void AddBlock(const TBlock &block, uint32_t blockX)
+            {
+                const uint32_t hash = HashBlock(block);
+                uint8_t *outputBlock = m_pBC + blockX * m_blockSize;
+
+                if (m_cache)
+                {
+                    BlockCache::Entry &entry = m_cache->m_entries[hash % BlockCache::kNumEntries];
+
+                    if (entry.m_isValid && entry.m_hash == hash && !memcmp(entry.m_sourceBlock, &block, sizeof(TBlock)))
+                    {
+                        memcpy(outputBlock, entry.m_outputBlock, m_blockSize);
+                        return;
+                    }
+                }
+
+                if (m_params.m_persistentCache && LookupPersistentBlock(m_params, hash, &block, sizeof(TBlock), outputBlock, m_blockSize))
+                {
+                    if (m_cache)
+                        StoreBlock(*m_cache, hash, block, outputBlock);
+                    return;
+                }
+
+                for (size_t i = 0; i < m_numBlocks; i++)
+                {
+                    if (m_hashes[i] == hash && !memcmp(&m_blocks[i], &block, sizeof(TBlock)))
+                    {
+                        m_repeatBlockX[m_numRepeats] = blockX;
+                        m_repeatSources[m_numRepeats] = static_cast<uint32_t>(i);
+                        m_numRepeats++;
+
+                        if (m_numRepeats == NumParallelBlocks)
+                            Flush();
+                        return;
+                    }
+                }
+
+                m_blocks[m_numBlocks] = block;
+                m_hashes[m_numBlocks] = hash;
+                m_blockX[m_numBlocks] = blockX;
+                m_numBlocks++;
+
+                if (m_numBlocks == NumParallelBlocks)
+                    Flush();
+            }
+
+            void Flush()
+            {
+                if (m_numBlocks == 0)
+                    return;
+
+                uint8_t encoded[NumParallelBlocks * BlockCache::kMaxOutputBlockSize];
+                EncodeBatch(m_params, encoded, m_blocks, m_numBlocks);
+
+                for (size_t i = 0; i < m_numBlocks; i++)
+                {
+                    const uint8_t *outputBlock = encoded + i * m_blockSize;
+                    memcpy(m_pBC + m_blockX[i] * m_blockSize, outputBlock, m_blockSize);
+
+                    if (m_cache)
+                        StoreBlock(*m_cache, m_hashes[i], m_blocks[i], outputBlock);
+                    if (m_params.m_persistentCache)
+                        StorePersistentBlock(m_params, m_hashes[i], &m_blocks[i], sizeof(TBlock), outputBlock, m_blockSize);
+                }
+
+                for (size_t i = 0; i < m_numRepeats; i++)
+                    memcpy(m_pBC + m_repeatBlockX[i] * m_blockSize, encoded + m_repeatSources[i] * m_blockSize, m_blockSize);
+
+                m_numBlocks = 0;
+                m_numRepeats = 0;
+            }
+
+        private:
+            void StoreBlock(BlockCache &cache, uint32_t hash, const TBlock &block, const uint8_t *outputBlock) const
+            {
+                BlockCache::Entry &entry = cache.m_entries[hash % BlockCache::kNumEntries];
+                memcpy(entry.m_sourceBlock, &block, sizeof(TBlock));
+                memcpy(entry.m_outputBlock, outputBlock, m_blockSize);
+                entry.m_hash = hash;
+                entry.m_isValid = true;
+            }
+
+            const EncodeParams &m_params;
+            BlockCache *m_cache;
+            uint8_t *m_pBC;
+            uint32_t m_blockSize;
+
+            TBlock m_blocks[NumParallelBlocks];
+            uint32_t m_hashes[NumParallelBlocks];
+            uint32_t m_blockX[NumParallelBlocks];
+            size_t m_numBlocks;
+
+            uint32_t m_repeatBlockX[NumParallelBlocks];
+            uint32_t m_repeatSources[NumParallelBlocks];
+            size_t m_numRepeats;
+        };
+
+        template<class TBlock>
+        static void EncodeBlockRowTyped(const EncodeParams &params, const uint8_t *const rows[4], uint32_t width, uint32_t firstBlockX, uint32_t numBlocksInSpan, uint8_t *pBC)
+        {
+            const uint32_t blockSize = Kernels::GetBlockSizeBytes(params.m_format);
+            const uint32_t endBlockX = firstBlockX + numBlocksInSpan;
+
+            if ((params.m_blockCache != NULL && params.m_options->stats == NULL) || params.m_persistentCache != NULL)
+            {
+                PendingBlockBatch<TBlock> pendingBatch(params, pBC, blockSize);
+
+                for (uint32_t blockX = firstBlockX; blockX < endBlockX; blockX++)
+                {
+                    TBlock block;
+                    GatherBlocks(&block, 1, rows, width, blockX);
+                    pendingBatch.AddBlock(block, blockX);
+                }
+
+                pendingBatch.Flush();
+                return;
+            }
+
+            TBlock blocks[NumParallelBlocks];
+
+            for (uint32_t blockX = firstBlockX; blockX < endBlockX; blockX += NumParallelBlocks)
+            {
+                const size_t numBlocks = std::min<size_t>(NumParallelBlocks, endBlockX - blockX);
+
+                GatherBlocks(blocks, numBlocks, rows, width, blockX);
+                EncodeBatch(params, pBC + blockX * blockSize, blocks, numBlocks);
+            }
+        }
+    }
+}
+
+void cvtt::SurfaceEncoding::BlockCache::Reset()
+{
+    for (size_t i = 0; i < kNumEntries; i++)
+        m_entries[i].m_isValid = false;
+}
+
+bool cvtt::SurfaceEncoding::ValidateParams(const EncodeParams &params)
+{
+    if (params.m_options == NULL)
+        return false;
+
+    switch (params.m_format)
+    {
+    case SurfaceFormat_BC7:
+        return params.m_encodingPlan != NULL;
+    case SurfaceFormat_ETC1:
+        return params.m_etc1Data != NULL;
+    case SurfaceFormat_ETC2:
+    case SurfaceFormat_ETC2RGBA:
+    case SurfaceFormat_ETC2PunchthroughAlpha:
+        return params.m_etc2Data != NULL;
+    default:
+        return static_cast<unsigned int>(params.m_format) < SurfaceFormat_Count;
+    }
+}
+
+void cvtt::SurfaceEncoding::EncodeBlockRow(const EncodeParams &params, const uint8_t *const rows[4], uint32_t width, uint8_t *pBC)
+{
+    EncodeBlockRowSpan(params, rows, width, 0, (width + 3) / 4, pBC);
+}
+
+void cvtt::SurfaceEncoding::EncodeBlockRowSpan(const EncodeParams &params, const uint8_t *const rows[4], uint32_t width, uint32_t firstBlockX, uint32_t numBlocks, uint8_t *pBC)
+{
+    assert(firstBlockX + numBlocks <= (width + 3) / 4);
+
+    switch (params.m_format)
+    {
+    case SurfaceFormat_BC4S:
+    case SurfaceFormat_BC5S:
+        EncodeBlockRowTyped<PixelBlockS8>(params, rows, width, firstBlockX, numBlocks, pBC);
+        break;
+    case SurfaceFormat_BC6HU:
+    case SurfaceFormat_BC6HS:
+        EncodeBlockRowTyped<PixelBlockF16>(params, rows, width, firstBlockX, numBlocks, pBC);
+        break;
+    case SurfaceFormat_ETC2Alpha11U:
+    case SurfaceFormat_ETC2Alpha11S:
+        EncodeBlockRowTyped<PixelBlockScalarS16>(params, rows, width, firstBlockX, numBlocks, pBC);
+        break;
+    default:
+        EncodeBlockRowTyped<PixelBlockU8>(params, rows, width, firstBlockX, numBlocks, pBC);
+        break;
+    }
+}
+
+void cvtt::SurfaceEncoding::EncodeBlockRows(const EncodeParams &params, const uint8_t *pixels, size_t rowPitch, uint32_t width, uint32_t height,
+    uint32_t firstBlockRow, uint32_t numBlockRows, uint8_t *pBC, size_t outRowPitch)
+{
+    for (uint32_t blockY = firstBlockRow; blockY < firstBlockRow + numBlockRows; blockY++)
+    {
+        const uint8_t *rows[4];
+        for (uint32_t subY = 0; subY < 4; subY++)
+            rows[subY] = pixels + std::min(blockY * 4 + subY, height - 1) * rowPitch;
+
+        EncodeBlockRow(params, rows, width, pBC + blockY * outRowPitch);
+    }
+}
+
+unsigned int cvtt::Kernels::GetBlockSizeBytes(SurfaceFormat format)
+{
+    switch (format)
+    {
+    case SurfaceFormat_BC1:
+    case SurfaceFormat_BC4U:
+    case SurfaceFormat_BC4S:
+    case SurfaceFormat_ETC1:
+    case SurfaceFormat_ETC2:
+    case SurfaceFormat_ETC2PunchthroughAlpha:
+    case SurfaceFormat_ETC2Alpha:
+    case SurfaceFormat_ETC2Alpha11U:
+    case SurfaceFormat_ETC2Alpha11S:
+        return 8;
+    default:
+        return 16;
+    }
+}
+
+unsigned int cvtt::Kernels::GetSourcePixelSizeBytes(SurfaceFormat format)
+{
+    switch (format)
+    {
+    case SurfaceFormat_BC6HU:
+    case SurfaceFormat_BC6HS:
+        return 8;
+    case SurfaceFormat_ETC2Alpha11U:
+    case SurfaceFormat_ETC2Alpha11S:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+bool cvtt::Kernels::EncodeSurface(SurfaceFormat format, const void *pixels, size_t rowPitch, uint32_t width, uint32_t height, uint8_t *pBC, size_t outRowPitch,
+    const Options &options, const BC7EncodingPlan *encodingPlan, ETC1CompressionData *etc1Data, ETC2CompressionData *etc2Data)
+{
+    BC7EncodingPlan defaultEncodingPlan;
+
+    SurfaceEncoding::EncodeParams params;
+    params.m_format = format;
+    params.m_options = &options;
+    params.m_encodingPlan = encodingPlan ? encodingPlan : &defaultEncodingPlan;
+    params.m_etc1Data = etc1Data;
+    params.m_etc2Data = etc2Data;
+    params.m_blockCache = NULL;
+
+    if (!SurfaceEncoding::ValidateParams(params) || pixels == NULL || pBC == NULL)
+        return false;
+
+    if (width == 0 || height == 0)
+        return true;
+
+    SurfaceEncoding::InitPersistentCacheParams(params, NULL);
+
+    // Small surfaces, like the last few mip levels, don't have enough blocks to be worth setting up the cache for
+    const size_t numSurfaceBlocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+    if (numSurfaceBlocks > NumParallelBlocks * 4)
+    {
+        params.m_blockCache = static_cast<SurfaceEncoding::BlockCache*>(malloc(sizeof(SurfaceEncoding::BlockCache)));
+        if (params.m_blockCache)
+            params.m_blockCache->Reset();
+    }
+
+    SurfaceEncoding::EncodeBlockRows(params, static_cast<const uint8_t*>(pixels), rowPitch, width, height, 0, (height + 3) / 4, pBC, outRowPitch);
+
+    free(params.m_blockCache);
+
+    return true;
+}
+
+namespace cvtt
+{
+    namespace SurfaceDecoding
+    {
+        static float HalfToFloat(uint16_t half)
+        {
+            const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+            const uint32_t exponent = (half >> 10) & 0x1f;
+            const uint32_t mantissa = half & 0x3ff;
+
+            if (exponent == 0)
+            {
+                // Zero or denormal
+                const float value = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+                return sign ? -value : value;
+            }
+
+            uint32_t bits = 0;
+            if (exponent == 31)
+                bits = sign | 0x7f800000u | (mantissa << 13);
+            else
+                bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+            float value;
+            memcpy(&value, &bits, 4);
+            return value;
+        }
+    }
+}
+
+bool cvtt::Kernels::DecodeBC6HSurface(const uint8_t *pBC, size_t bcRowPitch, uint32_t width, uint32_t height, bool isSigned,
+    HDRSurfaceFormat format, void *pixels, size_t rowPitch)
+{
+    if (pBC == NULL || pixels == NULL)
+        return false;
+
+    if (format != HDRSurfaceFormat_RGBA16F && format != HDRSurfaceFormat_RGB32F)
+        return false;
+
+    const uint32_t widthInBlocks = (width + 3) / 4;
+    const uint32_t heightInBlocks = (height + 3) / 4;
+
+    if (widthInBlocks == 0 || heightInBlocks == 0)
+        return true;
+
+    // Blocks are decoded a span of a row at a time, which is enough to fill several SIMD groups of each common mode.
+    // The span is too large for the stack with wide instruction sets, so it's allocated.
+    const uint32_t maxSpanBlocks = std::min<uint32_t>(NumParallelBlocks * 16, widthInBlocks);
+    PixelBlockF16 *decoded = static_cast<PixelBlockF16*>(malloc(sizeof(PixelBlockF16) * maxSpanBlocks));
+    if (decoded == NULL)
+        return false;
+
+    for (uint32_t blockY = 0; blockY < heightInBlocks; blockY++)
+    {
+        const uint8_t *rowBC = pBC + blockY * bcRowPitch;
+        const uint32_t numRows = std::min<uint32_t>(4, height - blockY * 4);
+
+        for (uint32_t spanX = 0; spanX < widthInBlocks; spanX += maxSpanBlocks)
+        {
+            const uint32_t numSpanBlocks = std::min(maxSpanBlocks, widthInBlocks - spanX);
+
+            if (isSigned)
+                DecodeBC6HSBatch(decoded, rowBC + spanX * 16, numSpanBlocks);
+            else
+                DecodeBC6HUBatch(decoded, rowBC + spanX * 16, numSpanBlocks);
+
+            for (uint32_t subY = 0; subY < numRows; subY++)
+            {
+                uint8_t *row = static_cast<uint8_t*>(pixels) + (blockY * 4 + subY) * rowPitch;
+
+                for (uint32_t block = 0; block < numSpanBlocks; block++)
+                {
+                    const uint32_t x = (spanX + block) * 4;
+                    const uint32_t numColumns = std::min<uint32_t>(4, width - x);
+                    const int16_t (*blockPixels)[4] = decoded[block].m_pixels + subY * 4;
+
+                    if (format == HDRSurfaceFormat_RGBA16F)
+                        memcpy(row + x * 8, blockPixels, numColumns * 8);
+                    else
+                    {
+                        float *outPixels = reinterpret_cast<float*>(row) + x * 3;
+                        for (uint32_t subX = 0; subX < numColumns; subX++)
+                        {
+                            for (int ch = 0; ch < 3; ch++)
+                                outPixels[subX * 3 + ch] = SurfaceDecoding::HalfToFloat(static_cast<uint16_t>(blockPixels[subX][ch]));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    free(decoded);
+
+    return true;
+}
+
+#endif
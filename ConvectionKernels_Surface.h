@@ -0,0 +1,95 @@
+#pragma once
+#ifndef __CVTT_SURFACE_H__
+#define __CVTT_SURFACE_H__
+
+#include "ConvectionKernels.h"
+
+#include <mutex>
+
+namespace cvtt
+{
+    // Layout of a persistent block cache.  The header is followed by the entries.
+    struct PersistentBlockCache
+    {
+        static const uint32_t kVersion = 1;
+
+        struct Entry
+        {
+            uint64_t m_configKey;
+            uint32_t m_blockHash;
+            uint32_t m_isValid;
+            uint8_t m_sourceBlock[sizeof(PixelBlockF16)];
+            uint8_t m_outputBlock[16];
+        };
+
+        char m_magic[4];
+        uint32_t m_version;
+        uint32_t m_entrySize;
+        uint32_t m_numEntries;
+
+        Entry *GetEntries()
+        {
+            return reinterpret_cast<Entry*>(this + 1);
+        }
+    };
+
+    namespace SurfaceEncoding
+    {
+        // Output of recently encoded blocks, so that solid areas and repeated tiles are only encoded once.  Entries are found by
+        // a hash of the source block, and a new block replaces whatever was in its slot.
+        struct BlockCache
+        {
+            static const size_t kNumEntries = 512;
+            static const size_t kMaxSourceBlockSize = sizeof(PixelBlockF16);
+            static const size_t kMaxOutputBlockSize = 16;
+
+            struct Entry
+            {
+                uint8_t m_sourceBlock[kMaxSourceBlockSize];
+                uint8_t m_outputBlock[kMaxOutputBlockSize];
+                uint32_t m_hash;
+                bool m_isValid;
+            };
+
+            Entry m_entries[kNumEntries];
+
+            void Reset();
+        };
+
+        struct EncodeParams
+        {
+            SurfaceFormat m_format;
+            const Options *m_options;
+            const BC7EncodingPlan *m_encodingPlan;
+            ETC1CompressionData *m_etc1Data;
+            ETC2CompressionData *m_etc2Data;
+            BlockCache *m_blockCache;   // Optional.  Not used if m_options->stats is set, since repeated blocks wouldn't be counted.
+
+            PersistentBlockCache *m_persistentCache;    // Set by InitPersistentCacheParams
+            uint64_t m_persistentCacheKey;
+            std::mutex *m_persistentCacheMutex;         // Needed if multiple threads encode with the same persistent cache
+        };
+
+        // Sets up the persistent cache from the options.  Call once the other params are set.
+        void InitPersistentCacheParams(EncodeParams &params, std::mutex *persistentCacheMutex);
+
+        // Copies a block's output from the persistent cache, returns false if it isn't there
+        bool LookupPersistentBlock(const EncodeParams &params, uint32_t blockHash, const void *sourceBlock, size_t sourceBlockSize, uint8_t *outputBlock, size_t outputBlockSize);
+        void StorePersistentBlock(const EncodeParams &params, uint32_t blockHash, const void *sourceBlock, size_t sourceBlockSize, const uint8_t *outputBlock, size_t outputBlockSize);
+
+        // Returns true if the params have everything the format needs
+        bool ValidateParams(const EncodeParams &params);
+
+        // Encodes one row of blocks from 4 rows of source pixels.  Rows past the bottom of the surface should repeat the last row.
+        void EncodeBlockRow(const EncodeParams &params, const uint8_t *const rows[4], uint32_t width, uint8_t *pBC);
+
+        // Encodes numBlocks blocks of a row of blocks, starting at firstBlockX.  pBC points to the output for the first block in the row.
+        void EncodeBlockRowSpan(const EncodeParams &params, const uint8_t *const rows[4], uint32_t width, uint32_t firstBlockX, uint32_t numBlocks, uint8_t *pBC);
+
+        // Encodes a range of block rows from a whole surface
+        void EncodeBlockRows(const EncodeParams &params, const uint8_t *pixels, size_t rowPitch, uint32_t width, uint32_t height,
+            uint32_t firstBlockRow, uint32_t numBlockRows, uint8_t *pBC, size_t outRowPitch);
+    }
+}
+
+#endif
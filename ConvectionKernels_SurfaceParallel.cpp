@@ -0,0 +1,253 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels_Surface.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace cvtt
+{
+    namespace SurfaceEncoding
+    {
+        // Tiles are a horizontal span of one block row.  This is wide enough that the shared tile counter isn't touched often,
+        // but small enough that a 4K surface still splits into thousands of tiles so that workers finish at about the same time.
+        static const uint32_t kTileBlocksWide = NumParallelBlocks * 4;
+
+        struct ParallelEncodeJob
+        {
+            EncodeParams m_params;
+            const uint8_t *m_pixels;
+            size_t m_rowPitch;
+            uint32_t m_width;
+            uint32_t m_height;
+            uint8_t *m_pBC;
+            size_t m_outRowPitch;
+
+            uint32_t m_numBlocksWide;
+            uint32_t m_numTilesWide;
+            uint32_t m_numTiles;
+
+            ETC1CompressionData **m_etc1Data;
+            ETC2CompressionData **m_etc2Data;
+            EncodingStats *m_workerStats;
+            BlockCache *m_workerBlockCaches;
+            std::mutex m_persistentCacheMutex;
+
+            std::atomic<uint32_t> m_nextTile;
+        };
+
+        static void *MallocShim(void *context, size_t size)
+        {
+            (void)context;
+            return malloc(size);
+        }
+
+        static void FreeShim(void *context, void *ptr, size_t size)
+        {
+            (void)context;
+            (void)size;
+            free(ptr);
+        }
+
+        static void RunParallelEncodeWorker(void *taskData, unsigned int workerIndex)
+        {
+            ParallelEncodeJob &job = *static_cast<ParallelEncodeJob*>(taskData);
+
+            EncodeParams params = job.m_params;
+            if (job.m_etc1Data)
+                params.m_etc1Data = job.m_etc1Data[workerIndex];
+            if (job.m_etc2Data)
+                params.m_etc2Data = job.m_etc2Data[workerIndex];
+            if (job.m_workerBlockCaches)
+            {
+                params.m_blockCache = &job.m_workerBlockCaches[workerIndex];
+                params.m_blockCache->Reset();
+            }
+
+            // Workers count into their own stats, which are merged once all of them have finished
+            Options workerOptions = *params.m_options;
+            if (job.m_workerStats)
+            {
+                workerOptions.stats = &job.m_workerStats[workerIndex];
+                params.m_options = &workerOptions;
+            }
+
+            for (;;)
+            {
+                const uint32_t tile = job.m_nextTile.fetch_add(1, std::memory_order_relaxed);
+                if (tile >= job.m_numTiles)
+                    break;
+
+                const uint32_t blockY = tile / job.m_numTilesWide;
+                const uint32_t firstBlockX = (tile % job.m_numTilesWide) * kTileBlocksWide;
+                const uint32_t numBlocks = std::min(kTileBlocksWide, job.m_numBlocksWide - firstBlockX);
+
+                const uint8_t *rows[4];
+                for (uint32_t subY = 0; subY < 4; subY++)
+                    rows[subY] = job.m_pixels + std::min(blockY * 4 + subY, job.m_height - 1) * job.m_rowPitch;
+
+                EncodeBlockRowSpan(params, rows, job.m_width, firstBlockX, numBlocks, job.m_pBC + blockY * job.m_outRowPitch);
+            }
+        }
+
+        static void RunParallelEncodeWorkers(ParallelEncodeJob &job, unsigned int numWorkers)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(numWorkers - 1);
+
+            // If a thread can't be started, the workers that are running pick up its tiles
+            for (unsigned int workerIndex = 1; workerIndex < numWorkers; workerIndex++)
+            {
+                try
+                {
+                    threads.push_back(std::thread(RunParallelEncodeWorker, static_cast<void*>(&job), workerIndex));
+                }
+                catch (...)
+                {
+                    break;
+                }
+            }
+
+            RunParallelEncodeWorker(&job, 0);
+
+            for (size_t i = 0; i < threads.size(); i++)
+                threads[i].join();
+        }
+    }
+}
+
+bool cvtt::Kernels::EncodeSurfaceParallel(SurfaceFormat format, const void *pixels, size_t rowPitch, uint32_t width, uint32_t height, uint8_t *pBC, size_t outRowPitch,
+    const Options &options, const ParallelEncodeOptions &parallelOptions, const BC7EncodingPlan *encodingPlan)
+{
+    BC7EncodingPlan defaultEncodingPlan;
+
+    const bool needsETC1Data = (format == SurfaceFormat_ETC1);
+    const bool needsETC2Data = (format == SurfaceFormat_ETC2 || format == SurfaceFormat_ETC2RGBA || format == SurfaceFormat_ETC2PunchthroughAlpha);
+
+    SurfaceEncoding::ParallelEncodeJob job;
+    job.m_params.m_format = format;
+    job.m_params.m_options = &options;
+    job.m_params.m_encodingPlan = encodingPlan ? encodingPlan : &defaultEncodingPlan;
+    job.m_params.m_etc1Data = NULL;
+    job.m_params.m_etc2Data = NULL;
+    job.m_params.m_blockCache = NULL;
+    job.m_params.m_persistentCache = NULL;
+
+    if (static_cast<unsigned int>(format) >= SurfaceFormat_Count || pixels == NULL || pBC == NULL)
+        return false;
+
+    if ((parallelOptions.allocFunc == NULL) != (parallelOptions.freeFunc == NULL))
+        return false;
+
+    if (width == 0 || height == 0)
+        return true;
+
+    job.m_pixels = static_cast<const uint8_t*>(pixels);
+    job.m_rowPitch = rowPitch;
+    job.m_width = width;
+    job.m_height = height;
+    job.m_pBC = pBC;
+    job.m_outRowPitch = outRowPitch;
+    job.m_numBlocksWide = (width + 3) / 4;
+    job.m_numTilesWide = (job.m_numBlocksWide + SurfaceEncoding::kTileBlocksWide - 1) / SurfaceEncoding::kTileBlocksWide;
+    job.m_numTiles = job.m_numTilesWide * ((height + 3) / 4);
+    job.m_etc1Data = NULL;
+    job.m_etc2Data = NULL;
+    job.m_workerStats = NULL;
+    job.m_workerBlockCaches = NULL;
+    job.m_nextTile.store(0, std::memory_order_relaxed);
+
+    SurfaceEncoding::InitPersistentCacheParams(job.m_params, &job.m_persistentCacheMutex);
+
+    unsigned int numWorkers = parallelOptions.numThreads;
+    if (numWorkers == 0)
+        numWorkers = std::max(1u, std::thread::hardware_concurrency());
+    numWorkers = std::min(numWorkers, job.m_numTiles);
+
+    allocFunc_t *allocFunc = parallelOptions.allocFunc ? parallelOptions.allocFunc : SurfaceEncoding::MallocShim;
+    freeFunc_t *freeFunc = parallelOptions.freeFunc ? parallelOptions.freeFunc : SurfaceEncoding::FreeShim;
+
+    std::vector<ETC1CompressionData*> etc1Data(needsETC1Data ? numWorkers : 0, static_cast<ETC1CompressionData*>(NULL));
+    std::vector<ETC2CompressionData*> etc2Data(needsETC2Data ? numWorkers : 0, static_cast<ETC2CompressionData*>(NULL));
+    std::vector<EncodingStats> workerStats(options.stats ? numWorkers : 0);
+    std::vector<SurfaceEncoding::BlockCache> workerBlockCaches(options.stats ? 0 : numWorkers);
+
+    bool allocatedAll = true;
+    for (size_t i = 0; i < etc1Data.size() && allocatedAll; i++)
+    {
+        etc1Data[i] = AllocETC1Data(allocFunc, parallelOptions.allocContext);
+        allocatedAll = (etc1Data[i] != NULL);
+    }
+    for (size_t i = 0; i < etc2Data.size() && allocatedAll; i++)
+    {
+        etc2Data[i] = AllocETC2Data(allocFunc, parallelOptions.allocContext, options);
+        allocatedAll = (etc2Data[i] != NULL);
+    }
+
+    if (allocatedAll)
+    {
+        if (needsETC1Data)
+            job.m_etc1Data = &etc1Data[0];
+        if (needsETC2Data)
+            job.m_etc2Data = &etc2Data[0];
+        if (options.stats)
+            job.m_workerStats = &workerStats[0];
+        else
+            job.m_workerBlockCaches = &workerBlockCaches[0];
+
+        if (parallelOptions.runTasksFunc)
+            parallelOptions.runTasksFunc(parallelOptions.runTasksContext, SurfaceEncoding::RunParallelEncodeWorker, &job, numWorkers);
+        else
+            SurfaceEncoding::RunParallelEncodeWorkers(job, numWorkers);
+
+        assert(job.m_nextTile.load() >= job.m_numTiles);
+
+        for (size_t i = 0; i < workerStats.size(); i++)
+            MergeEncodingStats(*options.stats, workerStats[i]);
+    }
+
+    for (size_t i = 0; i < etc1Data.size(); i++)
+    {
+        if (etc1Data[i])
+            ReleaseETC1Data(etc1Data[i], freeFunc);
+    }
+    for (size_t i = 0; i < etc2Data.size(); i++)
+    {
+        if (etc2Data[i])
+            ReleaseETC2Data(etc2Data[i], freeFunc);
+    }
+
+    return allocatedAll;
+}
+
+#endif
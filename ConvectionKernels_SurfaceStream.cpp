@@ -0,0 +1,249 @@
+/*
+Convection Texture Tools
+Copyright (c) 2018-2019 Eric Lasota
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject
+to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#include "ConvectionKernels_Config.h"
+
+#if !defined(CVTT_SINGLE_FILE) || defined(CVTT_SINGLE_FILE_IMPL)
+
+#include "ConvectionKernels_Surface.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+
+namespace cvtt
+{
+    namespace SurfaceEncoding
+    {
+        class SurfaceStreamEncoderInternal : public SurfaceStreamEncoder
+        {
+        public:
+            static const size_t kAlignment = 16;
+
+            SurfaceStreamEncoderInternal(void *context, void *allocation, size_t allocationSize, SurfaceFormat format, uint32_t width, uint32_t height,
+                const Options &options, const BC7EncodingPlan &encodingPlan, Kernels::surfaceStreamSinkFunc_t *sinkFunc, void *sinkContext);
+
+            static size_t GetBandSize(SurfaceFormat format, uint32_t width);
+            static size_t GetBlockRowSize(SurfaceFormat format, uint32_t width);
+
+            bool PushRows(const uint8_t *pixels, size_t rowPitch, uint32_t numRows);
+
+            void *m_context;
+            void *m_allocation;
+            size_t m_allocationSize;
+
+            Options m_options;
+            BC7EncodingPlan m_encodingPlan;
+            EncodeParams m_params;
+
+            Kernels::surfaceStreamSinkFunc_t *m_sinkFunc;
+            void *m_sinkContext;
+
+            uint32_t m_width;
+            uint32_t m_height;
+            uint32_t m_numRowsReceived;
+            uint32_t m_nextBlockRow;
+            uint32_t m_numBandRows;
+
+            size_t m_sourceRowSize;
+            size_t m_blockRowSize;
+            uint8_t *m_band;
+            uint8_t *m_blockRow;
+
+        private:
+            void EncodeBand(const uint8_t *const bandRows[4], uint32_t numRows);
+        };
+    }
+}
+
+cvtt::SurfaceEncoding::SurfaceStreamEncoderInternal::SurfaceStreamEncoderInternal(void *context, void *allocation, size_t allocationSize, SurfaceFormat format, uint32_t width, uint32_t height,
+    const Options &options, const BC7EncodingPlan &encodingPlan, Kernels::surfaceStreamSinkFunc_t *sinkFunc, void *sinkContext)
+    : m_context(context)
+    , m_allocation(allocation)
+    , m_allocationSize(allocationSize)
+    , m_options(options)
+    , m_encodingPlan(encodingPlan)
+    , m_sinkFunc(sinkFunc)
+    , m_sinkContext(sinkContext)
+    , m_width(width)
+    , m_height(height)
+    , m_numRowsReceived(0)
+    , m_nextBlockRow(0)
+    , m_numBandRows(0)
+    , m_sourceRowSize(static_cast<size_t>(width) * Kernels::GetSourcePixelSizeBytes(format))
+    , m_blockRowSize(GetBlockRowSize(format, width))
+{
+    m_params.m_format = format;
+    m_params.m_options = &m_options;
+    m_params.m_encodingPlan = &m_encodingPlan;
+    m_params.m_etc1Data = NULL;
+    m_params.m_etc2Data = NULL;
+
+    m_params.m_blockCache = reinterpret_cast<BlockCache*>(reinterpret_cast<uint8_t*>(this) + sizeof(SurfaceStreamEncoderInternal));
+    m_params.m_blockCache->Reset();
+
+    InitPersistentCacheParams(m_params, NULL);
+
+    m_band = reinterpret_cast<uint8_t*>(m_params.m_blockCache) + sizeof(BlockCache);
+    m_blockRow = m_band + GetBandSize(format, width);
+}
+
+size_t cvtt::SurfaceEncoding::SurfaceStreamEncoderInternal::GetBandSize(SurfaceFormat format, uint32_t width)
+{
+    return static_cast<size_t>(width) * Kernels::GetSourcePixelSizeBytes(format) * 4;
+}
+
+size_t cvtt::SurfaceEncoding::SurfaceStreamEncoderInternal::GetBlockRowSize(SurfaceFormat format, uint32_t width)
+{
+    return static_cast<size_t>((width + 3) / 4) * Kernels::GetBlockSizeBytes(format);
+}
+
+void cvtt::SurfaceEncoding::SurfaceStreamEncoderInternal::EncodeBand(const uint8_t *const bandRows[4], uint32_t numRows)
+{
+    const uint8_t *rows[4];
+    for (uint32_t subY = 0; subY < 4; subY++)
+        rows[subY] = bandRows[std::min(subY, numRows - 1)];
+
+    EncodeBlockRow(m_params, rows, m_width, m_blockRow);
+    m_sinkFunc(m_sinkContext, m_nextBlockRow, m_blockRow, m_blockRowSize);
+
+    m_nextBlockRow++;
+}
+
+bool cvtt::SurfaceEncoding::SurfaceStreamEncoderInternal::PushRows(const uint8_t *pixels, size_t rowPitch, uint32_t numRows)
+{
+    if (numRows > m_height - m_numRowsReceived)
+        return false;
+
+    m_numRowsReceived += numRows;
+
+    while (numRows > 0)
+    {
+        const uint32_t numRowsInBand = std::min<uint32_t>(4, m_height - m_nextBlockRow * 4);
+
+        const uint8_t *bandRows[4];
+
+        if (m_numBandRows == 0 && numRows >= numRowsInBand)
+        {
+            // Whole band is available, encode straight from the source rows
+            for (uint32_t subY = 0; subY < numRowsInBand; subY++)
+                bandRows[subY] = pixels + subY * rowPitch;
+
+            pixels += numRowsInBand * rowPitch;
+            numRows -= numRowsInBand;
+        }
+        else
+        {
+            const uint32_t numRowsToCopy = std::min(numRows, numRowsInBand - m_numBandRows);
+            for (uint32_t i = 0; i < numRowsToCopy; i++)
+            {
+                memcpy(m_band + m_numBandRows * m_sourceRowSize, pixels, m_sourceRowSize);
+                m_numBandRows++;
+                pixels += rowPitch;
+            }
+            numRows -= numRowsToCopy;
+
+            if (m_numBandRows < numRowsInBand)
+                break;
+
+            for (uint32_t subY = 0; subY < numRowsInBand; subY++)
+                bandRows[subY] = m_band + subY * m_sourceRowSize;
+
+            m_numBandRows = 0;
+        }
+
+        EncodeBand(bandRows, numRowsInBand);
+    }
+
+    return true;
+}
+
+cvtt::SurfaceStreamEncoder *cvtt::Kernels::AllocSurfaceStreamEncoder(allocFunc_t allocFunc, freeFunc_t freeFunc, void *context, SurfaceFormat format, uint32_t width, uint32_t height,
+    const Options &options, const BC7EncodingPlan *encodingPlan, surfaceStreamSinkFunc_t *sinkFunc, void *sinkContext)
+{
+    typedef SurfaceEncoding::SurfaceStreamEncoderInternal SurfaceStreamEncoderInternal;
+
+    if (static_cast<unsigned int>(format) >= SurfaceFormat_Count || allocFunc == NULL || freeFunc == NULL || sinkFunc == NULL || width == 0 || height == 0)
+        return NULL;
+
+    const size_t alignment = SurfaceStreamEncoderInternal::kAlignment;
+    const size_t allocationSize = sizeof(SurfaceStreamEncoderInternal) + sizeof(SurfaceEncoding::BlockCache) + SurfaceStreamEncoderInternal::GetBandSize(format, width)
+        + SurfaceStreamEncoderInternal::GetBlockRowSize(format, width) + alignment - 1;
+
+    void *buffer = allocFunc(context, allocationSize);
+    if (!buffer)
+        return NULL;
+
+    BC7EncodingPlan defaultEncodingPlan;
+
+    void *alignedBuffer = reinterpret_cast<void*>((reinterpret_cast<size_t>(buffer) + alignment - 1) & ~(alignment - 1));
+    SurfaceStreamEncoderInternal *encoder = new (alignedBuffer) SurfaceStreamEncoderInternal(context, buffer, allocationSize, format, width, height,
+        options, encodingPlan ? *encodingPlan : defaultEncodingPlan, sinkFunc, sinkContext);
+
+    bool allocatedAll = true;
+    if (format == SurfaceFormat_ETC1)
+    {
+        encoder->m_params.m_etc1Data = AllocETC1Data(allocFunc, context);
+        allocatedAll = (encoder->m_params.m_etc1Data != NULL);
+    }
+    else if (format == SurfaceFormat_ETC2 || format == SurfaceFormat_ETC2RGBA || format == SurfaceFormat_ETC2PunchthroughAlpha)
+    {
+        encoder->m_params.m_etc2Data = AllocETC2Data(allocFunc, context, options);
+        allocatedAll = (encoder->m_params.m_etc2Data != NULL);
+    }
+
+    if (!allocatedAll)
+    {
+        ReleaseSurfaceStreamEncoder(encoder, freeFunc);
+        return NULL;
+    }
+
+    return encoder;
+}
+
+void cvtt::Kernels::ReleaseSurfaceStreamEncoder(SurfaceStreamEncoder *encoder, freeFunc_t freeFunc)
+{
+    SurfaceEncoding::SurfaceStreamEncoderInternal *internalEncoder = static_cast<SurfaceEncoding::SurfaceStreamEncoderInternal*>(encoder);
+
+    if (internalEncoder->m_params.m_etc1Data)
+        ReleaseETC1Data(internalEncoder->m_params.m_etc1Data, freeFunc);
+    if (internalEncoder->m_params.m_etc2Data)
+        ReleaseETC2Data(internalEncoder->m_params.m_etc2Data, freeFunc);
+
+    void *context = internalEncoder->m_context;
+    void *allocation = internalEncoder->m_allocation;
+    size_t allocationSize = internalEncoder->m_allocationSize;
+    internalEncoder->~SurfaceStreamEncoderInternal();
+    freeFunc(context, allocation, allocationSize);
+}
+
+bool cvtt::Kernels::PushSurfaceStreamRows(SurfaceStreamEncoder *encoder, const void *pixels, size_t rowPitch, uint32_t numRows)
+{
+    if (numRows > 0 && pixels == NULL)
+        return false;
+
+    return static_cast<SurfaceEncoding::SurfaceStreamEncoderInternal*>(encoder)->PushRows(static_cast<const uint8_t*>(pixels), rowPitch, numRows);
+}
+
+#endif
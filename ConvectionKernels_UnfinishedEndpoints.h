@@ -4,6 +4,7 @@
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Internal
     {
         template<int TVectorSize>
@@ -36,6 +37,26 @@ namespace cvtt
                     m_offset[ch] = other.m_offset[ch];
             }
 
+            UnfinishedEndpoints& operator=(const UnfinishedEndpoints& other)
+            {
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    m_base[ch] = other.m_base[ch];
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    m_offset[ch] = other.m_offset[ch];
+
+                return *this;
+            }
+
+            void ConditionalSet(const ParallelMath::Int16CompFlag &flag, const UnfinishedEndpoints& other)
+            {
+                ParallelMath::FloatCompFlag floatFlag = ParallelMath::Int16FlagToFloat(flag);
+
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    ParallelMath::ConditionalSet(m_base[ch], floatFlag, other.m_base[ch]);
+                for (int ch = 0; ch < TVectorSize; ch++)
+                    ParallelMath::ConditionalSet(m_offset[ch], floatFlag, other.m_offset[ch]);
+            }
+
             void FinishHDRUnsigned(int tweak, int range, MSInt16 *outEP0, MSInt16 *outEP1, ParallelMath::RoundTowardNearestForScope *roundingMode)
             {
                 float tweakFactors[2];
@@ -118,4 +139,5 @@ namespace cvtt
             MFloat m_offset[TVectorSize];
         };
     }
+    CVTT_ISA_NAMESPACE_END
 }
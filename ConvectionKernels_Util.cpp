@@ -36,11 +36,11 @@ http://go.microsoft.com/fwlink/?LinkId=248926
 
 #include "ConvectionKernels.h"
 #include "ConvectionKernels_ParallelMath.h"
-
-#include <algorithm>
+#include "ConvectionKernels_Util.h"
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Util
     {
         // Signed input blocks are converted into unsigned space, with the maximum value being 254
@@ -54,7 +54,7 @@ namespace cvtt
                 for (size_t px = 0; px < 16; px++)
                 {
                     for (size_t ch = 0; ch < 4; ch++)
-                        inputNormalizedBlock.m_pixels[px][ch] = static_cast<uint8_t>(std::max<int>(inputSignedBlock.m_pixels[px][ch], -127) + 127);
+                        inputNormalizedBlock.m_pixels[px][ch] = static_cast<uint8_t>(Util::Max<int>(inputSignedBlock.m_pixels[px][ch], -127) + 127);
                 }
             }
         }
@@ -83,6 +83,7 @@ namespace cvtt
             outFactors[1] = static_cast<float>(maxOutsideUnits) / static_cast<float>(insideUnits) + 1.0f;
         }
     }
+    CVTT_ISA_NAMESPACE_END
 }
 
 #endif
@@ -11,11 +11,68 @@ namespace cvtt
 
 namespace cvtt
 {
+    CVTT_ISA_NAMESPACE_BEGIN
     namespace Util
     {
         // Signed input blocks are converted into unsigned space, with the maximum value being 254
         void BiasSignedInput(PixelBlockU8 inputNormalized[ParallelMath::ParallelSize], const PixelBlockS8 inputSigned[ParallelMath::ParallelSize]);
         void FillWeights(const Options &options, float channelWeights[4]);
         void ComputeTweakFactors(int tweak, int range, float *outFactors);
+
+        // Scalar helpers used instead of <algorithm> so that code compiled for each ISA stays in its own namespace
+        template<class T>
+        inline T Min(T a, T b)
+        {
+            return (b < a) ? b : a;
+        }
+
+        template<class T>
+        inline T Max(T a, T b)
+        {
+            return (a < b) ? b : a;
+        }
+
+        template<class T>
+        inline void Swap(T &a, T &b)
+        {
+            T temp = a;
+            a = b;
+            b = temp;
+        }
+
+        template<class T, class TPredicate>
+        inline void SiftDown(T *values, size_t root, size_t count, const TPredicate &pred)
+        {
+            T value = values[root];
+            for (;;)
+            {
+                size_t child = root * 2 + 1;
+                if (child >= count)
+                    break;
+                if (child + 1 < count && pred(values[child], values[child + 1]))
+                    child++;
+                if (!pred(value, values[child]))
+                    break;
+                values[root] = values[child];
+                root = child;
+            }
+            values[root] = value;
+        }
+
+        // Heap sort, pred must be a strict total order for the result to be deterministic
+        template<class T, class TPredicate>
+        inline void Sort(T *begin, T *end, const TPredicate &pred)
+        {
+            const size_t count = static_cast<size_t>(end - begin);
+            for (size_t i = count / 2; i > 0; i--)
+                SiftDown(begin, i - 1, count, pred);
+
+            for (size_t i = count; i > 1; i--)
+            {
+                Swap(begin[0], begin[i - 1]);
+                SiftDown(begin, 0, i - 1, pred);
+            }
+        }
     }
+    CVTT_ISA_NAMESPACE_END
 }
@@ -0,0 +1,66 @@
+// Generates ConvectionKernels_BC7_QualityPlans.h, which holds the serialized BC7 encoding plan for each quality level.  Run it again
+// whenever the priority lists, ConfigureBC7EncodingPlanFromFineTuningParams, or the plan serialization format change.  It must be built
+// with CVTT_NO_PRECOMPUTED_BC7_PLANS defined so that the plans are generated from the priority lists, e.g. from the repository root:
+//   g++ -O2 -DCVTT_SINGLE_FILE -DCVTT_NO_PRECOMPUTED_BC7_PLANS -I. MakeTables/MakeBC7QualityPlans.cpp ConvectionKernels_SingleFile.cpp -o MakeBC7QualityPlans
+//   ./MakeBC7QualityPlans ConvectionKernels_BC7_QualityPlans.h
+
+#include <stdio.h>
+
+#include "../ConvectionKernels.h"
+
+#if !defined(CVTT_NO_PRECOMPUTED_BC7_PLANS)
+#error "MakeBC7QualityPlans must be built with CVTT_NO_PRECOMPUTED_BC7_PLANS defined"
+#endif
+
+int main(int argc, const char **argv)
+{
+    static const int kNumQualityLevels = 100;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: MakeBC7QualityPlans <output header>\n");
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "wb");
+    if (!f)
+    {
+        fprintf(stderr, "Could not open %s for writing\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "#pragma once\r\n");
+    fprintf(f, "#include <stdint.h>\r\n");
+    fprintf(f, "\r\n");
+    fprintf(f, "// This file is generated by MakeBC7QualityPlans.  Do not edit this file manually.\r\n");
+    fprintf(f, "\r\n");
+    fprintf(f, "namespace cvtt { namespace Tables { namespace BC7QualityPlans {\r\n");
+    fprintf(f, "    const int g_numQualityLevels = %i;\r\n", kNumQualityLevels);
+    fprintf(f, "    const uint8_t g_serializedPlans[%i][%i] =\r\n", kNumQualityLevels, cvtt::BC7EncodingPlan::kSerializedSize);
+    fprintf(f, "    {\r\n");
+
+    for (int quality = 1; quality <= kNumQualityLevels; quality++)
+    {
+        cvtt::BC7EncodingPlan plan;
+        cvtt::Kernels::ConfigureBC7EncodingPlanFromQuality(plan, quality);
+
+        uint8_t serialized[cvtt::BC7EncodingPlan::kSerializedSize];
+        cvtt::Kernels::SerializeBC7EncodingPlan(plan, serialized);
+
+        fprintf(f, "        // Quality %i\r\n", quality);
+        fprintf(f, "        {");
+        for (int i = 0; i < cvtt::BC7EncodingPlan::kSerializedSize; i++)
+        {
+            if (i % 25 == 0)
+                fprintf(f, "\r\n            ");
+            fprintf(f, "%i,", serialized[i]);
+        }
+        fprintf(f, "\r\n        },\r\n");
+    }
+
+    fprintf(f, "    };\r\n");
+    fprintf(f, "}}}\r\n");
+
+    fclose(f);
+    return 0;
+}
@@ -30,7 +30,7 @@ namespace MakeTables
             if (parityBits == 2)
                 parityBitsCombined += (parityBitMax << 1);
 
-            w.WriteLine("Table " + name + "=");
+            w.WriteLine("const Table " + name + "=");
             w.WriteLine("{");
             w.WriteLine("    " + targetIndex + ",");
             w.WriteLine("    " + parityBitsCombined + ",");
@@ -94,7 +94,7 @@ namespace MakeTables
 
         static void EmitTable(StreamWriter w, int bits, int maxIndex, double paranoia, string name)
         {
-            w.WriteLine("TableEntry " + name + "[256] =");
+            w.WriteLine("const TableEntry " + name + "[256] =");
             w.WriteLine("{");
 
             int epRange = 1 << bits;
@@ -0,0 +1,589 @@
+// Benchmark for the CVTT encoders.  Encodes deterministic synthetic images with each format, quality tier, BC7 encoding plan
+// quality level, and thread count, and writes the throughput of each run as JSON.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "../ConvectionKernels.h"
+
+enum SourceType
+{
+    SourceType_U8,
+    SourceType_S8,
+    SourceType_F16,
+    SourceType_S16,
+};
+
+enum CorpusKind
+{
+    CorpusKind_Gradient,
+    CorpusKind_Noise,
+    CorpusKind_NormalMap,
+    CorpusKind_AlphaCutout,
+    CorpusKind_HDRRamp,
+
+    CorpusKind_Count
+};
+
+struct FormatInfo
+{
+    cvtt::SurfaceFormat m_format;
+    const char *m_name;
+    const char *m_functionName;
+    SourceType m_sourceType;
+};
+
+struct TierInfo
+{
+    const char *m_name;
+    uint32_t m_flags;
+};
+
+static const FormatInfo g_formats[] =
+{
+    { cvtt::SurfaceFormat_BC1, "bc1", "EncodeBC1", SourceType_U8 },
+    { cvtt::SurfaceFormat_BC2, "bc2", "EncodeBC2", SourceType_U8 },
+    { cvtt::SurfaceFormat_BC3, "bc3", "EncodeBC3", SourceType_U8 },
+    { cvtt::SurfaceFormat_BC4U, "bc4u", "EncodeBC4U", SourceType_U8 },
+    { cvtt::SurfaceFormat_BC4S, "bc4s", "EncodeBC4S", SourceType_S8 },
+    { cvtt::SurfaceFormat_BC5U, "bc5u", "EncodeBC5U", SourceType_U8 },
+    { cvtt::SurfaceFormat_BC5S, "bc5s", "EncodeBC5S", SourceType_S8 },
+    { cvtt::SurfaceFormat_BC6HU, "bc6hu", "EncodeBC6HU", SourceType_F16 },
+    { cvtt::SurfaceFormat_BC6HS, "bc6hs", "EncodeBC6HS", SourceType_F16 },
+    { cvtt::SurfaceFormat_BC7, "bc7", "EncodeBC7", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC1, "etc1", "EncodeETC1", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC2, "etc2rgb", "EncodeETC2", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC2RGBA, "etc2rgba", "EncodeETC2RGBA", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC2PunchthroughAlpha, "etc2punchthrough", "EncodeETC2PunchthroughAlpha", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC2Alpha, "etc2alpha", "EncodeETC2Alpha", SourceType_U8 },
+    { cvtt::SurfaceFormat_ETC2Alpha11U, "r11u", "EncodeETC2Alpha11", SourceType_S16 },
+    { cvtt::SurfaceFormat_ETC2Alpha11S, "r11s", "EncodeETC2Alpha11", SourceType_S16 },
+};
+
+static const TierInfo g_tiers[] =
+{
+    { "realtime", cvtt::Flags::Fastest | cvtt::Flags::S3TC_RealTime | cvtt::Flags::BC7_RealTime },
+    { "fastest", cvtt::Flags::Fastest },
+    { "faster", cvtt::Flags::Faster },
+    { "fast", cvtt::Flags::Fast },
+    { "default", cvtt::Flags::Default },
+    { "better", cvtt::Flags::Better },
+    { "ultra", cvtt::Flags::Ultra },
+};
+
+static const char *g_corpusNames[] =
+{
+    "gradient",
+    "noise",
+    "normalmap",
+    "alphacutout",
+    "hdrramp",
+};
+
+static const int g_defaultBC7Qualities[] = { 1, 10, 25, 50, 75, 100 };
+
+static const size_t kNumFormats = sizeof(g_formats) / sizeof(g_formats[0]);
+static const size_t kNumTiers = sizeof(g_tiers) / sizeof(g_tiers[0]);
+
+class Random
+{
+public:
+    explicit Random(uint32_t seed)
+        : m_state(seed)
+    {
+    }
+
+    uint32_t Next()
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return m_state >> 8;
+    }
+
+    float NextFloat()
+    {
+        return static_cast<float>(Next() & 0xffff) / 65535.0f;
+    }
+
+private:
+    uint32_t m_state;
+};
+
+static uint16_t FloatToHalf(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, 4);
+
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    const int exponent = static_cast<int>((bits >> 23) & 0xff) - 127 + 15;
+    const uint16_t mantissa = static_cast<uint16_t>((bits >> 13) & 0x3ff);
+
+    if (exponent <= 0)
+        return sign;
+    if (exponent >= 31)
+        return sign | 0x7bff;
+    return static_cast<uint16_t>(sign | (exponent << 10) | mantissa);
+}
+
+static uint8_t ClampToU8(float f)
+{
+    return static_cast<uint8_t>(std::max(0.0f, std::min(255.0f, floorf(f + 0.5f))));
+}
+
+// Generates an RGBA color for a corpus in the 0..1 range, except for HDR ramps which go above 1
+static void GenerateColor(CorpusKind corpus, int x, int y, int width, int height, Random &rng, float outColor[4])
+{
+    const float u = static_cast<float>(x) / static_cast<float>(std::max(1, width - 1));
+    const float v = static_cast<float>(y) / static_cast<float>(std::max(1, height - 1));
+
+    switch (corpus)
+    {
+    case CorpusKind_Gradient:
+        outColor[0] = u;
+        outColor[1] = v;
+        outColor[2] = 1.0f - 0.5f * (u + v);
+        outColor[3] = 0.25f + 0.75f * u * v;
+        break;
+    case CorpusKind_Noise:
+        for (int ch = 0; ch < 4; ch++)
+            outColor[ch] = rng.NextFloat();
+        break;
+    case CorpusKind_NormalMap:
+        {
+            const float dx = 0.6f * cosf(u * 25.0f) * sinf(v * 13.0f);
+            const float dy = 0.6f * sinf(u * 17.0f + v * 9.0f);
+            const float length = sqrtf(dx * dx + dy * dy + 1.0f);
+            outColor[0] = 0.5f + 0.5f * dx / length;
+            outColor[1] = 0.5f + 0.5f * dy / length;
+            outColor[2] = 0.5f + 0.5f / length;
+            outColor[3] = 1.0f;
+        }
+        break;
+    case CorpusKind_AlphaCutout:
+        {
+            const float cellU = u * 8.0f - floorf(u * 8.0f) - 0.5f;
+            const float cellV = v * 8.0f - floorf(v * 8.0f) - 0.5f;
+            const float leafColor = 0.5f + 0.5f * sinf((u + v) * 11.0f);
+            outColor[0] = 0.2f * leafColor;
+            outColor[1] = 0.4f + 0.5f * leafColor;
+            outColor[2] = 0.1f + 0.1f * rng.NextFloat();
+            outColor[3] = (cellU * cellU + cellV * cellV < 0.16f) ? 1.0f : 0.0f;
+        }
+        break;
+    case CorpusKind_HDRRamp:
+        {
+            const float intensity = powf(2.0f, u * 16.0f - 6.0f);
+            outColor[0] = intensity;
+            outColor[1] = intensity * (0.25f + 0.75f * v);
+            outColor[2] = intensity * (1.0f - 0.75f * v);
+            outColor[3] = 1.0f;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static bool CorpusAppliesToFormat(CorpusKind corpus, const FormatInfo &format)
+{
+    switch (format.m_sourceType)
+    {
+    case SourceType_U8:
+    case SourceType_S16:
+        return corpus != CorpusKind_HDRRamp;
+    case SourceType_S8:
+        return corpus == CorpusKind_Noise || corpus == CorpusKind_NormalMap;
+    case SourceType_F16:
+        return corpus == CorpusKind_Noise || corpus == CorpusKind_HDRRamp;
+    default:
+        return false;
+    }
+}
+
+// Real-time tiers only change the BC1-BC5 and BC7 encoders, so they would just repeat Fastest for other formats
+static bool TierAppliesToFormat(const TierInfo &tier, const FormatInfo &format)
+{
+    if ((tier.m_flags & (cvtt::Flags::S3TC_RealTime | cvtt::Flags::BC7_RealTime)) == 0)
+        return true;
+
+    switch (format.m_format)
+    {
+    case cvtt::SurfaceFormat_BC1:
+    case cvtt::SurfaceFormat_BC2:
+    case cvtt::SurfaceFormat_BC3:
+    case cvtt::SurfaceFormat_BC4U:
+    case cvtt::SurfaceFormat_BC4S:
+    case cvtt::SurfaceFormat_BC5U:
+    case cvtt::SurfaceFormat_BC5S:
+    case cvtt::SurfaceFormat_BC7:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Generates source pixels in the layout expected by EncodeSurface for a format
+static void GenerateCorpus(CorpusKind corpus, const FormatInfo &format, int width, int height, std::vector<uint8_t> &outPixels)
+{
+    const size_t pixelSize = cvtt::Kernels::GetSourcePixelSizeBytes(format.m_format);
+    const bool isSigned = (format.m_format == cvtt::SurfaceFormat_BC6HS || format.m_format == cvtt::SurfaceFormat_ETC2Alpha11S);
+
+    Random rng(0x43565454u + static_cast<uint32_t>(corpus));
+
+    outPixels.resize(static_cast<size_t>(width) * height * pixelSize);
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            float color[4];
+            GenerateColor(corpus, x, y, width, height, rng, color);
+
+            uint8_t *pixel = &outPixels[(static_cast<size_t>(y) * width + x) * pixelSize];
+
+            switch (format.m_sourceType)
+            {
+            case SourceType_U8:
+                for (int ch = 0; ch < 4; ch++)
+                    pixel[ch] = ClampToU8(color[ch] * 255.0f);
+                break;
+            case SourceType_S8:
+                for (int ch = 0; ch < 4; ch++)
+                {
+                    const int8_t value = static_cast<int8_t>(static_cast<int>(ClampToU8(color[ch] * 255.0f)) - 128);
+                    memcpy(pixel + ch, &value, 1);
+                }
+                break;
+            case SourceType_F16:
+                for (int ch = 0; ch < 4; ch++)
+                {
+                    float value = (corpus == CorpusKind_Noise) ? color[ch] * 64.0f : color[ch];
+                    if (isSigned && ch < 3 && (x + y) % 3 == 0)
+                        value = -value;
+
+                    const uint16_t half = FloatToHalf(value);
+                    memcpy(pixel + ch * 2, &half, 2);
+                }
+                break;
+            case SourceType_S16:
+                {
+                    const int16_t value = isSigned ? static_cast<int16_t>(floorf((color[0] * 2.0f - 1.0f) * 1023.0f + 0.5f))
+                        : static_cast<int16_t>(floorf(color[0] * 2047.0f + 0.5f));
+                    memcpy(pixel, &value, 2);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+struct BenchmarkSettings
+{
+    int m_width;
+    int m_height;
+    double m_minSeconds;
+    std::vector<unsigned int> m_threadCounts;
+    std::vector<int> m_bc7Qualities;
+    bool m_formatEnabled[kNumFormats];
+    bool m_tierEnabled[kNumTiers];
+};
+
+struct BenchmarkResult
+{
+    size_t m_numBlocks;
+    unsigned int m_iterations;
+    double m_seconds;
+};
+
+static bool RunBenchmark(const BenchmarkSettings &settings, const FormatInfo &format, const std::vector<uint8_t> &pixels, const cvtt::Options &options,
+    const cvtt::BC7EncodingPlan *encodingPlan, unsigned int numThreads, BenchmarkResult &outResult)
+{
+    const size_t blockSize = cvtt::Kernels::GetBlockSizeBytes(format.m_format);
+    const size_t rowPitch = static_cast<size_t>(settings.m_width) * cvtt::Kernels::GetSourcePixelSizeBytes(format.m_format);
+    const size_t blocksWide = (settings.m_width + 3) / 4;
+    const size_t blocksHigh = (settings.m_height + 3) / 4;
+
+    std::vector<uint8_t> output(blocksWide * blocksHigh * blockSize);
+
+    cvtt::Kernels::ParallelEncodeOptions parallelOptions;
+    parallelOptions.numThreads = numThreads;
+
+    outResult.m_numBlocks = blocksWide * blocksHigh;
+    outResult.m_iterations = 0;
+    outResult.m_seconds = 0.0;
+
+    const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    do
+    {
+        if (!cvtt::Kernels::EncodeSurfaceParallel(format.m_format, &pixels[0], rowPitch, settings.m_width, settings.m_height, &output[0], blocksWide * blockSize,
+            options, parallelOptions, encodingPlan))
+            return false;
+
+        outResult.m_iterations++;
+        outResult.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    } while (outResult.m_seconds < settings.m_minSeconds);
+
+    return true;
+}
+
+static void WriteResult(FILE *f, bool &isFirst, const FormatInfo &format, CorpusKind corpus, const char *tierName, int bc7Quality, unsigned int numThreads,
+    const BenchmarkResult &result)
+{
+    const double totalBlocks = static_cast<double>(result.m_numBlocks) * result.m_iterations;
+
+    fprintf(f, "%s\n    {\"function\": \"%s\", \"format\": \"%s\", \"corpus\": \"%s\", \"tier\": \"%s\", ", isFirst ? "" : ",",
+        format.m_functionName, format.m_name, g_corpusNames[corpus], tierName);
+
+    if (bc7Quality > 0)
+        fprintf(f, "\"bc7Quality\": %i, ", bc7Quality);
+
+    fprintf(f, "\"threads\": %u, \"blocks\": %u, \"iterations\": %u, \"seconds\": %.6f, \"blocksPerSecond\": %.1f, \"nsPerBlock\": %.2f}",
+        numThreads, static_cast<unsigned int>(result.m_numBlocks), result.m_iterations, result.m_seconds,
+        totalBlocks / result.m_seconds, result.m_seconds * 1.0e9 / totalBlocks);
+
+    isFirst = false;
+}
+
+static bool ParseIntList(const char *str, std::vector<int> &outList)
+{
+    outList.clear();
+
+    while (*str)
+    {
+        char *end = NULL;
+        const long value = strtol(str, &end, 10);
+        if (end == str || value < 0)
+            return false;
+
+        outList.push_back(static_cast<int>(value));
+
+        str = end;
+        if (*str == ',')
+            str++;
+        else if (*str != '\0')
+            return false;
+    }
+
+    return !outList.empty();
+}
+
+template<class TInfo>
+static bool ParseNameList(const char *str, const TInfo *infos, size_t numInfos, bool *outEnabled)
+{
+    for (size_t i = 0; i < numInfos; i++)
+        outEnabled[i] = false;
+
+    while (*str)
+    {
+        const char *end = strchr(str, ',');
+        const size_t length = end ? static_cast<size_t>(end - str) : strlen(str);
+
+        bool found = false;
+        for (size_t i = 0; i < numInfos; i++)
+        {
+            const char *name = infos[i].m_name;
+            if (strlen(name) == length && !strncmp(str, name, length))
+            {
+                outEnabled[i] = true;
+                found = true;
+            }
+        }
+
+        if (!found)
+            return false;
+
+        str += length;
+        if (*str == ',')
+            str++;
+    }
+
+    return true;
+}
+
+void PrintUsageAndExit()
+{
+    fprintf(stderr, "Usage: cvttbench [options]\n");
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "-size <width> <height> - Size of each synthetic image (default 256 256)\n");
+    fprintf(stderr, "-formats <list> - Comma-separated formats to benchmark (default all):\n");
+    fprintf(stderr, "   ");
+    for (size_t i = 0; i < kNumFormats; i++)
+        fprintf(stderr, " %s", g_formats[i].m_name);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "-tiers <list> - Comma-separated quality tiers (default all): realtime fastest faster fast default better ultra\n");
+    fprintf(stderr, "-bc7quality <list> - Comma-separated BC7 encoding plan qualities from 1 to 100, or \"all\" (default 1,10,25,50,75,100)\n");
+    fprintf(stderr, "-threads <list> - Comma-separated thread counts, 0 is one per hardware thread (default 1,0)\n");
+    fprintf(stderr, "-mintime <seconds> - Minimum time to repeat each measurement for (default 0.25)\n");
+    fprintf(stderr, "-output <path> - Write JSON results to a file instead of stdout\n");
+    exit(-1);
+}
+
+int main(int argc, const char **argv)
+{
+    BenchmarkSettings settings;
+    settings.m_width = 256;
+    settings.m_height = 256;
+    settings.m_minSeconds = 0.25;
+    settings.m_threadCounts.push_back(1);
+    settings.m_threadCounts.push_back(0);
+    settings.m_bc7Qualities.assign(g_defaultBC7Qualities, g_defaultBC7Qualities + sizeof(g_defaultBC7Qualities) / sizeof(g_defaultBC7Qualities[0]));
+
+    for (size_t i = 0; i < kNumFormats; i++)
+        settings.m_formatEnabled[i] = true;
+    for (size_t i = 0; i < kNumTiers; i++)
+        settings.m_tierEnabled[i] = true;
+
+    const char *outputPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasArg = (i + 1 < argc);
+
+        if (!strcmp(argv[i], "-size") && i + 2 < argc)
+        {
+            settings.m_width = atoi(argv[i + 1]);
+            settings.m_height = atoi(argv[i + 2]);
+            if (settings.m_width <= 0 || settings.m_height <= 0)
+                PrintUsageAndExit();
+            i += 2;
+        }
+        else if (!strcmp(argv[i], "-formats") && hasArg)
+        {
+            if (!ParseNameList(argv[++i], g_formats, kNumFormats, settings.m_formatEnabled))
+                PrintUsageAndExit();
+        }
+        else if (!strcmp(argv[i], "-tiers") && hasArg)
+        {
+            if (!ParseNameList(argv[++i], g_tiers, kNumTiers, settings.m_tierEnabled))
+                PrintUsageAndExit();
+        }
+        else if (!strcmp(argv[i], "-bc7quality") && hasArg)
+        {
+            i++;
+            if (!strcmp(argv[i], "all"))
+            {
+                settings.m_bc7Qualities.clear();
+                for (int quality = 1; quality <= 100; quality++)
+                    settings.m_bc7Qualities.push_back(quality);
+            }
+            else if (!ParseIntList(argv[i], settings.m_bc7Qualities))
+                PrintUsageAndExit();
+        }
+        else if (!strcmp(argv[i], "-threads") && hasArg)
+        {
+            std::vector<int> threadCounts;
+            if (!ParseIntList(argv[++i], threadCounts))
+                PrintUsageAndExit();
+            settings.m_threadCounts.assign(threadCounts.begin(), threadCounts.end());
+        }
+        else if (!strcmp(argv[i], "-mintime") && hasArg)
+            settings.m_minSeconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-output") && hasArg)
+            outputPath = argv[++i];
+        else
+            PrintUsageAndExit();
+    }
+
+    FILE *f = stdout;
+    if (outputPath)
+    {
+        f = fopen(outputPath, "wb");
+        if (!f)
+        {
+            fprintf(stderr, "Could not open output file\n");
+            return -1;
+        }
+    }
+
+    const unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    fprintf(f, "{\n  \"numParallelBlocks\": %u,\n  \"hardwareThreads\": %u,\n  \"width\": %i,\n  \"height\": %i,\n  \"results\": [",
+        cvtt::NumParallelBlocks, hardwareThreads, settings.m_width, settings.m_height);
+
+    bool isFirst = true;
+    bool failed = false;
+
+    std::vector<uint8_t> pixels;
+
+    for (size_t formatIndex = 0; formatIndex < kNumFormats && !failed; formatIndex++)
+    {
+        if (!settings.m_formatEnabled[formatIndex])
+            continue;
+
+        const FormatInfo &format = g_formats[formatIndex];
+
+        for (int corpusIndex = 0; corpusIndex < CorpusKind_Count && !failed; corpusIndex++)
+        {
+            const CorpusKind corpus = static_cast<CorpusKind>(corpusIndex);
+            if (!CorpusAppliesToFormat(corpus, format))
+                continue;
+
+            GenerateCorpus(corpus, format, settings.m_width, settings.m_height, pixels);
+
+            for (size_t threadIndex = 0; threadIndex < settings.m_threadCounts.size() && !failed; threadIndex++)
+            {
+                const unsigned int numThreads = settings.m_threadCounts[threadIndex] ? settings.m_threadCounts[threadIndex] : hardwareThreads;
+
+                // Quality tiers, using the default (maximum quality) BC7 encoding plan
+                for (size_t tierIndex = 0; tierIndex < kNumTiers && !failed; tierIndex++)
+                {
+                    if (!settings.m_tierEnabled[tierIndex] || !TierAppliesToFormat(g_tiers[tierIndex], format))
+                        continue;
+
+                    cvtt::Options options;
+                    options.flags = g_tiers[tierIndex].m_flags;
+
+                    fprintf(stderr, "%s %s %s %u threads\n", format.m_name, g_corpusNames[corpus], g_tiers[tierIndex].m_name, numThreads);
+
+                    BenchmarkResult result;
+                    failed = !RunBenchmark(settings, format, pixels, options, NULL, numThreads, result);
+                    if (!failed)
+                        WriteResult(f, isFirst, format, corpus, g_tiers[tierIndex].m_name, 0, numThreads, result);
+                }
+
+                // BC7 encoding plan quality levels, using the default flags
+                if (format.m_format != cvtt::SurfaceFormat_BC7)
+                    continue;
+
+                for (size_t qualityIndex = 0; qualityIndex < settings.m_bc7Qualities.size() && !failed; qualityIndex++)
+                {
+                    const int quality = std::max(1, std::min(100, settings.m_bc7Qualities[qualityIndex]));
+
+                    cvtt::BC7EncodingPlan encodingPlan;
+                    cvtt::Kernels::ConfigureBC7EncodingPlanFromQuality(encodingPlan, quality);
+
+                    cvtt::Options options;
+
+                    fprintf(stderr, "%s %s quality %i %u threads\n", format.m_name, g_corpusNames[corpus], quality, numThreads);
+
+                    BenchmarkResult result;
+                    failed = !RunBenchmark(settings, format, pixels, options, &encodingPlan, numThreads, result);
+                    if (!failed)
+                        WriteResult(f, isFirst, format, corpus, "default", quality, numThreads, result);
+                }
+            }
+        }
+    }
+
+    fprintf(f, "\n  ]\n}\n");
+
+    if (outputPath)
+        fclose(f);
+
+    if (failed)
+    {
+        fprintf(stderr, "Encoding failed\n");
+        return -1;
+    }
+
+    return 0;
+}
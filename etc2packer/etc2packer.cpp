@@ -3,6 +3,7 @@
 
 #include <string.h>
 #include <algorithm>
+#include <vector>
 
 #include "stb_image/stb_image.h"
 
@@ -144,6 +145,7 @@ int main(int argc, const char **argv)
 	ktxHeader.numberOfMipmapLevels = 1;
 
     unsigned int blockSizeBytes = 8;
+    cvtt::SurfaceFormat surfaceFormat = cvtt::SurfaceFormat_ETC2;
 
     switch (targetFormat)
     {
@@ -151,37 +153,40 @@ int main(int argc, const char **argv)
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC1_RGB8;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC1_RGB8;
         blockSizeBytes = 8;
+        surfaceFormat = cvtt::SurfaceFormat_ETC1;
         break;
     case ETC2_RGB:
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC2_RGB8;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC2_RGB8;
         blockSizeBytes = 8;
+        surfaceFormat = cvtt::SurfaceFormat_ETC2;
         break;
     case ETC2_RGBA:
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC2_RGBA8;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC2_RGBA8;
         blockSizeBytes = 16;
+        surfaceFormat = cvtt::SurfaceFormat_ETC2RGBA;
         break;
     case ETC2_Punchthrough:
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC2_RGB8A1;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC2_RGB8A1;
         blockSizeBytes = 8;
+        surfaceFormat = cvtt::SurfaceFormat_ETC2PunchthroughAlpha;
         break;
     case R11_Unsigned:
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC2_R11;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC2_R11;
         blockSizeBytes = 8;
+        surfaceFormat = cvtt::SurfaceFormat_ETC2Alpha11U;
         break;
     case R11_Signed:
         ktxHeader.glInternalFormat = (unsigned int)KtxHeader_t::InternalFormat::ETC2_SIGNED_R11;
         ktxHeader.glBaseInternalFormat = (unsigned int)KtxHeader_t::BaseInternalFormat::ETC2_R11;
         blockSizeBytes = 8;
+        surfaceFormat = cvtt::SurfaceFormat_ETC2Alpha11S;
         break;
     }
 
-    uint8_t alphaOutputBlock[8 * cvtt::NumParallelBlocks];
-    uint8_t outputBlock[8 * cvtt::NumParallelBlocks];
-
 	FILE *f = fopen(outputPath, "wb");
     if (!f)
     {
@@ -212,74 +217,35 @@ int main(int argc, const char **argv)
     if (targetFormat == ETC2_RGB || targetFormat == ETC2_RGBA || targetFormat == ETC2_Punchthrough)
         compressionData2 = cvtt::Kernels::AllocETC2Data(allocshim, nullptr, options);
 
-	for (int y = 0; y < h; y += 4)
-	{
-        cvtt::PixelBlockU8 pixelBlocks[8];
-        cvtt::PixelBlockScalarS16 pixelBlockSigned[8];
-        cvtt::PixelBlockScalarS16 pixelBlockUnsigned[8];
-        for (int x = 0; x < w; x += 32)
-		{
-            for (int block = 0; block < cvtt::NumParallelBlocks; block++)
-            {
-                for (int subY = 0; subY < 4; subY++)
-                {
-                    int clampedY = std::min(y + subY, h - 1);
-
-                    const uint8_t *inputRow = image + (clampedY) * w * 4;
-                    for (int subX = 0; subX < 4; subX++)
-                    {
-                        int clampedX = std::min(x + subX + block * 4, w - 1);
+    const void *surfacePixels = image;
+    size_t surfaceRowPitch = static_cast<size_t>(w) * 4;
 
-                        int rgba[4];
-                        for (int ch = 0; ch < 4; ch++)
-                            rgba[ch] = inputRow[clampedX * 4 + ch];
-
-                        for (int ch = 0; ch < 4; ch++)
-                            pixelBlocks[block].m_pixels[subY * 4 + subX][ch] = rgba[ch];
+    std::vector<int16_t> r11Pixels;
+    if (targetFormat == R11_Unsigned || targetFormat == R11_Signed)
+    {
+        r11Pixels.resize(static_cast<size_t>(w) * h);
 
-                        double rgbaTotal = rgba[0] + rgba[1] + rgba[2];
-                        double normalizedUnsigned = rgbaTotal / (255.0 * 3.0);
-                        double normalizedSigned = normalizedUnsigned * 2.0 - 1.0;
+        for (int i = 0; i < w * h; i++)
+        {
+            const uint8_t *rgba = image + i * 4;
 
-                        pixelBlockUnsigned[block].m_pixels[subY * 4 + subX] = static_cast<int>(floor(normalizedUnsigned * 2047.0 + 0.5));
-                        pixelBlockSigned[block].m_pixels[subY * 4 + subX] = static_cast<int>(floor(normalizedUnsigned * 1023.0 + 0.5));
-                    }
-                }
-            }
+            double rgbaTotal = rgba[0] + rgba[1] + rgba[2];
+            double normalizedUnsigned = rgbaTotal / (255.0 * 3.0);
 
-            if (targetFormat == ETC2_RGBA)
-                cvtt::Kernels::EncodeETC2Alpha(alphaOutputBlock, pixelBlocks, options);
+            if (targetFormat == R11_Unsigned)
+                r11Pixels[i] = static_cast<int>(floor(normalizedUnsigned * 2047.0 + 0.5));
+            else
+                r11Pixels[i] = static_cast<int>(floor(normalizedUnsigned * 1023.0 + 0.5));
+        }
 
-            switch (targetFormat)
-            {
-            case ETC1:
-                cvtt::Kernels::EncodeETC1(outputBlock, pixelBlocks, options, compressionData1);
-                break;
-            case R11_Unsigned:
-                cvtt::Kernels::EncodeETC2Alpha11(outputBlock, pixelBlockUnsigned, false, options);
-                break;
-            case R11_Signed:
-                cvtt::Kernels::EncodeETC2Alpha11(outputBlock, pixelBlockSigned, true, options);
-                break;
-            case ETC2_Punchthrough:
-                cvtt::Kernels::EncodeETC2PunchthroughAlpha(outputBlock, pixelBlocks, options, compressionData2);
-                break;
-            case ETC2_RGB:
-            case ETC2_RGBA:
-                cvtt::Kernels::EncodeETC2(outputBlock, pixelBlocks, options, compressionData2);
-                break;
-            }
+        surfacePixels = &r11Pixels[0];
+        surfaceRowPitch = static_cast<size_t>(w) * 2;
+    }
 
-            int writableBlocks = std::min<int>(cvtt::NumParallelBlocks, (w - x + 3) / 4);
+    std::vector<uint8_t> outputBlocks(dataSize);
+    cvtt::Kernels::EncodeSurface(surfaceFormat, surfacePixels, surfaceRowPitch, w, h, &outputBlocks[0], blockWidth * blockSizeBytes, options, NULL, compressionData1, compressionData2);
 
-            for (int block = 0; block < writableBlocks; block++)
-            {
-                if (targetFormat == ETC2_RGBA)
-                    fwrite(alphaOutputBlock + block * 8, 8, 1, f);
-                fwrite(outputBlock + block * 8, 8, 1, f);
-            }
-        }
-	}
+    fwrite(&outputBlocks[0], 1, dataSize, f);
 
     if (compressionData1)
         cvtt::Kernels::ReleaseETC1Data(compressionData1, freeshim);
@@ -0,0 +1,1742 @@
+// Tests for the CVTT encoders and decoders.  Decodes both random data and encoder output with the library decoders and with the
+// straightforward one-block-at-a-time reference decoders in this file and checks that they agree, then checks that the round-trip
+// error of each encoder stays within a bound, and that the surface encoders match the Batch encoders.  Prints one line per test
+// and returns a nonzero exit code if any of them fail.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "../ConvectionKernels.h"
+
+class Random
+{
+public:
+    explicit Random(uint32_t seed)
+        : m_state(seed)
+    {
+    }
+
+    uint32_t Next()
+    {
+        m_state = m_state * 1664525u + 1013904223u;
+        return m_state >> 8;
+    }
+
+private:
+    uint32_t m_state;
+};
+
+static const size_t kNumTestBlocks = 4096;
+
+static uint8_t ClampToU8(int v)
+{
+    return static_cast<uint8_t>(std::max(0, std::min(255, v)));
+}
+
+// Generates a mix of noise, gradients, flat colors, and alpha cutouts
+static void GenerateBlocks(std::vector<cvtt::PixelBlockU8> &blocks, uint32_t seed)
+{
+    Random rng(seed);
+
+    blocks.resize(kNumTestBlocks);
+    for (size_t i = 0; i < kNumTestBlocks; i++)
+    {
+        cvtt::PixelBlockU8 &block = blocks[i];
+
+        int base[4];
+        int delta[4];
+        for (int ch = 0; ch < 4; ch++)
+        {
+            base[ch] = static_cast<int>(rng.Next() % 256);
+            delta[ch] = static_cast<int>(rng.Next() % 129) - 64;
+        }
+
+        for (int px = 0; px < 16; px++)
+        {
+            const int x = px % 4;
+            const int y = px / 4;
+
+            for (int ch = 0; ch < 4; ch++)
+            {
+                int v;
+                switch (i % 5)
+                {
+                case 0:
+                    v = static_cast<int>(rng.Next() % 256);
+                    break;
+                case 1:
+                    v = base[ch] + delta[ch] * x / 3 + delta[(ch + 1) % 4] * y / 3;
+                    break;
+                case 2:
+                    v = base[ch];
+                    break;
+                case 3:
+                    if (ch == 3)
+                        v = (rng.Next() % 3 == 0) ? 0 : 255;
+                    else
+                        v = base[ch] + static_cast<int>(rng.Next() % 16);
+                    break;
+                default:
+                    v = base[ch] + delta[ch] * px / 15 + static_cast<int>(rng.Next() % 8);
+                    break;
+                }
+
+                block.m_pixels[px][ch] = ClampToU8(v);
+            }
+        }
+    }
+}
+
+static void GenerateSignedBlocks(std::vector<cvtt::PixelBlockS8> &outBlocks, const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    outBlocks.resize(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            for (int ch = 0; ch < 4; ch++)
+                outBlocks[i].m_pixels[px][ch] = static_cast<int8_t>(std::max(-127, blocks[i].m_pixels[px][ch] - 128));
+        }
+    }
+}
+
+// Punchthrough alpha can only be 0 or 255, and transparent pixels decode as black, so the source is cut out the same way
+static void GenerateCutoutBlocks(std::vector<cvtt::PixelBlockU8> &outBlocks, const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    outBlocks = blocks;
+    for (size_t i = 0; i < outBlocks.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            cvtt::PixelBlockU8 &block = outBlocks[i];
+            if (block.m_pixels[px][3] < 128)
+            {
+                for (int ch = 0; ch < 4; ch++)
+                    block.m_pixels[px][ch] = 0;
+            }
+            else
+                block.m_pixels[px][3] = 255;
+        }
+    }
+}
+
+static void GenerateRandomData(std::vector<uint8_t> &data, size_t blockSize, uint32_t seed)
+{
+    Random rng(seed);
+
+    data.resize(kNumTestBlocks * blockSize);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(rng.Next());
+}
+
+static uint32_t ReadLE(const uint8_t *data, int numBytes)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < numBytes; i++)
+        v |= static_cast<uint32_t>(data[i]) << (i * 8);
+    return v;
+}
+
+// Rounds to nearest, flushes values below the normal range to zero, and clamps to the largest finite value
+static uint16_t FloatToHalf(float f)
+{
+    uint32_t bits;
+    memcpy(&bits, &f, 4);
+
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    const int exponent = static_cast<int>((bits >> 23) & 0xff) - 127 + 15;
+    if (exponent <= 0)
+        return sign;
+    if (exponent >= 31)
+        return static_cast<uint16_t>(sign | 0x7bff);
+
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | ((bits >> 13) & 0x3ff);
+    if (bits & 0x1000)
+        half++;
+    return static_cast<uint16_t>(sign | std::min<uint32_t>(half, 0x7bff));
+}
+
+static float HalfToFloat(uint16_t h)
+{
+    const int exponent = (h >> 10) & 0x1f;
+    const int mantissa = h & 0x3ff;
+
+    float v;
+    if (exponent == 0)
+        v = ldexpf(static_cast<float>(mantissa), -24);
+    else
+        v = ldexpf(static_cast<float>(mantissa | 0x400), exponent - 25);
+
+    return (h & 0x8000) ? -v : v;
+}
+
+namespace Reference
+{
+    // Same rounding as the library decoders: the weight is the index scaled to 0..256 with a 15-bit reciprocal
+    static int InterpolateLDR(int ep0, int ep1, int index, int range)
+    {
+        static const int reciprocals[9] = { 0, 0, 0, 16384, 10923, 0, 6554, 0, 4681 };
+
+        const int weight = (reciprocals[range] * index + 64) >> 7;
+        return (ep0 * (256 - weight) + ep1 * weight + 128) >> 8;
+    }
+
+    static void DecodeBC1Color(const uint8_t *pBC, bool allowTransparent, cvtt::PixelBlockU8 &outBlock)
+    {
+        const uint32_t ep[2] = { ReadLE(pBC, 2), ReadLE(pBC + 2, 2) };
+        const uint32_t indexes = ReadLE(pBC + 4, 4);
+        const bool isThreeColor = allowTransparent && ep[0] <= ep[1];
+
+        int palette[4][4];
+        for (int epi = 0; epi < 2; epi++)
+        {
+            const int r = static_cast<int>(ep[epi] >> 11);
+            const int g = static_cast<int>((ep[epi] >> 5) & 63);
+            const int b = static_cast<int>(ep[epi] & 31);
+
+            palette[epi][0] = (r << 3) | (r >> 2);
+            palette[epi][1] = (g << 2) | (g >> 4);
+            palette[epi][2] = (b << 3) | (b >> 2);
+            palette[epi][3] = 255;
+        }
+
+        for (int ch = 0; ch < 3; ch++)
+        {
+            if (isThreeColor)
+            {
+                palette[2][ch] = InterpolateLDR(palette[0][ch], palette[1][ch], 1, 3);
+                palette[3][ch] = 0;
+            }
+            else
+            {
+                palette[2][ch] = InterpolateLDR(palette[0][ch], palette[1][ch], 1, 4);
+                palette[3][ch] = InterpolateLDR(palette[0][ch], palette[1][ch], 2, 4);
+            }
+        }
+        palette[2][3] = 255;
+        palette[3][3] = isThreeColor ? 0 : 255;
+
+        for (int px = 0; px < 16; px++)
+        {
+            const int index = (indexes >> (px * 2)) & 3;
+            for (int ch = 0; ch < 4; ch++)
+                outBlock.m_pixels[px][ch] = static_cast<uint8_t>(palette[index][ch]);
+        }
+    }
+
+    static void DecodeExplicitAlpha(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            const int value = (pBC[px / 2] >> ((px % 2) * 4)) & 15;
+            outBlock.m_pixels[px][3] = static_cast<uint8_t>((value << 4) | value);
+        }
+    }
+
+    // Signed values are decoded as 0..254 with a bias of 127
+    static void DecodeInterpolatedAlpha(const uint8_t *pBC, bool isSigned, int outValues[16])
+    {
+        int rawEP[2];
+        int ep[2];
+        for (int epi = 0; epi < 2; epi++)
+        {
+            if (isSigned)
+            {
+                rawEP[epi] = static_cast<int8_t>(pBC[epi]);
+                ep[epi] = std::max(rawEP[epi], -127) + 127;
+            }
+            else
+                ep[epi] = rawEP[epi] = pBC[epi];
+        }
+
+        int palette[8];
+        palette[0] = ep[0];
+        palette[1] = ep[1];
+        if (rawEP[0] > rawEP[1])
+        {
+            for (int i = 2; i < 8; i++)
+                palette[i] = InterpolateLDR(ep[0], ep[1], i - 1, 8);
+        }
+        else
+        {
+            for (int i = 2; i < 6; i++)
+                palette[i] = InterpolateLDR(ep[0], ep[1], i - 1, 6);
+            palette[6] = 0;
+            palette[7] = isSigned ? 254 : 255;
+        }
+
+        const uint64_t indexes = static_cast<uint64_t>(ReadLE(pBC + 2, 4)) | (static_cast<uint64_t>(ReadLE(pBC + 6, 2)) << 32);
+        for (int px = 0; px < 16; px++)
+            outValues[px] = palette[(indexes >> (px * 3)) & 7];
+    }
+
+    static void DecodeBC1(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeBC1Color(pBC, true, outBlock);
+    }
+
+    static void DecodeBC2(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeBC1Color(pBC + 8, false, outBlock);
+        DecodeExplicitAlpha(pBC, outBlock);
+    }
+
+    static void DecodeBC3(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeBC1Color(pBC + 8, false, outBlock);
+
+        int alpha[16];
+        DecodeInterpolatedAlpha(pBC, false, alpha);
+        for (int px = 0; px < 16; px++)
+            outBlock.m_pixels[px][3] = static_cast<uint8_t>(alpha[px]);
+    }
+
+    // Decodes 1 or 2 channels to red and green, with blue 0 and alpha opaque
+    template<class TBlock>
+    static void DecodeInterpolatedChannels(const uint8_t *pBC, int numChannels, bool isSigned, TBlock &outBlock)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            outBlock.m_pixels[px][1] = 0;
+            outBlock.m_pixels[px][2] = 0;
+            outBlock.m_pixels[px][3] = static_cast<uint8_t>(isSigned ? 127 : 255);
+        }
+
+        for (int ch = 0; ch < numChannels; ch++)
+        {
+            int values[16];
+            DecodeInterpolatedAlpha(pBC + ch * 8, isSigned, values);
+            for (int px = 0; px < 16; px++)
+                outBlock.m_pixels[px][ch] = static_cast<uint8_t>(isSigned ? values[px] - 127 : values[px]);
+        }
+    }
+
+    static void DecodeBC4U(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeInterpolatedChannels(pBC, 1, false, outBlock);
+    }
+
+    static void DecodeBC4S(const uint8_t *pBC, cvtt::PixelBlockS8 &outBlock)
+    {
+        DecodeInterpolatedChannels(pBC, 1, true, outBlock);
+    }
+
+    static void DecodeBC5U(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeInterpolatedChannels(pBC, 2, false, outBlock);
+    }
+
+    static void DecodeBC5S(const uint8_t *pBC, cvtt::PixelBlockS8 &outBlock)
+    {
+        DecodeInterpolatedChannels(pBC, 2, true, outBlock);
+    }
+
+    static const int g_etc1Modifiers[8][2] =
+    {
+        { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+    };
+
+    static const int g_etc2Distances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+    static const int g_eacModifiers[16][8] =
+    {
+        { -3, -6, -9, -15, 2, 5, 8, 14 },
+        { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 },
+        { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 },
+        { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 },
+        { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },
+        { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },
+        { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },
+        { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },
+        { -3, -5, -7, -9, 2, 4, 6, 8 },
+    };
+
+    static int ClampByte(int v)
+    {
+        return std::max(0, std::min(255, v));
+    }
+
+    static int SignExtend3(int v)
+    {
+        return (v & 4) ? (v - 8) : v;
+    }
+
+    // Decodes ETC1 and ETC2 color blocks.  ETC2 blocks are big-endian, and pixels are numbered down each column.
+    static void DecodeETC2Color(const uint8_t *pBC, bool punchthroughAlpha, cvtt::PixelBlockU8 &outBlock)
+    {
+        const bool diffBit = (pBC[3] & 2) != 0;
+        const bool isDifferential = punchthroughAlpha || diffBit;
+        const bool opaque = !punchthroughAlpha || diffBit;
+
+        const int r = pBC[0] >> 3;
+        const int g = pBC[1] >> 3;
+        const int b = pBC[2] >> 3;
+        const int r2 = r + SignExtend3(pBC[0] & 7);
+        const int g2 = g + SignExtend3(pBC[1] & 7);
+        const int b2 = b + SignExtend3(pBC[2] & 7);
+
+        if (isDifferential && (b2 < 0 || b2 > 31) && !(r2 < 0 || r2 > 31) && !(g2 < 0 || g2 > 31))
+        {
+            const int origin[3] = { (pBC[0] >> 1) & 63, ((pBC[0] & 1) << 6) | ((pBC[1] >> 1) & 63), ((pBC[1] & 1) << 5) | (((pBC[2] >> 3) & 3) << 3) | ((pBC[2] & 3) << 1) | (pBC[3] >> 7) };
+            const int horizontal[3] = { (((pBC[3] >> 2) & 31) << 1) | (pBC[3] & 1), pBC[4] >> 1, ((pBC[4] & 1) << 5) | (pBC[5] >> 3) };
+            const int vertical[3] = { ((pBC[5] & 7) << 3) | (pBC[6] >> 5), ((pBC[6] & 31) << 2) | (pBC[7] >> 6), pBC[7] & 63 };
+            const int bits[3] = { 6, 7, 6 };
+
+            for (int px = 0; px < 16; px++)
+            {
+                const int x = px % 4;
+                const int y = px / 4;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    const int shift = 8 - bits[ch];
+                    const int o = (origin[ch] << shift) | (origin[ch] >> (bits[ch] - shift));
+                    const int h = (horizontal[ch] << shift) | (horizontal[ch] >> (bits[ch] - shift));
+                    const int v = (vertical[ch] << shift) | (vertical[ch] >> (bits[ch] - shift));
+                    outBlock.m_pixels[px][ch] = static_cast<uint8_t>(ClampByte((x * (h - o) + y * (v - o) + 4 * o + 2) >> 2));
+                }
+                outBlock.m_pixels[px][3] = 255;
+            }
+            return;
+        }
+
+        int palette[8][3];
+        uint16_t sectorMask = 0;
+
+        if (isDifferential && (r2 < 0 || r2 > 31))
+        {
+            // T mode
+            const int colors[2][3] =
+            {
+                { (((pBC[0] >> 3) & 3) << 2) | (pBC[0] & 3), pBC[1] >> 4, pBC[1] & 15 },
+                { pBC[2] >> 4, pBC[2] & 15, pBC[3] >> 4 },
+            };
+            const int distance = g_etc2Distances[(((pBC[3] >> 2) & 3) << 1) | (pBC[3] & 1)];
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                palette[0][ch] = colors[0][ch] * 17;
+                palette[1][ch] = ClampByte(colors[1][ch] * 17 + distance);
+                palette[2][ch] = colors[1][ch] * 17;
+                palette[3][ch] = ClampByte(colors[1][ch] * 17 - distance);
+            }
+        }
+        else if (isDifferential && (g2 < 0 || g2 > 31))
+        {
+            // H mode
+            const int colors[2][3] =
+            {
+                { (pBC[0] >> 3) & 15, ((pBC[0] & 7) << 1) | ((pBC[1] >> 4) & 1), (pBC[1] & 8) | ((pBC[1] & 3) << 1) | (pBC[2] >> 7) },
+                { (pBC[2] >> 3) & 15, ((pBC[2] & 7) << 1) | (pBC[3] >> 7), (pBC[3] >> 3) & 15 },
+            };
+            const int packed0 = (colors[0][0] << 8) | (colors[0][1] << 4) | colors[0][2];
+            const int packed1 = (colors[1][0] << 8) | (colors[1][1] << 4) | colors[1][2];
+            const int distance = g_etc2Distances[(pBC[3] & 4) | ((pBC[3] & 1) << 1) | ((packed0 >= packed1) ? 1 : 0)];
+
+            for (int i = 0; i < 2; i++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    palette[i * 2 + 0][ch] = ClampByte(colors[i][ch] * 17 + distance);
+                    palette[i * 2 + 1][ch] = ClampByte(colors[i][ch] * 17 - distance);
+                }
+            }
+        }
+        else
+        {
+            int baseColors[2][3];
+            for (int ch = 0; ch < 3; ch++)
+            {
+                if (isDifferential)
+                {
+                    const int c1 = pBC[ch] >> 3;
+                    const int c2 = c1 + SignExtend3(pBC[ch] & 7);
+                    baseColors[0][ch] = (c1 << 3) | (c1 >> 2);
+                    baseColors[1][ch] = (c2 << 3) | (c2 >> 2);
+                }
+                else
+                {
+                    baseColors[0][ch] = (pBC[ch] >> 4) * 17;
+                    baseColors[1][ch] = (pBC[ch] & 15) * 17;
+                }
+            }
+
+            for (int sector = 0; sector < 2; sector++)
+            {
+                const int *modifiers = g_etc1Modifiers[(pBC[3] >> (5 - sector * 3)) & 7];
+                const int smallModifier = opaque ? modifiers[0] : 0;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    const int base = baseColors[sector][ch];
+                    palette[sector * 4 + 0][ch] = ClampByte(base + smallModifier);
+                    palette[sector * 4 + 1][ch] = ClampByte(base + modifiers[1]);
+                    palette[sector * 4 + 2][ch] = ClampByte(base - smallModifier);
+                    palette[sector * 4 + 3][ch] = ClampByte(base - modifiers[1]);
+                }
+            }
+
+            // The flip bit splits the block into top and bottom halves instead of left and right
+            sectorMask = (pBC[3] & 1) ? 0xcccc : 0xff00;
+        }
+
+        const uint32_t msbs = (static_cast<uint32_t>(pBC[4]) << 8) | pBC[5];
+        const uint32_t lsbs = (static_cast<uint32_t>(pBC[6]) << 8) | pBC[7];
+
+        for (int px = 0; px < 16; px++)
+        {
+            const int bit = (px % 4) * 4 + px / 4;
+            const int index = static_cast<int>((((msbs >> bit) & 1) << 1) | ((lsbs >> bit) & 1));
+            const int entry = static_cast<int>((sectorMask >> bit) & 1) * 4 + index;
+
+            for (int ch = 0; ch < 3; ch++)
+                outBlock.m_pixels[px][ch] = static_cast<uint8_t>(palette[entry][ch]);
+            outBlock.m_pixels[px][3] = 255;
+
+            if (!opaque && index == 2)
+            {
+                for (int ch = 0; ch < 4; ch++)
+                    outBlock.m_pixels[px][ch] = 0;
+            }
+        }
+    }
+
+    // Decodes EAC blocks to 0..255, or for 11-bit blocks to 0..2047 unsigned or -1023..1023 signed
+    static void DecodeEAC(const uint8_t *pBC, bool is11Bit, bool isSigned, int outValues[16])
+    {
+        const int multiplier = pBC[1] >> 4;
+        const int *modifiers = g_eacModifiers[pBC[1] & 15];
+
+        uint64_t indexes = 0;
+        for (int i = 2; i < 8; i++)
+            indexes = (indexes << 8) | pBC[i];
+
+        for (int px = 0; px < 16; px++)
+        {
+            const int slot = (px % 4) * 4 + px / 4;
+            const int modifier = modifiers[(indexes >> (45 - slot * 3)) & 7];
+
+            if (!is11Bit)
+                outValues[px] = ClampByte(pBC[0] + modifier * multiplier);
+            else
+            {
+                const int scaledModifier = (multiplier == 0) ? modifier : (modifier * multiplier * 8);
+                if (isSigned)
+                    outValues[px] = std::max(-1023, std::min(1023, std::max(static_cast<int>(static_cast<int8_t>(pBC[0])), -127) * 8 + scaledModifier));
+                else
+                    outValues[px] = std::max(0, std::min(2047, pBC[0] * 8 + 4 + scaledModifier));
+            }
+        }
+    }
+
+    static void DecodeETC2(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeETC2Color(pBC, false, outBlock);
+    }
+
+    static void DecodeETC2PunchthroughAlpha(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeETC2Color(pBC, true, outBlock);
+    }
+
+    static void DecodeETC2RGBA(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        DecodeETC2Color(pBC + 8, false, outBlock);
+
+        int alpha[16];
+        DecodeEAC(pBC, false, false, alpha);
+        for (int px = 0; px < 16; px++)
+            outBlock.m_pixels[px][3] = static_cast<uint8_t>(alpha[px]);
+    }
+
+    static void DecodeETC2Alpha(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        int alpha[16];
+        DecodeEAC(pBC, false, false, alpha);
+        for (int px = 0; px < 16; px++)
+        {
+            for (int ch = 0; ch < 3; ch++)
+                outBlock.m_pixels[px][ch] = 0;
+            outBlock.m_pixels[px][3] = static_cast<uint8_t>(alpha[px]);
+        }
+    }
+
+    template<bool TIsSigned>
+    static void DecodeETC2Alpha11(const uint8_t *pBC, cvtt::PixelBlockScalarS16 &outBlock)
+    {
+        int values[16];
+        DecodeEAC(pBC, true, TIsSigned, values);
+        for (int px = 0; px < 16; px++)
+            outBlock.m_pixels[px] = static_cast<int16_t>(values[px]);
+    }
+
+    static const uint16_t g_bc7PartitionMap2[64] =
+    {
+        0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80,
+        0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8, 0xff00, 0xfff0, 0xf000,
+        0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce,
+        0x088c, 0x3110, 0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c,
+        0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696, 0xa55a,
+        0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660,
+        0x0272, 0x04e4, 0x4e40, 0x2720, 0xc936, 0x936c, 0x39c6, 0x639c,
+        0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22,
+    };
+
+    static const uint32_t g_bc7PartitionMap3[64] =
+    {
+        0xaa685050, 0x6a5a5040, 0x5a5a4200, 0x5450a0a8, 0xa5a50000, 0xa0a05050, 0x5555a0a0, 0x5a5a5050,
+        0xaa550000, 0xaa555500, 0xaaaa5500, 0x90909090, 0x94949494, 0xa4a4a4a4, 0xa9a59450, 0x2a0a4250,
+        0xa5945040, 0x0a425054, 0xa5a5a500, 0x55a0a0a0, 0xa8a85454, 0x6a6a4040, 0xa4a45000, 0x1a1a0500,
+        0x0050a4a4, 0xaaa59090, 0x14696914, 0x69691400, 0xa08585a0, 0xaa821414, 0x50a4a450, 0x6a5a0200,
+        0xa9a58000, 0x5090a0a8, 0xa8a09050, 0x24242424, 0x00aa5500, 0x24924924, 0x24499224, 0x50a50a50,
+        0x500aa550, 0xaaaa4444, 0x66660000, 0xa5a0a5a0, 0x50a050a0, 0x69286928, 0x44aaaa44, 0x66666600,
+        0xaa444444, 0x54a854a8, 0x95809580, 0x96969600, 0xa85454a8, 0x80959580, 0xaa141414, 0x96960000,
+        0xaaaa1414, 0xa05050a0, 0xa0a5a5a0, 0x96000000, 0x40804080, 0xa9a8a9a8, 0xaaaaaa44, 0x2a4a5254,
+    };
+
+    static const uint8_t g_bc7Anchors2[64] =
+    {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+        15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+        6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15,
+    };
+
+    static const uint8_t g_bc7Anchors3[64][2] =
+    {
+        { 3, 15 }, { 3, 8 }, { 15, 8 }, { 15, 3 }, { 8, 15 }, { 3, 15 }, { 15, 3 }, { 15, 8 },
+        { 8, 15 }, { 8, 15 }, { 6, 15 }, { 6, 15 }, { 6, 15 }, { 5, 15 }, { 3, 15 }, { 3, 8 },
+        { 3, 15 }, { 3, 8 }, { 8, 15 }, { 15, 3 }, { 3, 15 }, { 3, 8 }, { 6, 15 }, { 10, 8 },
+        { 5, 3 }, { 8, 15 }, { 8, 6 }, { 6, 10 }, { 8, 15 }, { 5, 15 }, { 15, 10 }, { 15, 8 },
+        { 8, 15 }, { 15, 3 }, { 3, 15 }, { 5, 10 }, { 6, 10 }, { 10, 8 }, { 8, 9 }, { 15, 10 },
+        { 15, 6 }, { 3, 15 }, { 15, 8 }, { 5, 15 }, { 15, 3 }, { 15, 6 }, { 15, 6 }, { 15, 8 },
+        { 3, 15 }, { 15, 3 }, { 5, 15 }, { 5, 15 }, { 5, 15 }, { 8, 15 }, { 5, 15 }, { 10, 15 },
+        { 5, 15 }, { 10, 15 }, { 8, 15 }, { 13, 15 }, { 15, 3 }, { 12, 15 }, { 3, 15 }, { 3, 8 },
+    };
+
+    static const int g_bc7Weights2[4] = { 0, 21, 43, 64 };
+    static const int g_bc7Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+    static const int g_bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    static const int *GetBC7Weights(int indexBits)
+    {
+        return (indexBits == 2) ? g_bc7Weights2 : ((indexBits == 3) ? g_bc7Weights3 : g_bc7Weights4);
+    }
+
+    class BitReader
+    {
+    public:
+        explicit BitReader(const uint8_t *data)
+            : m_data(data)
+            , m_offset(0)
+        {
+        }
+
+        int Read(int numBits)
+        {
+            int v = 0;
+            for (int i = 0; i < numBits; i++, m_offset++)
+                v |= ((m_data[m_offset / 8] >> (m_offset % 8)) & 1) << i;
+            return v;
+        }
+
+        void Skip(int numBits)
+        {
+            m_offset += numBits;
+        }
+
+    private:
+        const uint8_t *m_data;
+        int m_offset;
+    };
+
+    static int BC7Interpolate(int ep0, int ep1, int weight)
+    {
+        return ((64 - weight) * ep0 + weight * ep1 + 32) >> 6;
+    }
+
+    static void DecodeBC7(const uint8_t *pBC, cvtt::PixelBlockU8 &outBlock)
+    {
+        struct ModeInfo
+        {
+            int numSubsets;
+            int partitionBits;
+            int rotationBits;
+            int indexSelectionBits;
+            int colorBits;
+            int alphaBits;
+            bool endpointPBits;
+            bool sharedPBits;
+            int indexBits;
+            int secondaryIndexBits;
+        };
+
+        static const ModeInfo modes[8] =
+        {
+            { 3, 4, 0, 0, 4, 0, true,  false, 3, 0 },
+            { 2, 6, 0, 0, 6, 0, false, true,  3, 0 },
+            { 3, 6, 0, 0, 5, 0, false, false, 2, 0 },
+            { 2, 6, 0, 0, 7, 0, true,  false, 2, 0 },
+            { 1, 0, 2, 1, 5, 6, false, false, 2, 3 },
+            { 1, 0, 2, 0, 7, 8, false, false, 2, 2 },
+            { 1, 0, 0, 0, 7, 7, true,  false, 4, 0 },
+            { 2, 6, 0, 0, 5, 5, true,  false, 2, 0 },
+        };
+
+        BitReader reader(pBC);
+
+        int mode = 0;
+        while (mode < 8 && reader.Read(1) == 0)
+            mode++;
+
+        if (mode == 8)
+        {
+            memset(&outBlock, 0, sizeof(outBlock));
+            return;
+        }
+
+        const ModeInfo &info = modes[mode];
+        const int partition = reader.Read(info.partitionBits);
+        const int rotation = reader.Read(info.rotationBits);
+        const int indexSelection = reader.Read(info.indexSelectionBits);
+        const int numChannels = (info.alphaBits > 0) ? 4 : 3;
+
+        int endpoints[3][2][4];
+        int endpointBits[4];
+        for (int ch = 0; ch < numChannels; ch++)
+        {
+            endpointBits[ch] = (ch == 3) ? info.alphaBits : info.colorBits;
+            for (int subset = 0; subset < info.numSubsets; subset++)
+            {
+                for (int epi = 0; epi < 2; epi++)
+                    endpoints[subset][epi][ch] = reader.Read(endpointBits[ch]);
+            }
+        }
+
+        if (info.endpointPBits || info.sharedPBits)
+        {
+            int pBits[3][2];
+            for (int subset = 0; subset < info.numSubsets; subset++)
+            {
+                if (info.sharedPBits)
+                    pBits[subset][0] = pBits[subset][1] = reader.Read(1);
+                else
+                {
+                    for (int epi = 0; epi < 2; epi++)
+                        pBits[subset][epi] = reader.Read(1);
+                }
+            }
+
+            for (int subset = 0; subset < info.numSubsets; subset++)
+            {
+                for (int epi = 0; epi < 2; epi++)
+                {
+                    for (int ch = 0; ch < numChannels; ch++)
+                        endpoints[subset][epi][ch] = (endpoints[subset][epi][ch] << 1) | pBits[subset][epi];
+                }
+            }
+
+            for (int ch = 0; ch < numChannels; ch++)
+                endpointBits[ch]++;
+        }
+
+        for (int subset = 0; subset < info.numSubsets; subset++)
+        {
+            for (int epi = 0; epi < 2; epi++)
+            {
+                for (int ch = 0; ch < numChannels; ch++)
+                {
+                    const int v = endpoints[subset][epi][ch] << (8 - endpointBits[ch]);
+                    endpoints[subset][epi][ch] = v | (v >> endpointBits[ch]);
+                }
+
+                if (numChannels == 3)
+                    endpoints[subset][epi][3] = 255;
+            }
+        }
+
+        int subsets[16];
+        bool isAnchor[16];
+        for (int px = 0; px < 16; px++)
+        {
+            if (info.numSubsets == 2)
+                subsets[px] = (g_bc7PartitionMap2[partition] >> px) & 1;
+            else if (info.numSubsets == 3)
+                subsets[px] = (g_bc7PartitionMap3[partition] >> (px * 2)) & 3;
+            else
+                subsets[px] = 0;
+
+            isAnchor[px] = (px == 0);
+        }
+
+        if (info.numSubsets == 2)
+            isAnchor[g_bc7Anchors2[partition]] = true;
+        else if (info.numSubsets == 3)
+        {
+            isAnchor[g_bc7Anchors3[partition][0]] = true;
+            isAnchor[g_bc7Anchors3[partition][1]] = true;
+        }
+
+        int indexes[16];
+        for (int px = 0; px < 16; px++)
+            indexes[px] = reader.Read(isAnchor[px] ? info.indexBits - 1 : info.indexBits);
+
+        int secondaryIndexes[16];
+        for (int px = 0; px < 16 && info.secondaryIndexBits > 0; px++)
+            secondaryIndexes[px] = reader.Read((px == 0) ? info.secondaryIndexBits - 1 : info.secondaryIndexBits);
+
+        for (int px = 0; px < 16; px++)
+        {
+            const int subset = subsets[px];
+
+            int colorWeight = GetBC7Weights(info.indexBits)[indexes[px]];
+            int alphaWeight = colorWeight;
+            if (info.secondaryIndexBits > 0)
+            {
+                alphaWeight = GetBC7Weights(info.secondaryIndexBits)[secondaryIndexes[px]];
+                if (indexSelection)
+                    std::swap(colorWeight, alphaWeight);
+            }
+
+            int pixel[4];
+            for (int ch = 0; ch < 4; ch++)
+                pixel[ch] = BC7Interpolate(endpoints[subset][0][ch], endpoints[subset][1][ch], (ch == 3) ? alphaWeight : colorWeight);
+
+            if (rotation != 0)
+                std::swap(pixel[rotation - 1], pixel[3]);
+
+            for (int ch = 0; ch < 4; ch++)
+                outBlock.m_pixels[px][ch] = static_cast<uint8_t>(pixel[ch]);
+        }
+    }
+
+    // Bit layouts of the BC6H modes in the notation of the format specification, after the mode bits.  r0, g0, b0 are the first
+    // endpoint of the first subset, and d is the partition.  x[a:b] reads bit b first, stepping toward bit a.
+    struct BC6HModeInfo
+    {
+        int modeValue;
+        int modeBits;
+        bool partitioned;
+        bool transformed;
+        int aPrec;
+        int bPrec[3];
+        const char *layout;
+    };
+
+    static const BC6HModeInfo g_bc6hModes[14] =
+    {
+        { 0x00, 2, true, true, 10, { 5, 5, 5 }, "g2[4] b2[4] b3[4] r0[9:0] g0[9:0] b0[9:0] r1[4:0] g3[4] g2[3:0] g1[4:0] b3[0] g3[3:0] b1[4:0] b3[1] b2[3:0] r2[4:0] b3[2] r3[4:0] b3[3] d[4:0]" },
+        { 0x01, 2, true, true, 7, { 6, 6, 6 }, "g2[5] g3[4] g3[5] r0[6:0] b3[0] b3[1] b2[4] g0[6:0] b2[5] b3[2] g2[4] b0[6:0] b3[3] b3[5] b3[4] r1[5:0] g2[3:0] g1[5:0] g3[3:0] b1[5:0] b2[3:0] r2[5:0] r3[5:0] d[4:0]" },
+        { 0x02, 5, true, true, 11, { 5, 4, 4 }, "r0[9:0] g0[9:0] b0[9:0] r1[4:0] r0[10] g2[3:0] g1[3:0] g0[10] b3[0] g3[3:0] b1[3:0] b0[10] b3[1] b2[3:0] r2[4:0] b3[2] r3[4:0] b3[3] d[4:0]" },
+        { 0x06, 5, true, true, 11, { 4, 5, 4 }, "r0[9:0] g0[9:0] b0[9:0] r1[3:0] r0[10] g3[4] g2[3:0] g1[4:0] g0[10] g3[3:0] b1[3:0] b0[10] b3[1] b2[3:0] r2[3:0] b3[0] b3[2] r3[3:0] g2[4] b3[3] d[4:0]" },
+        { 0x0a, 5, true, true, 11, { 4, 4, 5 }, "r0[9:0] g0[9:0] b0[9:0] r1[3:0] r0[10] b2[4] g2[3:0] g1[3:0] g0[10] b3[0] g3[3:0] b1[4:0] b0[10] b2[3:0] r2[3:0] b3[1] b3[2] r3[3:0] b3[4] b3[3] d[4:0]" },
+        { 0x0e, 5, true, true, 9, { 5, 5, 5 }, "r0[8:0] b2[4] g0[8:0] g2[4] b0[8:0] b3[4] r1[4:0] g3[4] g2[3:0] g1[4:0] b3[0] g3[3:0] b1[4:0] b3[1] b2[3:0] r2[4:0] b3[2] r3[4:0] b3[3] d[4:0]" },
+        { 0x12, 5, true, true, 8, { 6, 5, 5 }, "r0[7:0] g3[4] b2[4] g0[7:0] b3[2] g2[4] b0[7:0] b3[3] b3[4] r1[5:0] g2[3:0] g1[4:0] b3[0] g3[3:0] b1[4:0] b3[1] b2[3:0] r2[5:0] r3[5:0] d[4:0]" },
+        { 0x16, 5, true, true, 8, { 5, 6, 5 }, "r0[7:0] b3[0] b2[4] g0[7:0] g2[5] g2[4] b0[7:0] g3[5] b3[4] r1[4:0] g3[4] g2[3:0] g1[5:0] g3[3:0] b1[4:0] b3[1] b2[3:0] r2[4:0] b3[2] r3[4:0] b3[3] d[4:0]" },
+        { 0x1a, 5, true, true, 8, { 5, 5, 6 }, "r0[7:0] b3[1] b2[4] g0[7:0] b2[5] g2[4] b0[7:0] b3[5] b3[4] r1[4:0] g3[4] g2[3:0] g1[4:0] b3[0] g3[3:0] b1[5:0] b2[3:0] r2[4:0] b3[2] r3[4:0] b3[3] d[4:0]" },
+        { 0x1e, 5, true, false, 6, { 6, 6, 6 }, "r0[5:0] g3[4] b3[0] b3[1] b2[4] g0[5:0] g2[5] b2[5] b3[2] g2[4] b0[5:0] g3[5] b3[3] b3[5] b3[4] r1[5:0] g2[3:0] g1[5:0] g3[3:0] b1[5:0] b2[3:0] r2[5:0] r3[5:0] d[4:0]" },
+        { 0x03, 5, false, false, 10, { 10, 10, 10 }, "r0[9:0] g0[9:0] b0[9:0] r1[9:0] g1[9:0] b1[9:0]" },
+        { 0x07, 5, false, true, 11, { 9, 9, 9 }, "r0[9:0] g0[9:0] b0[9:0] r1[8:0] r0[10] g1[8:0] g0[10] b1[8:0] b0[10]" },
+        { 0x0b, 5, false, true, 12, { 8, 8, 8 }, "r0[9:0] g0[9:0] b0[9:0] r1[7:0] r0[10:11] g1[7:0] g0[10:11] b1[7:0] b0[10:11]" },
+        { 0x0f, 5, false, true, 16, { 4, 4, 4 }, "r0[9:0] g0[9:0] b0[9:0] r1[3:0] r0[10:15] g1[3:0] g0[10:15] b1[3:0] b0[10:15]" },
+    };
+
+    static int ParseInt(const char *&str)
+    {
+        int v = 0;
+        while (*str >= '0' && *str <= '9')
+            v = v * 10 + (*str++ - '0');
+        return v;
+    }
+
+    static int SignExtend(int v, int bits)
+    {
+        v &= (1 << bits) - 1;
+        return (v & (1 << (bits - 1))) ? (v - (1 << bits)) : v;
+    }
+
+    static int UnquantizeBC6H(int comp, int prec, bool isSigned)
+    {
+        if (isSigned)
+        {
+            if (prec >= 16)
+                return comp;
+
+            const bool isNegative = (comp < 0);
+            const int absComp = isNegative ? -comp : comp;
+
+            int unq;
+            if (absComp == 0)
+                unq = 0;
+            else if (absComp >= (1 << (prec - 1)) - 1)
+                unq = 0x7fff;
+            else
+                unq = ((absComp << 15) + 0x4000) >> (prec - 1);
+
+            return isNegative ? -unq : unq;
+        }
+
+        if (prec >= 15 || comp == 0)
+            return comp;
+        if (comp == (1 << prec) - 1)
+            return 0xffff;
+        return ((comp << 16) + 0x8000) >> prec;
+    }
+
+    static int16_t FinishUnquantizeBC6H(int comp, bool isSigned)
+    {
+        if (isSigned)
+        {
+            comp = (comp < 0) ? -(((-comp) * 31) >> 5) : ((comp * 31) >> 5);
+            if (comp < 0)
+                return static_cast<int16_t>(0x8000 | -comp);
+            return static_cast<int16_t>(comp);
+        }
+
+        return static_cast<int16_t>((comp * 31) >> 6);
+    }
+
+    static void DecodeBC6H(const uint8_t *pBC, bool isSigned, cvtt::PixelBlockF16 &outBlock)
+    {
+        const BC6HModeInfo *modeInfo = NULL;
+        for (int i = 0; i < 14; i++)
+        {
+            const BC6HModeInfo &candidate = g_bc6hModes[i];
+            if ((pBC[0] & ((1 << candidate.modeBits) - 1)) == candidate.modeValue)
+                modeInfo = &candidate;
+        }
+
+        if (modeInfo == NULL)
+        {
+            for (int px = 0; px < 16; px++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                    outBlock.m_pixels[px][ch] = 0;
+                outBlock.m_pixels[px][3] = 0x3c00;
+            }
+            return;
+        }
+
+        BitReader reader(pBC);
+        reader.Skip(modeInfo->modeBits);
+
+        // [channel][r0..r3], with the partition in channel 3
+        int fields[4][4];
+        memset(fields, 0, sizeof(fields));
+
+        const char *layout = modeInfo->layout;
+        while (*layout != '\0')
+        {
+            const char channelName = *layout++;
+            const int channel = (channelName == 'r') ? 0 : ((channelName == 'g') ? 1 : ((channelName == 'b') ? 2 : 3));
+            const int endpoint = (channel == 3) ? 0 : ParseInt(layout);
+
+            layout++;
+            const int lastBit = ParseInt(layout);
+            int firstBit = lastBit;
+            if (*layout == ':')
+            {
+                layout++;
+                firstBit = ParseInt(layout);
+            }
+            layout++;
+
+            for (int bit = firstBit;; bit += (firstBit <= lastBit) ? 1 : -1)
+            {
+                fields[channel][endpoint] |= reader.Read(1) << bit;
+                if (bit == lastBit)
+                    break;
+            }
+
+            if (*layout == ' ')
+                layout++;
+        }
+
+        const bool isPartitioned = modeInfo->partitioned;
+        const int numSubsets = isPartitioned ? 2 : 1;
+        const int partition = fields[3][0];
+        const int aPrec = modeInfo->aPrec;
+
+        int eps[2][2][3];
+        for (int subset = 0; subset < numSubsets; subset++)
+        {
+            for (int epi = 0; epi < 2; epi++)
+            {
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    int ep = fields[ch][subset * 2 + epi];
+
+                    if (subset == 0 && epi == 0)
+                    {
+                        if (isSigned)
+                            ep = SignExtend(ep, aPrec);
+                    }
+                    else
+                    {
+                        if (modeInfo->transformed || isSigned)
+                            ep = SignExtend(ep, modeInfo->bPrec[ch]);
+
+                        if (modeInfo->transformed)
+                        {
+                            ep = (ep + fields[ch][0]) & ((1 << aPrec) - 1);
+                            if (isSigned)
+                                ep = SignExtend(ep, aPrec);
+                        }
+                    }
+
+                    eps[subset][epi][ch] = UnquantizeBC6H(ep, aPrec, isSigned);
+                }
+            }
+        }
+
+        const int indexBits = isPartitioned ? 3 : 4;
+        const int *weights = GetBC7Weights(indexBits);
+
+        BitReader indexReader(pBC);
+        indexReader.Skip(isPartitioned ? 82 : 65);
+
+        for (int px = 0; px < 16; px++)
+        {
+            int subset = 0;
+            bool isAnchor = (px == 0);
+            if (isPartitioned)
+            {
+                subset = (g_bc7PartitionMap2[partition] >> px) & 1;
+                isAnchor = isAnchor || (px == g_bc7Anchors2[partition]);
+            }
+
+            const int weight = weights[indexReader.Read(isAnchor ? indexBits - 1 : indexBits)];
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                const int interpolated = ((64 - weight) * eps[subset][0][ch] + weight * eps[subset][1][ch] + 32) >> 6;
+                outBlock.m_pixels[px][ch] = FinishUnquantizeBC6H(interpolated, isSigned);
+            }
+            outBlock.m_pixels[px][3] = 0x3c00;
+        }
+    }
+
+    static void DecodeBC6HU(const uint8_t *pBC, cvtt::PixelBlockF16 &outBlock)
+    {
+        DecodeBC6H(pBC, false, outBlock);
+    }
+
+    static void DecodeBC6HS(const uint8_t *pBC, cvtt::PixelBlockF16 &outBlock)
+    {
+        DecodeBC6H(pBC, true, outBlock);
+    }
+}
+
+// Decodes data with both decoders and returns the number of blocks that differ
+template<class TBlock>
+static size_t CountDecodeMismatches(const std::vector<uint8_t> &data, size_t blockSize,
+    void (*decodeBatchFunc)(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks),
+    void (*referenceDecodeFunc)(const uint8_t *pBC, TBlock &outBlock))
+{
+    const size_t numBlocks = data.size() / blockSize;
+
+    std::vector<TBlock> decoded(numBlocks);
+    decodeBatchFunc(&decoded[0], &data[0], numBlocks);
+
+    size_t numMismatches = 0;
+    for (size_t i = 0; i < numBlocks; i++)
+    {
+        TBlock expected;
+        referenceDecodeFunc(&data[i * blockSize], expected);
+        if (memcmp(&expected, &decoded[i], sizeof(TBlock)) != 0)
+            numMismatches++;
+    }
+
+    return numMismatches;
+}
+
+static double GetPixelValue(const cvtt::PixelBlockU8 &block, int px, int ch)
+{
+    return block.m_pixels[px][ch];
+}
+
+static double GetPixelValue(const cvtt::PixelBlockS8 &block, int px, int ch)
+{
+    return block.m_pixels[px][ch];
+}
+
+static double GetPixelValue(const cvtt::PixelBlockScalarS16 &block, int px, int ch)
+{
+    (void)ch;
+    return block.m_pixels[px];
+}
+
+static double GetPixelValue(const cvtt::PixelBlockF16 &block, int px, int ch)
+{
+    return HalfToFloat(static_cast<uint16_t>(block.m_pixels[px][ch]));
+}
+
+template<class TBlock>
+static double ComputeRMSE(const std::vector<TBlock> &original, const std::vector<TBlock> &decoded, int firstChannel, int numChannels)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < original.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            for (int ch = firstChannel; ch < firstChannel + numChannels; ch++)
+            {
+                const double diff = GetPixelValue(original[i], px, ch) - GetPixelValue(decoded[i], px, ch);
+                sum += diff * diff;
+            }
+        }
+    }
+
+    return sqrt(sum / static_cast<double>(original.size() * 16 * numChannels));
+}
+
+static int g_numFailures = 0;
+
+static void ReportMismatches(const char *name, size_t numMismatches, size_t numBlocks)
+{
+    if (numMismatches == 0)
+        printf("PASS %s\n", name);
+    else
+    {
+        printf("FAIL %s: %u of %u blocks differ from the reference decoder\n", name, static_cast<unsigned int>(numMismatches), static_cast<unsigned int>(numBlocks));
+        g_numFailures++;
+    }
+}
+
+static void ReportRMSE(const char *name, double rmse, double maxRMSE)
+{
+    if (rmse <= maxRMSE)
+        printf("PASS %s (RMSE %.3f)\n", name, rmse);
+    else
+    {
+        printf("FAIL %s: RMSE %.3f is above %.3f\n", name, rmse, maxRMSE);
+        g_numFailures++;
+    }
+}
+
+template<class TBlock>
+static void TestDecoder(const char *name, const std::vector<uint8_t> &data, size_t blockSize,
+    void (*decodeBatchFunc)(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks),
+    void (*referenceDecodeFunc)(const uint8_t *pBC, TBlock &outBlock))
+{
+    ReportMismatches(name, CountDecodeMismatches(data, blockSize, decodeBatchFunc, referenceDecodeFunc), data.size() / blockSize);
+}
+
+// Checks that the library decoder matches the reference decoder on encoder output, and checks the round-trip error
+template<class TBlock>
+static void TestEncodedBlocks(const char *name, const std::vector<TBlock> &blocks, const std::vector<uint8_t> &encoded, size_t blockSize,
+    int firstChannel, int numChannels, double maxRMSE,
+    void (*decodeBatchFunc)(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks),
+    void (*referenceDecodeFunc)(const uint8_t *pBC, TBlock &outBlock))
+{
+    std::vector<TBlock> decoded(blocks.size());
+    decodeBatchFunc(&decoded[0], &encoded[0], blocks.size());
+
+    char testName[256];
+    sprintf(testName, "%s decode", name);
+    TestDecoder(testName, encoded, blockSize, decodeBatchFunc, referenceDecodeFunc);
+
+    sprintf(testName, "%s round trip", name);
+    ReportRMSE(testName, ComputeRMSE(blocks, decoded, firstChannel, numChannels), maxRMSE);
+}
+
+template<class TBlock>
+static void TestEncoder(const char *name, const std::vector<TBlock> &blocks, size_t blockSize, int firstChannel, int numChannels, double maxRMSE,
+    void (*encodeBatchFunc)(uint8_t *pBC, const TBlock *pBlocks, size_t numBlocks, const cvtt::Options &options),
+    void (*decodeBatchFunc)(TBlock *pBlocks, const uint8_t *pBC, size_t numBlocks),
+    void (*referenceDecodeFunc)(const uint8_t *pBC, TBlock &outBlock),
+    const cvtt::Options &options)
+{
+    std::vector<uint8_t> encoded(blocks.size() * blockSize);
+    encodeBatchFunc(&encoded[0], &blocks[0], blocks.size(), options);
+
+    TestEncodedBlocks(name, blocks, encoded, blockSize, firstChannel, numChannels, maxRMSE, decodeBatchFunc, referenceDecodeFunc);
+}
+
+static void TestS3TC(const std::vector<cvtt::PixelBlockU8> &blocks, const std::vector<cvtt::PixelBlockS8> &signedBlocks)
+{
+    std::vector<uint8_t> random8;
+    std::vector<uint8_t> random16;
+    GenerateRandomData(random8, 8, 1);
+    GenerateRandomData(random16, 16, 2);
+
+    TestDecoder("bc1 random data", random8, 8, cvtt::Kernels::DecodeBC1Batch, Reference::DecodeBC1);
+    TestDecoder("bc2 random data", random16, 16, cvtt::Kernels::DecodeBC2Batch, Reference::DecodeBC2);
+    TestDecoder("bc3 random data", random16, 16, cvtt::Kernels::DecodeBC3Batch, Reference::DecodeBC3);
+    TestDecoder("bc4u random data", random8, 8, cvtt::Kernels::DecodeBC4UBatch, Reference::DecodeBC4U);
+    TestDecoder("bc4s random data", random8, 8, cvtt::Kernels::DecodeBC4SBatch, Reference::DecodeBC4S);
+    TestDecoder("bc5u random data", random16, 16, cvtt::Kernels::DecodeBC5UBatch, Reference::DecodeBC5U);
+    TestDecoder("bc5s random data", random16, 16, cvtt::Kernels::DecodeBC5SBatch, Reference::DecodeBC5S);
+
+    cvtt::Options options;
+    options.flags = cvtt::Flags::Default;
+
+    TestEncoder("bc1", blocks, 8, 0, 3, 30.0, cvtt::Kernels::EncodeBC1Batch, cvtt::Kernels::DecodeBC1Batch, Reference::DecodeBC1, options);
+    TestEncoder("bc2", blocks, 16, 0, 4, 25.0, cvtt::Kernels::EncodeBC2Batch, cvtt::Kernels::DecodeBC2Batch, Reference::DecodeBC2, options);
+    TestEncoder("bc3", blocks, 16, 0, 4, 25.0, cvtt::Kernels::EncodeBC3Batch, cvtt::Kernels::DecodeBC3Batch, Reference::DecodeBC3, options);
+    TestEncoder("bc4u", blocks, 8, 0, 1, 4.0, cvtt::Kernels::EncodeBC4UBatch, cvtt::Kernels::DecodeBC4UBatch, Reference::DecodeBC4U, options);
+    TestEncoder("bc4s", signedBlocks, 8, 0, 1, 4.0, cvtt::Kernels::EncodeBC4SBatch, cvtt::Kernels::DecodeBC4SBatch, Reference::DecodeBC4S, options);
+    TestEncoder("bc5u", blocks, 16, 0, 2, 4.0, cvtt::Kernels::EncodeBC5UBatch, cvtt::Kernels::DecodeBC5UBatch, Reference::DecodeBC5U, options);
+    TestEncoder("bc5s", signedBlocks, 16, 0, 2, 4.0, cvtt::Kernels::EncodeBC5SBatch, cvtt::Kernels::DecodeBC5SBatch, Reference::DecodeBC5S, options);
+
+    // The real-time encoder uses punchthrough alpha for BC1 whenever a pixel is below the alpha threshold
+    std::vector<cvtt::PixelBlockU8> cutoutBlocks;
+    GenerateCutoutBlocks(cutoutBlocks, blocks);
+
+    options.flags = cvtt::Flags::Fastest | cvtt::Flags::S3TC_RealTime;
+
+    TestEncoder("bc1 real-time", cutoutBlocks, 8, 0, 4, 22.0, cvtt::Kernels::EncodeBC1Batch, cvtt::Kernels::DecodeBC1Batch, Reference::DecodeBC1, options);
+    TestEncoder("bc3 real-time", blocks, 16, 0, 4, 32.0, cvtt::Kernels::EncodeBC3Batch, cvtt::Kernels::DecodeBC3Batch, Reference::DecodeBC3, options);
+    TestEncoder("bc4u real-time", blocks, 8, 0, 1, 4.5, cvtt::Kernels::EncodeBC4UBatch, cvtt::Kernels::DecodeBC4UBatch, Reference::DecodeBC4U, options);
+    TestEncoder("bc4s real-time", signedBlocks, 8, 0, 1, 4.5, cvtt::Kernels::EncodeBC4SBatch, cvtt::Kernels::DecodeBC4SBatch, Reference::DecodeBC4S, options);
+    TestEncoder("bc5u real-time", blocks, 16, 0, 2, 4.5, cvtt::Kernels::EncodeBC5UBatch, cvtt::Kernels::DecodeBC5UBatch, Reference::DecodeBC5U, options);
+    TestEncoder("bc5s real-time", signedBlocks, 16, 0, 2, 4.5, cvtt::Kernels::EncodeBC5SBatch, cvtt::Kernels::DecodeBC5SBatch, Reference::DecodeBC5S, options);
+}
+
+static void *AllocCompressionData(void *context, size_t size)
+{
+    (void)context;
+    return malloc(size);
+}
+
+static void FreeCompressionData(void *context, void *ptr, size_t size)
+{
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static void DecodeETC2Alpha11UBatch(cvtt::PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+{
+    cvtt::Kernels::DecodeETC2Alpha11Batch(pBlocks, pBC, numBlocks, false);
+}
+
+static void DecodeETC2Alpha11SBatch(cvtt::PixelBlockScalarS16 *pBlocks, const uint8_t *pBC, size_t numBlocks)
+{
+    cvtt::Kernels::DecodeETC2Alpha11Batch(pBlocks, pBC, numBlocks, true);
+}
+
+static void TestETC(const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    std::vector<uint8_t> random8;
+    std::vector<uint8_t> random16;
+    GenerateRandomData(random8, 8, 3);
+    GenerateRandomData(random16, 16, 4);
+
+    TestDecoder("etc2 random data", random8, 8, cvtt::Kernels::DecodeETC2Batch, Reference::DecodeETC2);
+    TestDecoder("etc2 punchthrough random data", random8, 8, cvtt::Kernels::DecodeETC2PunchthroughAlphaBatch, Reference::DecodeETC2PunchthroughAlpha);
+    TestDecoder("etc2 rgba random data", random16, 16, cvtt::Kernels::DecodeETC2RGBABatch, Reference::DecodeETC2RGBA);
+    TestDecoder("etc2 alpha random data", random8, 8, cvtt::Kernels::DecodeETC2AlphaBatch, Reference::DecodeETC2Alpha);
+    TestDecoder("r11u random data", random8, 8, DecodeETC2Alpha11UBatch, Reference::DecodeETC2Alpha11<false>);
+    TestDecoder("r11s random data", random8, 8, DecodeETC2Alpha11SBatch, Reference::DecodeETC2Alpha11<true>);
+
+    cvtt::Options options;
+    options.flags = cvtt::Flags::Default;
+
+    cvtt::ETC1CompressionData *etc1Data = cvtt::Kernels::AllocETC1Data(AllocCompressionData, NULL);
+    cvtt::ETC2CompressionData *etc2Data = cvtt::Kernels::AllocETC2Data(AllocCompressionData, NULL, options);
+
+    std::vector<cvtt::PixelBlockU8> cutoutBlocks;
+    GenerateCutoutBlocks(cutoutBlocks, blocks);
+
+    std::vector<cvtt::PixelBlockScalarS16> unsigned11(blocks.size());
+    std::vector<cvtt::PixelBlockScalarS16> signed11(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            unsigned11[i].m_pixels[px] = static_cast<int16_t>(blocks[i].m_pixels[px][0] * 2047 / 255);
+            signed11[i].m_pixels[px] = static_cast<int16_t>(blocks[i].m_pixels[px][1] * 2046 / 255 - 1023);
+        }
+    }
+
+    std::vector<uint8_t> encoded8(blocks.size() * 8);
+    std::vector<uint8_t> encoded16(blocks.size() * 16);
+
+    cvtt::Kernels::EncodeETC1Batch(&encoded8[0], &blocks[0], blocks.size(), options, etc1Data);
+    TestEncodedBlocks("etc1", blocks, encoded8, 8, 0, 3, 37.0, cvtt::Kernels::DecodeETC1Batch, Reference::DecodeETC2);
+
+    cvtt::Kernels::EncodeETC2Batch(&encoded8[0], &blocks[0], blocks.size(), options, etc2Data);
+    TestEncodedBlocks("etc2", blocks, encoded8, 8, 0, 3, 30.0, cvtt::Kernels::DecodeETC2Batch, Reference::DecodeETC2);
+
+    cvtt::Kernels::EncodeETC2PunchthroughAlphaBatch(&encoded8[0], &cutoutBlocks[0], cutoutBlocks.size(), options, etc2Data);
+    TestEncodedBlocks("etc2 punchthrough", cutoutBlocks, encoded8, 8, 0, 4, 18.0, cvtt::Kernels::DecodeETC2PunchthroughAlphaBatch, Reference::DecodeETC2PunchthroughAlpha);
+
+    cvtt::Kernels::EncodeETC2RGBABatch(&encoded16[0], &blocks[0], blocks.size(), options, etc2Data);
+    TestEncodedBlocks("etc2 rgba", blocks, encoded16, 16, 0, 4, 26.0, cvtt::Kernels::DecodeETC2RGBABatch, Reference::DecodeETC2RGBA);
+
+    cvtt::Kernels::EncodeETC2AlphaBatch(&encoded8[0], &blocks[0], blocks.size(), options);
+    TestEncodedBlocks("etc2 alpha", blocks, encoded8, 8, 3, 1, 4.0, cvtt::Kernels::DecodeETC2AlphaBatch, Reference::DecodeETC2Alpha);
+
+    cvtt::Kernels::EncodeETC2Alpha11Batch(&encoded8[0], &unsigned11[0], unsigned11.size(), false, options);
+    TestEncodedBlocks("r11u", unsigned11, encoded8, 8, 0, 1, 31.0, DecodeETC2Alpha11UBatch, Reference::DecodeETC2Alpha11<false>);
+
+    cvtt::Kernels::EncodeETC2Alpha11Batch(&encoded8[0], &signed11[0], signed11.size(), true, options);
+    TestEncodedBlocks("r11s", signed11, encoded8, 8, 0, 1, 31.0, DecodeETC2Alpha11SBatch, Reference::DecodeETC2Alpha11<true>);
+
+    cvtt::Kernels::ReleaseETC1Data(etc1Data, FreeCompressionData);
+    cvtt::Kernels::ReleaseETC2Data(etc2Data, FreeCompressionData);
+}
+
+static void TestBC7(const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    // Random bytes are mostly mode 0, so the mode bits are overwritten to cover every mode and the reserved mode evenly
+    std::vector<uint8_t> random16;
+    GenerateRandomData(random16, 16, 5);
+    for (size_t i = 0; i < kNumTestBlocks; i++)
+    {
+        const int mode = static_cast<int>(i % 9);
+        uint8_t &modeByte = random16[i * 16];
+        if (mode == 8)
+            modeByte = 0;
+        else
+            modeByte = static_cast<uint8_t>((modeByte & ~((2 << mode) - 1)) | (1 << mode));
+    }
+
+    TestDecoder("bc7 random data", random16, 16, cvtt::Kernels::DecodeBC7Batch, Reference::DecodeBC7);
+
+    cvtt::Options options;
+    options.flags = cvtt::Flags::Default;
+
+    std::vector<uint8_t> encoded(blocks.size() * 16);
+
+    cvtt::BC7EncodingPlan plan;
+    cvtt::Kernels::EncodeBC7Batch(&encoded[0], &blocks[0], blocks.size(), options, plan);
+    TestEncodedBlocks("bc7", blocks, encoded, 16, 0, 4, 24.0, cvtt::Kernels::DecodeBC7Batch, Reference::DecodeBC7);
+
+    cvtt::Kernels::ConfigureBC7EncodingPlanFromQuality(plan, 10);
+    cvtt::Kernels::EncodeBC7Batch(&encoded[0], &blocks[0], blocks.size(), options, plan);
+    TestEncodedBlocks("bc7 quality 10", blocks, encoded, 16, 0, 4, 24.0, cvtt::Kernels::DecodeBC7Batch, Reference::DecodeBC7);
+
+    options.flags = cvtt::Flags::Fastest | cvtt::Flags::BC7_RealTime;
+    cvtt::Kernels::EncodeBC7Batch(&encoded[0], &blocks[0], blocks.size(), options, plan);
+    TestEncodedBlocks("bc7 real-time", blocks, encoded, 16, 0, 4, 25.0, cvtt::Kernels::DecodeBC7Batch, Reference::DecodeBC7);
+}
+
+// Decodes the data as a surface whose size isn't a multiple of the block size, and checks it against the batch decoder
+static void TestBC6HSurface(const char *name, const std::vector<uint8_t> &data, bool isSigned)
+{
+    const uint32_t widthInBlocks = 512;
+    const uint32_t heightInBlocks = static_cast<uint32_t>(data.size() / 16 / widthInBlocks);
+    const uint32_t width = widthInBlocks * 4 - 3;
+    const uint32_t height = heightInBlocks * 4 - 1;
+
+    std::vector<cvtt::PixelBlockF16> decoded(data.size() / 16);
+    if (isSigned)
+        cvtt::Kernels::DecodeBC6HSBatch(&decoded[0], &data[0], decoded.size());
+    else
+        cvtt::Kernels::DecodeBC6HUBatch(&decoded[0], &data[0], decoded.size());
+
+    std::vector<int16_t> halfPixels(width * height * 4);
+    std::vector<float> floatPixels(width * height * 3);
+    bool succeeded = cvtt::Kernels::DecodeBC6HSurface(&data[0], widthInBlocks * 16, width, height, isSigned, cvtt::HDRSurfaceFormat_RGBA16F, &halfPixels[0], width * 8);
+    succeeded = succeeded && cvtt::Kernels::DecodeBC6HSurface(&data[0], widthInBlocks * 16, width, height, isSigned, cvtt::HDRSurfaceFormat_RGB32F, &floatPixels[0], width * 12);
+
+    size_t numMismatches = 0;
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            const cvtt::PixelBlockF16 &block = decoded[(y / 4) * widthInBlocks + x / 4];
+            const int16_t *expected = block.m_pixels[(y % 4) * 4 + x % 4];
+            const size_t pixelIndex = y * width + x;
+
+            bool matches = (memcmp(&halfPixels[pixelIndex * 4], expected, 8) == 0);
+            for (int ch = 0; ch < 3; ch++)
+                matches = matches && (floatPixels[pixelIndex * 3 + ch] == HalfToFloat(static_cast<uint16_t>(expected[ch])));
+
+            if (!matches)
+                numMismatches++;
+        }
+    }
+
+    // Unknown output formats are rejected
+    if (cvtt::Kernels::DecodeBC6HSurface(&data[0], widthInBlocks * 16, width, height, isSigned, static_cast<cvtt::HDRSurfaceFormat>(2), &floatPixels[0], width * 12))
+        succeeded = false;
+
+    if (!succeeded)
+    {
+        printf("FAIL %s: DecodeBC6HSurface returned the wrong result\n", name);
+        g_numFailures++;
+    }
+    else if (numMismatches != 0)
+    {
+        printf("FAIL %s: %u of %u pixels differ from the batch decoder\n", name, static_cast<unsigned int>(numMismatches), width * height);
+        g_numFailures++;
+    }
+    else
+        printf("PASS %s\n", name);
+}
+
+static void TestBC6H(const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    // Random bytes are mostly mode 0, so the mode bits are overwritten to cover every mode and the reserved modes evenly
+    static const uint8_t reservedModes[2] = { 0x13, 0x1f };
+
+    std::vector<uint8_t> random16;
+    GenerateRandomData(random16, 16, 6);
+    for (size_t i = 0; i < kNumTestBlocks; i++)
+    {
+        const size_t modeIndex = i % 16;
+        uint8_t &modeByte = random16[i * 16];
+        if (modeIndex < 14)
+        {
+            const Reference::BC6HModeInfo &modeInfo = Reference::g_bc6hModes[modeIndex];
+            modeByte = static_cast<uint8_t>((modeByte & ~((1 << modeInfo.modeBits) - 1)) | modeInfo.modeValue);
+        }
+        else
+            modeByte = static_cast<uint8_t>((modeByte & ~0x1f) | reservedModes[modeIndex - 14]);
+    }
+
+    TestDecoder("bc6hu random data", random16, 16, cvtt::Kernels::DecodeBC6HUBatch, Reference::DecodeBC6HU);
+    TestDecoder("bc6hs random data", random16, 16, cvtt::Kernels::DecodeBC6HSBatch, Reference::DecodeBC6HS);
+    TestBC6HSurface("bc6hu surface decode", random16, false);
+    TestBC6HSurface("bc6hs surface decode", random16, true);
+
+    // Squaring the 8-bit values gives a range of about 0 to 4 with more precision near 0
+    std::vector<cvtt::PixelBlockF16> unsignedBlocks(blocks.size());
+    std::vector<cvtt::PixelBlockF16> signedBlocks(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            for (int ch = 0; ch < 4; ch++)
+            {
+                const float v = blocks[i].m_pixels[px][ch] / 255.0f;
+                unsignedBlocks[i].m_pixels[px][ch] = static_cast<int16_t>(FloatToHalf(v * v * 4.0f));
+                signedBlocks[i].m_pixels[px][ch] = static_cast<int16_t>(FloatToHalf((v - 0.5f) * std::fabs(v - 0.5f) * 16.0f));
+            }
+        }
+    }
+
+    cvtt::Options options;
+    options.flags = cvtt::Flags::Default;
+
+    TestEncoder("bc6hu", unsignedBlocks, 16, 0, 3, 0.45, cvtt::Kernels::EncodeBC6HUBatch, cvtt::Kernels::DecodeBC6HUBatch, Reference::DecodeBC6HU, options);
+
+    // The signed encoder doesn't fit blocks with only negative values well, so only the decoders are compared on its output
+    std::vector<uint8_t> encoded(signedBlocks.size() * 16);
+    cvtt::Kernels::EncodeBC6HSBatch(&encoded[0], &signedBlocks[0], signedBlocks.size(), options);
+    TestDecoder("bc6hs decode", encoded, 16, cvtt::Kernels::DecodeBC6HSBatch, Reference::DecodeBC6HS);
+}
+
+// Converts an RGBA8 color to a source pixel in the layout that EncodeSurface expects for a format
+static void ConvertSurfacePixel(cvtt::SurfaceFormat format, const uint8_t color[4], uint8_t *outPixel)
+{
+    switch (format)
+    {
+    case cvtt::SurfaceFormat_BC4S:
+    case cvtt::SurfaceFormat_BC5S:
+        for (int ch = 0; ch < 4; ch++)
+            outPixel[ch] = static_cast<uint8_t>(std::max(-127, color[ch] - 128));
+        break;
+    case cvtt::SurfaceFormat_BC6HU:
+    case cvtt::SurfaceFormat_BC6HS:
+        for (int ch = 0; ch < 4; ch++)
+        {
+            const float v = color[ch] / 255.0f;
+            const uint16_t half = FloatToHalf((format == cvtt::SurfaceFormat_BC6HS) ? (v - 0.5f) * std::fabs(v - 0.5f) * 16.0f : v * v * 4.0f);
+            memcpy(outPixel + ch * 2, &half, 2);
+        }
+        break;
+    case cvtt::SurfaceFormat_ETC2Alpha11U:
+    case cvtt::SurfaceFormat_ETC2Alpha11S:
+        {
+            const int16_t value = static_cast<int16_t>((format == cvtt::SurfaceFormat_ETC2Alpha11S) ? color[0] * 2046 / 255 - 1023 : color[0] * 2047 / 255);
+            memcpy(outPixel, &value, 2);
+        }
+        break;
+    default:
+        memcpy(outPixel, color, 4);
+        break;
+    }
+}
+
+// Gathers the blocks of a surface, repeating the last row and column for edge blocks the same way that EncodeSurface pads them
+template<class TBlock>
+static void GatherSurfaceBlocks(const std::vector<uint8_t> &pixels, uint32_t width, uint32_t height, std::vector<TBlock> &outBlocks)
+{
+    const uint32_t widthInBlocks = (width + 3) / 4;
+    const uint32_t heightInBlocks = (height + 3) / 4;
+    const size_t pixelSize = sizeof(outBlocks[0].m_pixels[0]);
+
+    outBlocks.resize(widthInBlocks * heightInBlocks);
+    for (size_t i = 0; i < outBlocks.size(); i++)
+    {
+        for (int px = 0; px < 16; px++)
+        {
+            const uint32_t x = std::min<uint32_t>(static_cast<uint32_t>(i % widthInBlocks) * 4 + px % 4, width - 1);
+            const uint32_t y = std::min<uint32_t>(static_cast<uint32_t>(i / widthInBlocks) * 4 + px / 4, height - 1);
+            memcpy(&outBlocks[i].m_pixels[px], &pixels[(y * width + x) * pixelSize], pixelSize);
+        }
+    }
+}
+
+// Encodes a surface with the Batch encoders, one block at a time from manually gathered blocks
+static void EncodeGatheredSurface(cvtt::SurfaceFormat format, const std::vector<uint8_t> &pixels, uint32_t width, uint32_t height, uint8_t *pBC,
+    const cvtt::Options &options, cvtt::ETC1CompressionData *etc1Data, cvtt::ETC2CompressionData *etc2Data)
+{
+    std::vector<cvtt::PixelBlockU8> u8Blocks;
+    std::vector<cvtt::PixelBlockS8> s8Blocks;
+    std::vector<cvtt::PixelBlockF16> f16Blocks;
+    std::vector<cvtt::PixelBlockScalarS16> s16Blocks;
+
+    switch (format)
+    {
+    case cvtt::SurfaceFormat_BC4S:
+    case cvtt::SurfaceFormat_BC5S:
+        GatherSurfaceBlocks(pixels, width, height, s8Blocks);
+        break;
+    case cvtt::SurfaceFormat_BC6HU:
+    case cvtt::SurfaceFormat_BC6HS:
+        GatherSurfaceBlocks(pixels, width, height, f16Blocks);
+        break;
+    case cvtt::SurfaceFormat_ETC2Alpha11U:
+    case cvtt::SurfaceFormat_ETC2Alpha11S:
+        GatherSurfaceBlocks(pixels, width, height, s16Blocks);
+        break;
+    default:
+        GatherSurfaceBlocks(pixels, width, height, u8Blocks);
+        break;
+    }
+
+    cvtt::BC7EncodingPlan encodingPlan;
+
+    switch (format)
+    {
+    case cvtt::SurfaceFormat_BC1:
+        cvtt::Kernels::EncodeBC1Batch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC2:
+        cvtt::Kernels::EncodeBC2Batch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC3:
+        cvtt::Kernels::EncodeBC3Batch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC4U:
+        cvtt::Kernels::EncodeBC4UBatch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC4S:
+        cvtt::Kernels::EncodeBC4SBatch(pBC, &s8Blocks[0], s8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC5U:
+        cvtt::Kernels::EncodeBC5UBatch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC5S:
+        cvtt::Kernels::EncodeBC5SBatch(pBC, &s8Blocks[0], s8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC6HU:
+        cvtt::Kernels::EncodeBC6HUBatch(pBC, &f16Blocks[0], f16Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC6HS:
+        cvtt::Kernels::EncodeBC6HSBatch(pBC, &f16Blocks[0], f16Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_BC7:
+        cvtt::Kernels::EncodeBC7Batch(pBC, &u8Blocks[0], u8Blocks.size(), options, encodingPlan);
+        break;
+    case cvtt::SurfaceFormat_ETC1:
+        cvtt::Kernels::EncodeETC1Batch(pBC, &u8Blocks[0], u8Blocks.size(), options, etc1Data);
+        break;
+    case cvtt::SurfaceFormat_ETC2:
+        cvtt::Kernels::EncodeETC2Batch(pBC, &u8Blocks[0], u8Blocks.size(), options, etc2Data);
+        break;
+    case cvtt::SurfaceFormat_ETC2RGBA:
+        cvtt::Kernels::EncodeETC2RGBABatch(pBC, &u8Blocks[0], u8Blocks.size(), options, etc2Data);
+        break;
+    case cvtt::SurfaceFormat_ETC2PunchthroughAlpha:
+        cvtt::Kernels::EncodeETC2PunchthroughAlphaBatch(pBC, &u8Blocks[0], u8Blocks.size(), options, etc2Data);
+        break;
+    case cvtt::SurfaceFormat_ETC2Alpha:
+        cvtt::Kernels::EncodeETC2AlphaBatch(pBC, &u8Blocks[0], u8Blocks.size(), options);
+        break;
+    case cvtt::SurfaceFormat_ETC2Alpha11U:
+        cvtt::Kernels::EncodeETC2Alpha11Batch(pBC, &s16Blocks[0], s16Blocks.size(), false, options);
+        break;
+    case cvtt::SurfaceFormat_ETC2Alpha11S:
+        cvtt::Kernels::EncodeETC2Alpha11Batch(pBC, &s16Blocks[0], s16Blocks.size(), true, options);
+        break;
+    default:
+        break;
+    }
+}
+
+struct SurfaceStreamOutput
+{
+    std::vector<uint8_t> *m_encoded;
+    size_t m_rowSize;
+    uint32_t m_numRows;
+};
+
+static void ReceiveSurfaceStreamRow(void *context, uint32_t blockRow, const uint8_t *pBC, size_t size)
+{
+    SurfaceStreamOutput *output = static_cast<SurfaceStreamOutput*>(context);
+    if (size == output->m_rowSize && (blockRow + 1) * size <= output->m_encoded->size())
+    {
+        memcpy(&(*output->m_encoded)[blockRow * size], pBC, size);
+        output->m_numRows++;
+    }
+}
+
+static void ReportSurfaceMatch(const char *formatName, const char *encoderName, bool succeeded, const std::vector<uint8_t> &encoded, const std::vector<uint8_t> &expected)
+{
+    if (!succeeded)
+    {
+        printf("FAIL %s %s: the encoder failed\n", formatName, encoderName);
+        g_numFailures++;
+    }
+    else if (encoded != expected)
+    {
+        printf("FAIL %s %s: output differs from the batch encoder\n", formatName, encoderName);
+        g_numFailures++;
+    }
+    else
+        printf("PASS %s %s\n", formatName, encoderName);
+}
+
+// Encodes a surface whose size isn't a multiple of 4, with some blocks repeated so that the surface encoders reuse their
+// output, and checks that every surface encoder produces the same blocks as the Batch encoders
+static void TestSurfaceEncoders(const std::vector<cvtt::PixelBlockU8> &blocks)
+{
+    static const char *formatNames[cvtt::SurfaceFormat_Count] =
+    {
+        "bc1", "bc2", "bc3", "bc4u", "bc4s", "bc5u", "bc5s", "bc6hu", "bc6hs", "bc7",
+        "etc1", "etc2", "etc2 rgba", "etc2 punchthrough", "etc2 alpha", "r11u", "r11s",
+    };
+
+    const uint32_t widthInBlocks = 23;
+    const uint32_t heightInBlocks = 11;
+    const uint32_t width = widthInBlocks * 4 - 1;
+    const uint32_t height = heightInBlocks * 4 - 2;
+
+    // Every third block is one of a few tiles, so the block cache has repeats to find both within and across SIMD groups
+    std::vector<cvtt::PixelBlockU8> sourceBlocks(widthInBlocks * heightInBlocks);
+    for (size_t i = 0; i < sourceBlocks.size(); i++)
+        sourceBlocks[i] = (i % 3 == 0) ? blocks[i % 7] : blocks[i];
+
+    cvtt::Options options;
+    options.flags = cvtt::Flags::Default;
+
+    cvtt::ETC1CompressionData *etc1Data = cvtt::Kernels::AllocETC1Data(AllocCompressionData, NULL);
+    cvtt::ETC2CompressionData *etc2Data = cvtt::Kernels::AllocETC2Data(AllocCompressionData, NULL, options);
+
+    const size_t cacheSize = cvtt::Kernels::GetPersistentBlockCacheSize(4096);
+    void *cacheStorage = malloc(cacheSize);
+
+    Random rng(7);
+
+    for (int formatIndex = 0; formatIndex < cvtt::SurfaceFormat_Count; formatIndex++)
+    {
+        const cvtt::SurfaceFormat format = static_cast<cvtt::SurfaceFormat>(formatIndex);
+        const char *formatName = formatNames[formatIndex];
+        const size_t pixelSize = cvtt::Kernels::GetSourcePixelSizeBytes(format);
+        const size_t rowPitch = width * pixelSize;
+        const size_t outRowPitch = widthInBlocks * cvtt::Kernels::GetBlockSizeBytes(format);
+
+        std::vector<uint8_t> pixels(rowPitch * height);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                const cvtt::PixelBlockU8 &block = sourceBlocks[(y / 4) * widthInBlocks + x / 4];
+                ConvertSurfacePixel(format, block.m_pixels[(y % 4) * 4 + x % 4], &pixels[y * rowPitch + x * pixelSize]);
+            }
+        }
+
+        std::vector<uint8_t> expected(outRowPitch * heightInBlocks);
+        EncodeGatheredSurface(format, pixels, width, height, &expected[0], options, etc1Data, etc2Data);
+
+        std::vector<uint8_t> encoded(expected.size());
+        bool succeeded = cvtt::Kernels::EncodeSurface(format, &pixels[0], rowPitch, width, height, &encoded[0], outRowPitch, options, NULL, etc1Data, etc2Data);
+        ReportSurfaceMatch(formatName, "EncodeSurface", succeeded, encoded, expected);
+
+        cvtt::Kernels::ParallelEncodeOptions parallelOptions;
+        parallelOptions.numThreads = 3;
+
+        std::fill(encoded.begin(), encoded.end(), 0);
+        succeeded = cvtt::Kernels::EncodeSurfaceParallel(format, &pixels[0], rowPitch, width, height, &encoded[0], outRowPitch, options, parallelOptions);
+        ReportSurfaceMatch(formatName, "EncodeSurfaceParallel", succeeded, encoded, expected);
+
+        // The stream encoder is given rows in random amounts that don't line up with block rows
+        std::fill(encoded.begin(), encoded.end(), 0);
+
+        SurfaceStreamOutput streamOutput;
+        streamOutput.m_encoded = &encoded;
+        streamOutput.m_rowSize = outRowPitch;
+        streamOutput.m_numRows = 0;
+
+        cvtt::SurfaceStreamEncoder *streamEncoder = cvtt::Kernels::AllocSurfaceStreamEncoder(AllocCompressionData, FreeCompressionData, NULL, format, width, height,
+            options, NULL, ReceiveSurfaceStreamRow, &streamOutput);
+        succeeded = (streamEncoder != NULL);
+
+        for (uint32_t y = 0; y < height && succeeded; )
+        {
+            const uint32_t numRows = std::min<uint32_t>(1 + rng.Next() % 9, height - y);
+            succeeded = cvtt::Kernels::PushSurfaceStreamRows(streamEncoder, &pixels[y * rowPitch], rowPitch, numRows);
+            y += numRows;
+        }
+
+        if (streamEncoder)
+            cvtt::Kernels::ReleaseSurfaceStreamEncoder(streamEncoder, FreeCompressionData);
+
+        ReportSurfaceMatch(formatName, "stream encoder", succeeded && streamOutput.m_numRows == heightInBlocks, encoded, expected);
+
+        // The first pass fills the persistent cache and the second one takes every block from it
+        cvtt::Options cacheOptions = options;
+        cacheOptions.blockCache = cvtt::Kernels::InitPersistentBlockCache(cacheStorage, cacheSize);
+
+        std::fill(encoded.begin(), encoded.end(), 0);
+        succeeded = (cacheOptions.blockCache != NULL);
+        succeeded = succeeded && cvtt::Kernels::EncodeSurface(format, &pixels[0], rowPitch, width, height, &encoded[0], outRowPitch, cacheOptions, NULL, etc1Data, etc2Data);
+        ReportSurfaceMatch(formatName, "persistent cache first pass", succeeded, encoded, expected);
+
+        std::fill(encoded.begin(), encoded.end(), 0);
+        succeeded = succeeded && cvtt::Kernels::EncodeSurfaceParallel(format, &pixels[0], rowPitch, width, height, &encoded[0], outRowPitch, cacheOptions, parallelOptions);
+        ReportSurfaceMatch(formatName, "persistent cache second pass", succeeded, encoded, expected);
+
+        // Clear the cache so that the next format starts empty
+        memset(cacheStorage, 0, cacheSize);
+    }
+
+    free(cacheStorage);
+
+    cvtt::Kernels::ReleaseETC1Data(etc1Data, FreeCompressionData);
+    cvtt::Kernels::ReleaseETC2Data(etc2Data, FreeCompressionData);
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    std::vector<cvtt::PixelBlockU8> blocks;
+    std::vector<cvtt::PixelBlockS8> signedBlocks;
+    GenerateBlocks(blocks, 12345);
+    GenerateSignedBlocks(signedBlocks, blocks);
+
+    TestS3TC(blocks, signedBlocks);
+    TestETC(blocks);
+    TestBC6H(blocks);
+    TestBC7(blocks);
+    TestSurfaceEncoders(blocks);
+
+    if (g_numFailures != 0)
+    {
+        printf("%i test(s) failed\n", g_numFailures);
+        return 1;
+    }
+
+    printf("All tests passed\n");
+    return 0;
+}